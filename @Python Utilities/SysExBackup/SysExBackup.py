@@ -0,0 +1,391 @@
+#!/usr/bin/env python3
+# ==================================================================================
+# File: SysExBackup.py
+# Description: USB-MIDI SysEx dump / restore of the FORGE block storage
+#
+# Copyright (c) 2026 Dad Design.
+# ==================================================================================
+import argparse
+import struct
+import sys
+import time
+import zlib
+
+import mido
+
+# Message: F0 7D 44 46 <Cmd> <7-bit packed body + CRC16> F7 (see cMidiSysEx.h)
+HEADER = [0x7D, 0x44, 0x46]
+
+HELLO, LIST, READ, WRITE_BEGIN, WRITE_DATA, WRITE_END, STATUS, DELETE, RESTART, BOOT, BENCH = range(1, 12)
+INFO, LIST_REPLY, DATA, STATUS_REPLY, BOOT_REPLY, BENCH_REPLY = 0x41, 0x42, 0x43, 0x47, 0x48, 0x49
+ACK, NAK = 0x7E, 0x7F
+
+ERRORS = {1: "CRC", 2: "offset", 3: "state", 4: "storage", 5: "command", 6: "transfer"}
+ERR_TRANSFER = 6
+
+# Memory manager saves (cMemoryManager.h)
+MEM_HEADER_ID = struct.unpack("<I", b"MEMA")[0]
+SLOT_ID = struct.unpack("<I", b"SLO\0")[0]
+
+FILE_MAGIC = b"DADSYX1\0"
+TIMEOUT = 2.0
+
+
+# ----------------------------------------------------------------------------------
+# Codec (cSysExCodec)
+# ----------------------------------------------------------------------------------
+def crc16(data, crc=0xFFFF):
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def pack(data):
+    out = []
+    for group in range(0, len(data), 7):
+        chunk = data[group:group + 7]
+        out.append(sum(((b >> 7) & 1) << n for n, b in enumerate(chunk)))
+        out.extend(b & 0x7F for b in chunk)
+    return out
+
+
+def unpack(data):
+    out = bytearray()
+    for group in range(0, len(data), 8):
+        msb = data[group]
+        for n, b in enumerate(data[group + 1:group + 8]):
+            out.append(b | (((msb >> n) & 1) << 7))
+    return bytes(out)
+
+
+def build(cmd, body=b""):
+    crc = crc16(bytes([cmd]) + body)
+    return HEADER + [cmd] + pack(body + struct.pack("<H", crc))
+
+
+def parse(data):
+    """Returns (cmd, body) of a valid message, None otherwise"""
+    if len(data) < 4 or list(data[:3]) != HEADER:
+        return None
+    cmd = data[3]
+    raw = unpack(bytes(data[4:]))
+    if len(raw) < 2:
+        return None
+    body, crc = raw[:-2], struct.unpack("<H", raw[-2:])[0]
+    if crc16(bytes([cmd]) + body) != crc:
+        return None
+    return cmd, body
+
+
+def id_name(save_id):
+    raw = struct.pack("<I", save_id)
+    if all(32 <= c < 127 for c in raw):
+        return raw.decode()
+    if raw[:3] == b"SLO":
+        return f"SLO+{raw[3]}"
+    return f"0x{save_id:08X}"
+
+
+# ----------------------------------------------------------------------------------
+# Device link
+# ----------------------------------------------------------------------------------
+class Device:
+    def __init__(self, port_name):
+        self.input = mido.open_input(port_name)
+        self.output = mido.open_output(port_name)
+        self.info = None
+
+    def close(self):
+        self.input.close()
+        self.output.close()
+
+    def send(self, cmd, body=b""):
+        self.output.send(mido.Message("sysex", data=build(cmd, body)))
+
+    def receive(self, timeout=TIMEOUT):
+        """Next valid reply (cmd, body), None on time out"""
+        end = time.monotonic() + timeout
+        while time.monotonic() < end:
+            for msg in self.input.iter_pending():
+                if msg.type == "sysex":
+                    reply = parse(msg.data)
+                    if reply is not None:
+                        return reply
+            time.sleep(0.0005)
+        return None
+
+    def request(self, cmd, body=b"", expect=ACK, retries=3):
+        """Sends a command, retries on time out, returns the reply body"""
+        for _ in range(retries):
+            self.send(cmd, body)
+            while (reply := self.receive()) is not None:
+                rcmd, rbody = reply
+                # Late replies to earlier commands are skipped
+                if rcmd == NAK and rbody[0] == cmd and rbody[1] == ERR_TRANSFER:
+                    break                            # Reply cut by the device: ask again
+                if rcmd == NAK and rbody[0] == cmd:
+                    raise RuntimeError(f"command 0x{cmd:02X} refused: {ERRORS.get(rbody[1], rbody[1])}")
+                if rcmd == expect and (expect != ACK or rbody[0] == cmd):
+                    return rbody
+        raise RuntimeError(f"no reply to command 0x{cmd:02X}")
+
+    def hello(self):
+        body = self.request(HELLO, expect=INFO)
+        version, chunk, window, blocks, block_data = struct.unpack("<BHBII", body[:12])
+        self.info = {"version": version, "chunk": chunk, "window": window,
+                     "blocks": blocks, "block_data": block_data}
+        return self.info
+
+    def list(self):
+        saves, index = [], 0
+        while index != 0xFFFFFFFF:
+            body = self.request(LIST, struct.pack("<I", index), expect=LIST_REPLY)
+            index, count = struct.unpack("<IB", body[:5])
+            for n in range(count):
+                saves.append(struct.unpack("<II", body[5 + n * 8:13 + n * 8]))
+        return saves
+
+    def read(self, save_id, size, progress=None):
+        """Pipelined READ requests, at most "window" in flight"""
+        chunk, window = self.info["chunk"], self.info["window"]
+        data = bytearray(size)
+        pending = {}                                 # offset -> time sent
+        next_offset, received = 0, 0
+        while received < size:
+            while len(pending) < window and next_offset < size:
+                self.send(READ, struct.pack("<IIH", save_id, next_offset, chunk))
+                pending[next_offset] = time.monotonic()
+                next_offset += chunk
+            reply = self.receive()
+            if reply is not None and reply[0] == NAK and reply[1][0] == READ and reply[1][1] == ERR_TRANSFER:
+                # DATA cut by the device: ask again for this chunk
+                offset = struct.unpack("<I", reply[1][6:10])[0]
+                if offset in pending:
+                    self.send(READ, struct.pack("<IIH", save_id, offset, chunk))
+                    pending[offset] = time.monotonic()
+                continue
+            if reply is None or reply[0] != DATA:
+                # Lost request or reply: ask again for what is missing
+                for offset in list(pending):
+                    self.send(READ, struct.pack("<IIH", save_id, offset, chunk))
+                continue
+            rid, offset = struct.unpack("<II", reply[1][:8])
+            if rid != save_id or offset not in pending:
+                continue
+            payload = reply[1][8:]
+            if not payload:
+                raise RuntimeError(f"{id_name(save_id)}: save shorter than announced")
+            data[offset:offset + len(payload)] = payload
+            del pending[offset]
+            received += len(payload)
+            if progress:
+                progress(received, size)
+        return bytes(data)
+
+    def write(self, save_id, data, progress=None):
+        """Windowed WRITE_DATA, go-back-N from the offset given by the NAKs"""
+        chunk, window = self.info["chunk"], self.info["window"]
+        size = len(data)
+
+        status = self.request(STATUS, expect=STATUS_REPLY)
+        active, sid, offset, ssize = struct.unpack("<BIII", status[:13])
+        if active and sid == save_id and ssize == size and offset > 0:
+            print(f"  resuming {id_name(save_id)} at {offset}")
+        else:
+            self.request(WRITE_BEGIN, struct.pack("<II", save_id, size))
+            offset = 0
+
+        next_offset, in_flight, resume = offset, 0, None
+        while True:
+            while resume is None and in_flight < window and next_offset < size:
+                self.send(WRITE_DATA, struct.pack("<II", save_id, next_offset) + data[next_offset:next_offset + chunk])
+                next_offset += min(chunk, size - next_offset)
+                in_flight += 1
+            if in_flight == 0:
+                if resume is None and next_offset >= size:
+                    break
+                next_offset, resume = resume, None
+                continue
+            reply = self.receive()
+            if reply is None:
+                # Replies lost: the device gives the expected offset
+                status = self.request(STATUS, expect=STATUS_REPLY)
+                active, sid, offset, _ = struct.unpack("<BIII", status[:13])
+                if not active or sid != save_id:
+                    raise RuntimeError(f"{id_name(save_id)}: save dropped by the device")
+                in_flight, resume = 0, offset
+                continue
+            rcmd, rbody = reply
+            if rbody[0] != WRITE_DATA:
+                continue
+            in_flight -= 1
+            if rcmd == ACK:
+                if progress:
+                    progress(struct.unpack("<I", rbody[5:9])[0], size)
+            elif rcmd == NAK:
+                if rbody[1] in (1, 2, ERR_TRANSFER):
+                    resume = struct.unpack("<I", rbody[6:10])[0]
+                else:
+                    raise RuntimeError(f"{id_name(save_id)}: {ERRORS.get(rbody[1], rbody[1])} error")
+
+        self.request(WRITE_END, struct.pack("<I", save_id))
+
+    def boot(self):
+        """Boot profile: core clock, total cycles, [(phase, cycles)]"""
+        body = self.request(BOOT, expect=BOOT_REPLY)
+        clock, total, count = struct.unpack("<IIB", body[:9])
+        phases = []
+        for n in range(count):
+            name, cycles = struct.unpack("<12sI", body[9 + n * 16:25 + n * 16])
+            phases.append((name.rstrip(b"\0").decode(errors="replace"), cycles))
+        return clock, total, phases
+
+    def bench(self):
+        """On-target probes (MONITOR firmware): [(name, value)]. Page 0 runs
+        the probes, the next pages read the same run."""
+        results = []
+        index = 0
+        while index != 0xFFFFFFFF:
+            body = self.request(BENCH, struct.pack("<I", index), expect=BENCH_REPLY, retries=1)
+            index, count = struct.unpack("<IB", body[:5])
+            for n in range(count):
+                name, value = struct.unpack("<12si", body[5 + n * 16:21 + n * 16])
+                results.append((name.rstrip(b"\0").decode(errors="replace"), value / 100))
+        return results
+
+
+# ----------------------------------------------------------------------------------
+# Backup file: magic, then records (ID u32, Size u32, data, CRC32 u32)
+# ----------------------------------------------------------------------------------
+def write_file(path, saves):
+    with open(path, "wb") as f:
+        f.write(FILE_MAGIC)
+        for save_id, data in saves:
+            f.write(struct.pack("<II", save_id, len(data)))
+            f.write(data)
+            f.write(struct.pack("<I", zlib.crc32(data)))
+
+
+def read_file(path):
+    saves = []
+    with open(path, "rb") as f:
+        if f.read(len(FILE_MAGIC)) != FILE_MAGIC:
+            raise RuntimeError(f"{path}: not a SysExBackup file")
+        while header := f.read(8):
+            save_id, size = struct.unpack("<II", header)
+            data = f.read(size)
+            (crc,) = struct.unpack("<I", f.read(4))
+            if len(data) != size or zlib.crc32(data) != crc:
+                raise RuntimeError(f"{path}: {id_name(save_id)} corrupted")
+            saves.append((save_id, data))
+    return saves
+
+
+def progress_bar(name):
+    start = time.monotonic()
+
+    def show(done, total):
+        rate = done / max(time.monotonic() - start, 1e-6) / 1024
+        print(f"\r  {name:<10} {done:>9}/{total:<9} {rate:7.1f} KB/s", end="", flush=True)
+        if done >= total:
+            print()
+    return show
+
+
+def select_saves(saves, slots):
+    if slots is None:
+        return saves
+    wanted = {MEM_HEADER_ID} | {SLOT_ID + s for s in slots}
+    return [s for s in saves if s[0] in wanted]
+
+
+# ----------------------------------------------------------------------------------
+# Main
+# ----------------------------------------------------------------------------------
+def main():
+    parser = argparse.ArgumentParser(description="Dump / restore the FORGE block storage over USB-MIDI SysEx")
+    parser.add_argument("--port", help="MIDI port (default: first port named FORGE)")
+    sub = parser.add_subparsers(dest="command", required=True)
+    sub.add_parser("ports", help="list the MIDI ports")
+    sub.add_parser("list", help="list the saves of the device")
+    dump = sub.add_parser("dump", help="dump the saves to a file")
+    dump.add_argument("file")
+    dump.add_argument("--slots", type=int, nargs="+", help="memory slots only (with the memory header)")
+    restore = sub.add_parser("restore", help="restore the saves of a file")
+    restore.add_argument("file")
+    restore.add_argument("--slots", type=int, nargs="+", help="memory slots only (with the memory header)")
+    restore.add_argument("--no-restart", action="store_true", help="do not restart the device")
+    delete = sub.add_parser("delete", help="delete a save")
+    delete.add_argument("id", help="save ID: 4 characters or hexadecimal number")
+    sub.add_parser("restart", help="restart the device")
+    sub.add_parser("boot", help="show the boot profile of the device")
+    sub.add_parser("bench", help="run the on-target benchmarks (MONITOR firmware)")
+    args = parser.parse_args()
+
+    if args.command == "ports":
+        for name in mido.get_input_names():
+            print(name)
+        return 0
+
+    port = args.port or next((n for n in mido.get_input_names() if "FORGE" in n.upper()), None)
+    if port is None:
+        print("No device port found, use --port", file=sys.stderr)
+        return 1
+
+    device = Device(port)
+    try:
+        info = device.hello()
+        print(f"{port}: protocol {info['version']}, chunk {info['chunk']}, window {info['window']}")
+
+        if args.command == "list":
+            for save_id, size in device.list():
+                print(f"  {id_name(save_id):<10} {size:>9} bytes")
+
+        elif args.command == "dump":
+            saves = []
+            for save_id, size in select_saves(device.list(), args.slots):
+                saves.append((save_id, device.read(save_id, size, progress_bar(id_name(save_id)))))
+            write_file(args.file, saves)
+            print(f"{len(saves)} saves written to {args.file}")
+
+        elif args.command == "restore":
+            saves = select_saves(read_file(args.file), args.slots)
+            for save_id, data in saves:
+                device.write(save_id, data, progress_bar(id_name(save_id)))
+            print(f"{len(saves)} saves restored")
+            if not args.no_restart:
+                device.request(RESTART)             # Memory manager reloads its header
+
+        elif args.command == "delete":
+            raw = args.id.encode()
+            save_id = struct.unpack("<I", raw)[0] if len(raw) == 4 else int(args.id, 16)
+            device.request(DELETE, struct.pack("<I", save_id))
+
+        elif args.command == "restart":
+            device.request(RESTART)
+
+        elif args.command == "boot":
+            clock, total, phases = device.boot()
+            if clock == 0:
+                print("  boot profiler not started by the application")
+            else:
+                for name, cycles in phases:
+                    print(f"  {name:<12} {cycles * 1000 / clock:9.2f} ms")
+                print(f"  {'Total':<12} {total * 1000 / clock:9.2f} ms")
+
+        elif args.command == "bench":
+            for name, value in device.bench():
+                print(f"  {name:<12} {value:10.2f}")
+    except RuntimeError as error:
+        print(f"\n{error}", file=sys.stderr)
+        return 1
+    finally:
+        device.close()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
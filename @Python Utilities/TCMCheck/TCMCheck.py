@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+# ==================================================================================
+# File: TCMCheck.py
+# Description: Linker map verification of the ITCM/DTCM placement
+#
+# Copyright (c) 2026 Dad Design.
+# ==================================================================================
+import argparse
+import re
+import sys
+
+# Memory ranges of the STM32H7 tightly coupled memories
+ITCM_RANGE = (0x00000000, 0x00010000)
+DTCM_RANGE = (0x20000000, 0x20020000)
+
+ITCM_SECTION = ".moveITCM"
+DTCM_SECTION = ".DTCM_Section"
+
+# Functions that must run from ITCM when TCM_PLACEMENT is defined
+DEFAULT_REQUIRED = [
+    "HAL_SAI_RxCpltCallback",
+    "HAL_SAI_RxHalfCpltCallback",
+    "ConvertToAudioBuffer",
+    "ConvertFromAudioBuffer",
+    "cDelayLine::Push",
+    "cDelayLine::Pull",
+    r"::(on)?Process\(",
+]
+
+OUTPUT_SECTION = re.compile(r"^(\.\S+)\s*(0x[0-9a-fA-F]+)?\s*(0x[0-9a-fA-F]+)?")
+INPUT_SECTION = re.compile(r"^ (\.\S+)\s+(0x[0-9a-fA-F]+)\s+(0x[0-9a-fA-F]+)\s+(\S+)")
+INPUT_SECTION_NAME_ONLY = re.compile(r"^ (\.\S+)\s*$")
+INPUT_SECTION_WRAPPED = re.compile(r"^\s+(0x[0-9a-fA-F]+)\s+(0x[0-9a-fA-F]+)\s+(\S+)")
+SYMBOL = re.compile(r"^\s+(0x[0-9a-fA-F]+)\s+([^\s=].*)$")
+
+
+# ----------------------------------------------------------------------------------
+# Parses the map: returns {output section: [(address, size, object, [symbols])]}
+# ----------------------------------------------------------------------------------
+def parse_map(path):
+    sections = {}
+    current_output = None
+    current_input = None
+    pending_name = None
+
+    with open(path, encoding="utf-8", errors="replace") as f:
+        in_map = False
+        for line in f:
+            line = line.rstrip("\n")
+            if line.startswith("Linker script and memory map"):
+                in_map = True
+                continue
+            if not in_map:
+                continue
+
+            m = OUTPUT_SECTION.match(line)
+            if m and not line.startswith(" "):
+                current_output = m.group(1)
+                current_input = None
+                continue
+
+            if current_output not in (ITCM_SECTION, DTCM_SECTION):
+                continue
+
+            m = INPUT_SECTION.match(line)
+            if m:
+                current_input = [int(m.group(2), 16), int(m.group(3), 16), m.group(4), []]
+                sections.setdefault(current_output, []).append(current_input)
+                continue
+
+            # Long input section names are wrapped on two lines
+            m = INPUT_SECTION_NAME_ONLY.match(line)
+            if m:
+                pending_name = m.group(1)
+                continue
+            m = INPUT_SECTION_WRAPPED.match(line)
+            if m and pending_name:
+                current_input = [int(m.group(1), 16), int(m.group(2), 16), m.group(3), []]
+                sections.setdefault(current_output, []).append(current_input)
+                pending_name = None
+                continue
+
+            m = SYMBOL.match(line)
+            if m and current_input is not None:
+                current_input[3].append((int(m.group(1), 16), m.group(2).strip()))
+    return sections
+
+
+# ----------------------------------------------------------------------------------
+def in_range(address, size, memory_range):
+    return memory_range[0] <= address and address + size <= memory_range[1]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Checks the ITCM/DTCM placement of a FORGE firmware")
+    parser.add_argument("map", help="GNU ld map file")
+    parser.add_argument("--require", action="append", default=[],
+                        help="regular expression of a symbol that must be in ITCM")
+    parser.add_argument("--no-default", action="store_true",
+                        help="do not check the default list of hot functions")
+    args = parser.parse_args()
+
+    sections = parse_map(args.map)
+    errors = 0
+
+    for name, memory_range in ((ITCM_SECTION, ITCM_RANGE), (DTCM_SECTION, DTCM_RANGE)):
+        entries = sections.get(name, [])
+        used = sum(e[1] for e in entries)
+        total = memory_range[1] - memory_range[0]
+        print(f"{name}: {used} bytes ({100.0 * used / total:.1f} % of {total // 1024} KB)")
+        for address, size, obj, symbols in entries:
+            place = "ok " if in_range(address, size, memory_range) else "OUT"
+            if place == "OUT":
+                errors += 1
+            label = ", ".join(s for _, s in symbols) or "-"
+            print(f"  {place} 0x{address:08x} {size:6d}  {obj}  {label}")
+
+    required = ([] if args.no_default else DEFAULT_REQUIRED) + args.require
+    itcm_symbols = [s for e in sections.get(ITCM_SECTION, []) for _, s in e[3]]
+    for pattern in required:
+        if not any(re.search(pattern, s) for s in itcm_symbols):
+            print(f"missing in ITCM: {pattern}")
+            errors += 1
+
+    if not sections:
+        print("no TCM section found: was the firmware built with TCM_PLACEMENT?")
+        errors += 1
+
+    print("TCM placement OK" if errors == 0 else f"{errors} error(s)")
+    return 0 if errors == 0 else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,66 @@
+//==================================================================================
+//==================================================================================
+// File: Denormals.h
+// Description: Flush-to-zero configuration of the FPU
+//
+// Decaying reverb and delay tails end in denormal floats. Without FTZ the
+// Cortex-M7 FPU handles them at full speed but a host (x86 without DAZ/FTZ)
+// can slow down by two orders of magnitude, and denormals never reach zero.
+//
+// Target: FPSCR.FZ for thread mode and FPDSCR.FZ, the FPSCR loaded on
+//         exception entry: the audio runs in the SAI DMA interrupt.
+// Host:   MXCSR FTZ and DAZ (x86 SSE) or FPCR.FZ (AArch64).
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#pragma once
+
+#include <cstdint>
+
+#if defined(__ARM_ARCH_7EM__) && !defined(__aarch64__)
+#include "main.h"
+#define DAD_FTZ_TARGET
+#elif defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#include <pmmintrin.h>
+#endif
+
+namespace DadDSP {
+
+// -----------------------------------------------------------------------------
+// Function: EnableFlushToZero
+// Description: Flushes denormal results (and inputs on the host) to zero
+// -----------------------------------------------------------------------------
+inline void EnableFlushToZero() {
+#if defined(DAD_FTZ_TARGET)
+    constexpr uint32_t FPSCR_FZ = 1UL << 24;
+    __set_FPSCR(__get_FPSCR() | FPSCR_FZ);
+    FPU->FPDSCR |= FPU_FPDSCR_FZ_Msk;
+#elif defined(__SSE__) || defined(_M_X64)
+    _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+    _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
+#elif defined(__aarch64__)
+    uint64_t Fpcr;
+    __asm__ volatile("mrs %0, fpcr" : "=r"(Fpcr));
+    Fpcr |= (1ULL << 24);
+    __asm__ volatile("msr fpcr, %0" : : "r"(Fpcr));
+#endif
+}
+
+// -----------------------------------------------------------------------------
+// Function: isFlushToZeroActive
+// Description: Checks FTZ in the calling context (call it from the audio
+//              interrupt to check FPDSCR on the target)
+// -----------------------------------------------------------------------------
+inline bool isFlushToZeroActive() {
+    volatile float Small = 1.0e-30f;
+    volatile float Scale = 1.0e-10f;
+    float Result = Small * Scale;           // 1e-40: denormal without FTZ
+    return Result == 0.0f;
+}
+
+} // namespace DadDSP
+
+//***End of file**************************************************************
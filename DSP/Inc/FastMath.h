@@ -0,0 +1,81 @@
+//==================================================================================
+//==================================================================================
+// File: FastMath.h
+// Description: Fast log2/exp2 approximations for log domain gain computation
+//
+// Both functions split the IEEE-754 float into exponent and mantissa and
+// approximate the mantissa part with a short polynomial (least squares fit):
+//     FastLog2 : 4th order, absolute error < 1.2e-4 (< 0.001 dB)
+//     FastExp2 : 3rd order, relative error < 9e-5  (< 0.001 dB)
+// They are intended for gain computers and meters, not for signal shaping.
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace DadDSP {
+
+constexpr float DB_PER_LOG2 = 6.0205999f;           // 20 * log10(2)
+constexpr float LOG2_PER_DB = 1.0f / DB_PER_LOG2;   // 1 / (20 * log10(2))
+
+// -----------------------------------------------------------------------------
+// Function: FastLog2
+// Description: log2(x) for x > 0 (denormals and zero return about -127)
+// -----------------------------------------------------------------------------
+inline float FastLog2(float x) {
+    uint32_t Bits;
+    memcpy(&Bits, &x, sizeof(Bits));
+    float Exponent = static_cast<float>(static_cast<int32_t>((Bits >> 23) & 0xFF) - 127);
+
+    // Mantissa in [1, 2): log2(1 + f), f in [0, 1)
+    Bits = (Bits & 0x007FFFFFUL) | 0x3F800000UL;
+    float m;
+    memcpy(&m, &Bits, sizeof(m));
+    float f = m - 1.0f;
+    return Exponent + f * (1.438638026f + f * (-0.6777432667f + f * (0.321879707f + f * -0.08286069831f)));
+}
+
+// -----------------------------------------------------------------------------
+// Function: FastExp2
+// Description: 2^x, x clamped to [-126, 126]
+// -----------------------------------------------------------------------------
+inline float FastExp2(float x) {
+    if (x < -126.0f) x = -126.0f;
+    else if (x > 126.0f) x = 126.0f;
+
+    // x = i + f with f in [0, 1)
+    int32_t i = static_cast<int32_t>(x);
+    if (static_cast<float>(i) > x) i--;             // Floor for negative values
+    float f = x - static_cast<float>(i);
+
+    float Mantissa = 1.0f + f * (0.6951228927f + f * (0.2276455792f + f * 0.07705804611f));
+    uint32_t Bits = static_cast<uint32_t>(i + 127) << 23;
+    float Scale;
+    memcpy(&Scale, &Bits, sizeof(Scale));
+    return Mantissa * Scale;
+}
+
+// -----------------------------------------------------------------------------
+// Function: FastLinToDb
+// Description: 20 * log10(x) for x > 0
+// -----------------------------------------------------------------------------
+inline float FastLinToDb(float x) {
+    return DB_PER_LOG2 * FastLog2(x);
+}
+
+// -----------------------------------------------------------------------------
+// Function: FastDbToLin
+// Description: 10^(Db / 20)
+// -----------------------------------------------------------------------------
+inline float FastDbToLin(float Db) {
+    return FastExp2(Db * LOG2_PER_DB);
+}
+
+} // namespace DadDSP
+
+//***End of file**************************************************************
@@ -11,6 +11,9 @@
 #pragma once
 #include "main.h"
 
+// Number of segments of the quarter sine gain table
+#define FADER_TABLE_SIZE    256
+
 namespace DadDSP {
 
 //**********************************************************************************
@@ -73,6 +76,11 @@ public:
     //--------------------------------------------------------------------------------
     bool isFading() const { return (m_state != NO_FADE); }
 
+    //--------------------------------------------------------------------------------
+    // Checks if source B is the only audible source (no fade, last fade to B)
+    //--------------------------------------------------------------------------------
+    bool isOnB() const { return (m_state == NO_FADE) && (m_lastState == FADING_IN_B); }
+
 private:
     // =============================================================================
     // Private Member Variables Section
@@ -84,6 +92,7 @@ private:
     uint32_t m_sampleRate;          // Audio sample rate in Hz
     float    m_fadeTimeSeconds;     // Fade duration in seconds
     int      m_totalFadeSamples;    // Total number of samples for complete fade
+    float    m_tableStep;           // Gain table increment per sample
 
     // -----------------------------------------------------------------------------
     // Fade State Tracking
@@ -91,6 +100,13 @@ private:
     int      m_currentFadeSample;   // Current sample position in fade sequence
     FadeState m_state;              // Current active fade state
     FadeState m_lastState;          // Last completed fade state for steady state
+    float    m_tablePos;            // Current position in the gain table
+
+    // -----------------------------------------------------------------------------
+    // Equal-power gain table: sin(x * PI/2), x in [0, 1], shared by all faders
+    // -----------------------------------------------------------------------------
+    static float m_GainTable[FADER_TABLE_SIZE + 2];
+    static bool  m_GainTableReady;
 };
 
 } // namespace DadDSP
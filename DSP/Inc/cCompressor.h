@@ -0,0 +1,210 @@
+//==================================================================================
+//==================================================================================
+// File: cCompressor.h
+// Description: Block based dynamics processors (compressor and look-ahead limiter)
+//              Log domain gain computation with FastLog2/FastExp2
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#pragma once
+
+#include "main.h"
+#include "FastMath.h"
+#include <cstdint>
+#include <cmath>
+
+namespace DadDSP {
+
+//**********************************************************************************
+// Constants
+//**********************************************************************************
+
+constexpr uint32_t COMP_BLOCK_SIZE = 16;            // Detector block (0.33 ms at 48 kHz)
+constexpr uint32_t LIMITER_DELAY   = 2 * COMP_BLOCK_SIZE;   // Limiter look-ahead (power of 2)
+
+//**********************************************************************************
+// Class: cCompressor
+// Description: Stereo linked feed-forward compressor with a block envelope detector
+//
+// Per sample, only the peak of the block is tracked (Detect) and the gain is
+// read from a linear ramp (getGain). Once per COMP_BLOCK_SIZE samples,
+// UpdateBlock converts the block peak to dB, applies the soft knee gain
+// computer, smooths the gain reduction in dB with the attack/release
+// coefficients and sets the ramp toward the new linear gain:
+//     Level  = 20 * log10(peak)
+//     GR     = (1/Ratio - 1) * (Level - Threshold)        above the knee
+//     Gain   = 10^((smoothed GR + Makeup) / 20)
+// The detector reacts one block late: short transients above the threshold
+// pass for up to COMP_BLOCK_SIZE samples (see cLimiter for a hard ceiling).
+//**********************************************************************************
+
+class cCompressor {
+public:
+    // =============================================================================
+    // Initialization
+    // =============================================================================
+
+    // -----------------------------------------------------------------------------
+    // Initializes the compressor (threshold 0 dB, ratio 1:1, no makeup)
+    void Initialize(float SampleRate);
+
+    // -----------------------------------------------------------------------------
+    // Clears the detector and sets the gain to its static value
+    void Reset();
+
+    // -----------------------------------------------------------------------------
+    // Setters (control thread)
+    inline void setThreshold(float Db) { m_ThresholdDb = Db; }
+    inline void setRatio(float Ratio) { m_Slope = 1.0f / ((Ratio < 1.0f) ? 1.0f : Ratio) - 1.0f; }
+    inline void setKnee(float Db) { m_KneeDb = (Db < 0.0f) ? 0.0f : Db; }
+    inline void setMakeup(float Db) { m_MakeupDb = Db; }
+    void setAttack(float Seconds);
+    void setRelease(float Seconds);
+
+    // -----------------------------------------------------------------------------
+    // Current gain reduction in dB (<= 0), for metering
+    inline float getGainReductionDb() const { return m_EnvDb; }
+
+    // =============================================================================
+    // Processing
+    // =============================================================================
+
+    // -----------------------------------------------------------------------------
+    // Feeds the detector with one stereo sample
+    inline void Detect(float Left, float Right) {
+        float a = fabsf(Left);
+        float b = fabsf(Right);
+        if (b > a) a = b;
+        if (a > m_Peak) m_Peak = a;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Returns the gain of the current sample (one call per sample)
+    inline float getGain() {
+        m_Gain += m_GainStep;
+        return m_Gain;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Updates the gain ramp from the block peak (once per COMP_BLOCK_SIZE samples)
+    void UpdateBlock();
+
+protected:
+    // -----------------------------------------------------------------------------
+    // Static curve: gain reduction in dB (<= 0) for an input level in dB
+    float ComputeReduction(float LevelDb) const;
+
+    // =============================================================================
+    // Member variables
+    // =============================================================================
+
+    float m_SampleRate = SAMPLING_RATE;     // Sampling rate in Hz
+    float m_ThresholdDb = 0.0f;             // Threshold in dBFS
+    float m_Slope = 0.0f;                   // 1/Ratio - 1
+    float m_KneeDb = 0.0f;                  // Soft knee width in dB
+    float m_MakeupDb = 0.0f;                // Makeup gain in dB
+    float m_AttackCoeff = 0.0f;             // Block rate attack coefficient
+    float m_ReleaseCoeff = 0.0f;            // Block rate release coefficient
+
+    float m_Peak = 0.0f;                    // Peak of the current block
+    float m_EnvDb = 0.0f;                   // Smoothed gain reduction in dB
+    float m_Gain = 1.0f;                    // Current linear gain
+    float m_GainTarget = 1.0f;              // Linear gain at the end of the ramp
+    float m_GainStep = 0.0f;                // Per sample ramp increment
+};
+
+//**********************************************************************************
+// Class: cLimiter
+// Description: Stereo look-ahead brickwall limiter
+//
+// The audio is delayed by LIMITER_DELAY samples (two detector blocks). When
+// block n is complete, the gain needed by blocks n-1 and n is known and the
+// ramp played during block n-1 reaches it before block n is output: the gain
+// applied to a sample never exceeds the gain its own block requires, so the
+// output stays under the ceiling (within the FastLog2/FastExp2 accuracy).
+// Attack is instantaneous, release is exponential in dB.
+//**********************************************************************************
+
+class cLimiter {
+public:
+    // =============================================================================
+    // Initialization
+    // =============================================================================
+
+    // -----------------------------------------------------------------------------
+    // Initializes the limiter (ceiling 0 dBFS)
+    void Initialize(float SampleRate);
+
+    // -----------------------------------------------------------------------------
+    // Clears the look-ahead buffer and the detector
+    void Reset();
+
+    // -----------------------------------------------------------------------------
+    // Setters (control thread)
+    inline void setCeiling(float Db) { m_CeilingDb = Db; }
+    void setRelease(float Seconds);
+
+    // -----------------------------------------------------------------------------
+    // Getters
+    inline float getGainReductionDb() const { return m_EnvDb; }
+    inline uint32_t getLatency() const { return LIMITER_DELAY; }
+
+    // =============================================================================
+    // Processing
+    // =============================================================================
+
+    // -----------------------------------------------------------------------------
+    // Processes one stereo sample in place (output delayed by LIMITER_DELAY)
+    inline void Process(float& Left, float& Right) {
+        float a = fabsf(Left);
+        float b = fabsf(Right);
+        if (b > a) a = b;
+        if (a > m_Peak) m_Peak = a;
+
+        float DelayedLeft = m_DelayLeft[m_Index];
+        float DelayedRight = m_DelayRight[m_Index];
+        m_DelayLeft[m_Index] = Left;
+        m_DelayRight[m_Index] = Right;
+        m_Index = (m_Index + 1) & (LIMITER_DELAY - 1);
+
+        m_Gain += m_GainStep;
+        Left = DelayedLeft * m_Gain;
+        Right = DelayedRight * m_Gain;
+
+        if (++m_Count == COMP_BLOCK_SIZE) {
+            m_Count = 0;
+            UpdateBlock();
+        }
+    }
+
+protected:
+    // -----------------------------------------------------------------------------
+    // Updates the gain ramp from the block peak
+    void UpdateBlock();
+
+    // =============================================================================
+    // Member variables
+    // =============================================================================
+
+    float    m_SampleRate = SAMPLING_RATE;      // Sampling rate in Hz
+    float    m_CeilingDb = 0.0f;                // Output ceiling in dBFS
+    float    m_ReleaseCoeff = 0.0f;             // Block rate release coefficient
+
+    float    m_Peak = 0.0f;                     // Peak of the current block
+    float    m_PrevNeedDb = 0.0f;               // Reduction needed by the previous block
+    float    m_EnvDb = 0.0f;                    // Applied gain reduction in dB
+    float    m_Gain = 1.0f;                     // Current linear gain
+    float    m_GainTarget = 1.0f;               // Linear gain at the end of the ramp
+    float    m_GainStep = 0.0f;                 // Per sample ramp increment
+    uint32_t m_Count = 0;                       // Sample position inside the block
+
+    float    m_DelayLeft[LIMITER_DELAY];        // Look-ahead buffers
+    float    m_DelayRight[LIMITER_DELAY];
+    uint32_t m_Index = 0;                       // Look-ahead read/write position
+};
+
+} // namespace DadDSP
+
+//***End of file**************************************************************
@@ -0,0 +1,274 @@
+//==================================================================================
+//==================================================================================
+// File: cConvolver.h
+// Description: Uniformly partitioned FFT convolution (overlap-save)
+//              Cabinet impulse responses and convolution reverbs
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#pragma once
+
+#include "main.h"
+#include "cRealFFT.h"
+#include "cFlasherStorage.h"
+#include <cstdint>
+
+extern DadPersistentStorage::cFlasherStorage __FlasherStorage;
+
+namespace DadDSP {
+
+//**********************************************************************************
+// Class: cConvolver
+// Description: Mono convolution engine with PART_SIZE samples of latency
+//
+// The impulse response is cut into P partitions of PART_SIZE samples. Each
+// partition is zero padded to 2*PART_SIZE and transformed once at load time.
+// Every PART_SIZE input samples, the last 2*PART_SIZE inputs are transformed
+// and stored in a frequency domain delay line (FDL); the output block is
+//     y = last half of IFFT( sum(k = 0..P-1) H[k] * X[n-k] )
+//
+// Only the H[0] * X[n] product needs the newest block. The products of the
+// older blocks (k >= 1) are accumulated for the next output block during
+// the PART_SIZE samples that follow, a few partitions per sample, so the
+// CPU load is spread evenly instead of peaking on block boundaries.
+//
+// Impulse responses are stored in the QSPI flash as BIN files of 32 bit float
+// samples at SAMPLING_RATE (see LoadIRFile).
+//
+// The spectra buffers are provided by the caller (SDRAM for long IRs):
+//     IR spectra : getBufferSize(MaxPartitions) floats
+//     FDL        : getBufferSize(MaxPartitions) floats
+//**********************************************************************************
+
+template<uint32_t PART_SIZE>
+class cConvolver {
+public:
+    static_assert(((PART_SIZE & (PART_SIZE - 1)) == 0) &&
+                  ((2 * PART_SIZE) >= FFT_MIN_SIZE) && ((2 * PART_SIZE) <= FFT_MAX_SIZE),
+                  "PART_SIZE must be a power of 2 between FFT_MIN_SIZE/2 and FFT_MAX_SIZE/2");
+
+    static constexpr uint32_t FFT_SIZE = 2 * PART_SIZE;
+
+    // -----------------------------------------------------------------------------
+    // Floats needed by a spectra buffer of NbPartitions partitions
+    static constexpr uint32_t getBufferSize(uint32_t NbPartitions) {
+        return NbPartitions * FFT_SIZE;
+    }
+
+    // =============================================================================
+    // Initialization
+    // =============================================================================
+
+    // -----------------------------------------------------------------------------
+    // Initializes the engine with its spectra buffers
+    void Initialize(float* pIRSpectra, float* pFDL, uint32_t MaxPartitions) {
+        m_FFT.Initialize(FFT_SIZE);
+        m_pIRSpectra = pIRSpectra;
+        m_pFDL = pFDL;
+        m_MaxPartitions = MaxPartitions;
+        m_NbPartitions = 0;
+        Reset();
+    }
+
+    // -----------------------------------------------------------------------------
+    // Clears the signal history (the impulse response is kept)
+    void Reset() {
+        for (uint32_t i = 0; i < getBufferSize(m_MaxPartitions); i++) m_pFDL[i] = 0.0f;
+        for (uint32_t i = 0; i < FFT_SIZE; i++) {
+            m_Input[i] = 0.0f;
+            m_Tail[i] = 0.0f;
+        }
+        for (uint32_t i = 0; i < PART_SIZE; i++) m_Output[i] = 0.0f;
+        m_Position = 0;
+        m_Head = 0;
+        m_NextTail = 1;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Loads an impulse response (truncated to MaxPartitions * PART_SIZE samples)
+    // The samples are read partition by partition: pIR can point to flash
+    // Must not run concurrently with Process (load before activating the effect)
+    void LoadIR(const float* pIR, uint32_t Length, float Gain = 1.0f) {
+        uint32_t NbPartitions = (Length + PART_SIZE - 1) / PART_SIZE;
+        if (NbPartitions > m_MaxPartitions) NbPartitions = m_MaxPartitions;
+
+        float Frame[FFT_SIZE];
+        for (uint32_t p = 0; p < NbPartitions; p++) {
+            for (uint32_t i = 0; i < PART_SIZE; i++) {
+                uint32_t Index = p * PART_SIZE + i;
+                Frame[i] = (Index < Length) ? pIR[Index] * Gain : 0.0f;
+                Frame[PART_SIZE + i] = 0.0f;                    // Zero padding
+            }
+            m_FFT.Forward(Frame, &m_pIRSpectra[p * FFT_SIZE]);
+        }
+        m_NbPartitions = NbPartitions;
+        m_PartsPerSample = (NbPartitions > 1) ?
+                           (NbPartitions - 1 + PART_SIZE - 1) / PART_SIZE : 0;
+        Reset();
+    }
+
+    // -----------------------------------------------------------------------------
+    // Loads an impulse response file from the flash storage
+    // The file holds raw 32 bit float samples; returns false if not found
+    bool LoadIRFile(const char* pFileName, float Gain = 1.0f) {
+        const float* pIR = reinterpret_cast<const float*>(__FlasherStorage.GetFilePtr(pFileName));
+        uint32_t Size = __FlasherStorage.GetFileSize(pFileName);
+        if ((pIR == nullptr) || (Size < sizeof(float)) ||
+            (__FlasherStorage.GetFileType(pFileName) != DadPersistentStorage::FILE_TYPE_BIN)) {
+            return false;
+        }
+        LoadIR(pIR, Size / sizeof(float), Gain);
+        return true;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Removes the impulse response (output is silent)
+    void UnloadIR() {
+        m_NbPartitions = 0;
+        Reset();
+    }
+
+    // -----------------------------------------------------------------------------
+    // Getters
+    inline uint32_t getNbPartitions() const { return m_NbPartitions; }
+    inline uint32_t getLatency() const { return PART_SIZE; }
+
+    // =============================================================================
+    // Processing
+    // =============================================================================
+
+    // -----------------------------------------------------------------------------
+    // Processes one sample (output delayed by PART_SIZE samples)
+    inline float Process(float In) {
+        // Spread the accumulation of the older partitions
+        if (m_NextTail < m_NbPartitions) {
+            AccumulateTail(m_PartsPerSample);
+        }
+
+        float Out = m_Output[m_Position];
+        m_Input[PART_SIZE + m_Position] = In;
+        if (++m_Position == PART_SIZE) {
+            ProcessPartition();
+            m_Position = 0;
+        }
+        return Out;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Processes a block of samples (pIn and pOut may be the same)
+    void ProcessBlock(const float* pIn, float* pOut, uint32_t Size) {
+        for (uint32_t i = 0; i < Size; i++) {
+            pOut[i] = Process(pIn[i]);
+        }
+    }
+
+#ifdef MONITOR
+    // -----------------------------------------------------------------------------
+    // Measures the cost of the loaded IR on NbBlocks audio blocks of noise
+    // Returns the average and worst DWT cycles per AUDIO_BUFFER_SIZE samples
+    // (reported against IR length by the SysEx BENCH command; the output
+    // itself is checked against a direct convolution in Tests/TestConvolver)
+    void Benchmark(uint32_t NbBlocks, uint32_t& AverageCycles, uint32_t& MaxCycles) {
+        uint32_t Seed = 22222;
+        uint32_t Total = 0;
+        float    Block[AUDIO_BUFFER_SIZE];
+        MaxCycles = 0;
+
+        for (uint32_t b = 0; b < NbBlocks; b++) {
+            for (uint32_t i = 0; i < AUDIO_BUFFER_SIZE; i++) {
+                Seed = Seed * 1664525UL + 1013904223UL;                 // LCG white noise
+                Block[i] = static_cast<float>(static_cast<int32_t>(Seed)) * (1.0f / 2147483648.0f);
+            }
+            uint32_t Start = DWT->CYCCNT;
+            ProcessBlock(Block, Block, AUDIO_BUFFER_SIZE);
+            uint32_t Cycles = DWT->CYCCNT - Start;
+            Total += Cycles;
+            if (Cycles > MaxCycles) MaxCycles = Cycles;
+        }
+        AverageCycles = (NbBlocks != 0) ? (Total / NbBlocks) : 0;
+        Reset();
+    }
+#endif
+
+protected:
+    // -----------------------------------------------------------------------------
+    // Complex multiply-accumulate of two packed spectra: Acc += A * B
+    static inline void MultiplyAccumulate(float* pAcc, const float* pA, const float* pB) {
+        pAcc[0] += pA[0] * pB[0];                               // DC (real)
+        pAcc[1] += pA[1] * pB[1];                               // Nyquist (real)
+        for (uint32_t i = 2; i < FFT_SIZE; i += 2) {
+            float aR = pA[i], aI = pA[i + 1];
+            float bR = pB[i], bI = pB[i + 1];
+            pAcc[i]     += aR * bR - aI * bI;
+            pAcc[i + 1] += aR * bI + aI * bR;
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+    // Adds NbParts older partitions to the accumulator of the next block
+    // Next block n+1 needs H[k] * X[n+1-k], the FDL head holds X[n]
+    inline void AccumulateTail(uint32_t NbParts) {
+        while ((NbParts-- > 0) && (m_NextTail < m_NbPartitions)) {
+            uint32_t Slot = (m_Head + m_NbPartitions + 1 - m_NextTail) % m_NbPartitions;
+            MultiplyAccumulate(m_Tail, &m_pIRSpectra[m_NextTail * FFT_SIZE], &m_pFDL[Slot * FFT_SIZE]);
+            m_NextTail++;
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+    // Block boundary: transform the new input block and compute the output
+    void ProcessPartition() {
+        if (m_NbPartitions == 0) {
+            for (uint32_t i = 0; i < PART_SIZE; i++) m_Output[i] = 0.0f;
+            return;
+        }
+
+        // Finish the older partitions if the spreading did not (IR just loaded)
+        AccumulateTail(m_NbPartitions);
+
+        // New spectrum in the FDL (the FFT input is scratch: work on a copy)
+        m_Head = (m_Head + 1) % m_NbPartitions;
+        float* pX = &m_pFDL[m_Head * FFT_SIZE];
+        float Frame[FFT_SIZE];
+        for (uint32_t i = 0; i < FFT_SIZE; i++) Frame[i] = m_Input[i];
+        m_FFT.Forward(Frame, pX);
+
+        // Y = tail + H[0] * X[n]
+        MultiplyAccumulate(m_Tail, m_pIRSpectra, pX);
+        m_FFT.Inverse(m_Tail, Frame);
+
+        // Overlap-save: keep the last half
+        for (uint32_t i = 0; i < PART_SIZE; i++) {
+            m_Output[i] = Frame[PART_SIZE + i];
+            m_Input[i] = m_Input[PART_SIZE + i];            // Slide the input window
+        }
+
+        // Start the next accumulation
+        for (uint32_t i = 0; i < FFT_SIZE; i++) m_Tail[i] = 0.0f;
+        m_NextTail = 1;
+    }
+
+    // =============================================================================
+    // Member variables
+    // =============================================================================
+
+    cRealFFT  m_FFT;                        // FFT of 2 * PART_SIZE points
+    float*    m_pIRSpectra = nullptr;       // Impulse response partition spectra
+    float*    m_pFDL = nullptr;             // Input spectra (frequency domain delay line)
+    uint32_t  m_MaxPartitions = 0;          // Capacity of the spectra buffers
+    uint32_t  m_NbPartitions = 0;           // Partitions of the loaded IR
+    uint32_t  m_PartsPerSample = 0;         // Older partitions accumulated per sample
+    uint32_t  m_Head = 0;                   // FDL slot of the newest spectrum
+    uint32_t  m_NextTail = 1;               // Next older partition to accumulate
+    uint32_t  m_Position = 0;               // Sample position inside the block
+
+    float     m_Input[FFT_SIZE];            // Previous block + block being filled
+    float     m_Tail[FFT_SIZE];             // Spectrum accumulator of the next block
+    float     m_Output[PART_SIZE];          // Output block being played
+};
+
+} // namespace DadDSP
+
+//***End of file**************************************************************
@@ -47,6 +47,20 @@ public:
         m_dcoStep = frequency / m_sampleRate;    // Calculate phase increment
     }
 
+    // -----------------------------------------------------------------------------
+    // Locks the oscillator on an external phase (MIDI clock)
+    // The step follows the reference and the phase error is absorbed by
+    // a small relative speed change (at most +/-correction/2), so the output
+    // never jumps
+    inline void syncToPhase(float targetPhase, float step, float correction = 0.1f) {
+        // Phase error wrapped to [-0.5, 0.5)
+        float error = targetPhase - m_dcoValue;
+        if (error >= 0.5f) error -= 1.0f;
+        else if (error < -0.5f) error += 1.0f;
+
+        m_dcoStep = step * (1.0f + (error * correction));
+    }
+
     // -----------------------------------------------------------------------------
     // Sets the duty cycle of the DCO between 0 and 1
     inline void setNormalizedDutyCycle(float dutyCycle) {
@@ -116,7 +130,8 @@ public:
     // Reads the phase-shifted triangle wave output value
     inline float getTriangleValuePhased(float phaseShift) {
         // Apply phase shift and wrap to [0, 1)
-        float t = fmod(m_dcoValue + phaseShift, 1.0f);
+        float t = m_dcoValue + phaseShift;
+        t -= static_cast<float>(static_cast<int32_t>(t));   // Keep the fraction (no fmod)
         if (t < 0.0f) t += 1.0f;
 
         // Create symmetrical triangle waveform
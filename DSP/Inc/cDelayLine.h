@@ -34,6 +34,9 @@ public:
 
     // -----------------------------------------------------------------------------
     // Clears the FIFO buffer
+    // The buffer memory is not written: samples older than the last clear are
+    // read as zero until they are overwritten (constant time, even for the long
+    // SDRAM lines)
     void Clear();
 
     // -----------------------------------------------------------------------------
@@ -56,6 +59,7 @@ private:
     float*  m_Buffer = nullptr;       // Pointer to allocated memory buffer
     int32_t m_NumElements = 0;        // Number of elements in the buffer
     int32_t m_CurrentIndex = 0;       // Current index (zero delay position)
+    int32_t m_Filled = 0;             // Samples pushed since the last clear (saturated to m_NumElements)
 };
 
 } // namespace DadDSP
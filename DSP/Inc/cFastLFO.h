@@ -1,7 +1,7 @@
 //==================================================================================
 //==================================================================================
 // File: cFastLFO.h
-// Description: Fast LFO implementation using sine LUT (Look-Up Table)
+// Description: Fast LFO implementation using the shared sine LUT (Look-Up Table)
 //
 // Copyright (c) 2026 Dad Design.
 //==================================================================================
@@ -9,8 +9,8 @@
 
 #pragma once
 #include "main.h"
+#include "cLFOBank.h"
 #include <cmath>
-#include <array>
 
 namespace DadDSP {
 
@@ -18,10 +18,10 @@ namespace DadDSP {
 //**********************************************************************************
 // Class: cFastLFO
 // Description: Fast LFO implementation using sine LUT with linear interpolation
+// Single oscillator version of cLFOBank, reading the same cLFOTable
 //**********************************************************************************
 //**********************************************************************************
 
-template<size_t TABLE_SIZE = 1024>
 class cFastLFO
 {
 public:
@@ -44,7 +44,7 @@ public:
         m_frequency = frequency;       // LFO frequency in Hz
         m_phase = initialPhase;        // Initial phase (0.0 to 1.0)
 
-        initTable();
+        cLFOTable::Initialize();
         updatePhaseIncrement();
 
         // Normalize initial phase between 0 and 1
@@ -100,6 +100,22 @@ public:
         return m_phase * 2.0f * M_PI;  // Convert normalized phase to radians
     }
 
+    // -----------------------------------------------------------------------------
+    // Locks the LFO on an external phase (MIDI clock)
+    // The increment follows the reference and the phase error is absorbed by
+    // a small relative speed change (at most +/-correction/2), so the output
+    // never jumps
+    inline void syncToPhase(float targetPhase, float phaseIncrement, float correction = 0.1f)
+    {
+        // Phase error wrapped to [-0.5, 0.5)
+        float error = targetPhase - m_phase;
+        if (error >= 0.5f) error -= 1.0f;
+        else if (error < -0.5f) error += 1.0f;
+
+        m_phaseIncrement = phaseIncrement * (1.0f + (error * correction));
+        m_frequency = phaseIncrement * m_sampleRate;
+    }
+
     // -----------------------------------------------------------------------------
     // Sets the sample rate
     inline void setSampleRate(float sr)
@@ -112,17 +128,8 @@ public:
     // Process method - called for each sample (with linear interpolation)
     inline float process()
     {
-        // Calculate table index
-        float tableIndex = m_phase * TABLE_SIZE;
-        size_t index = static_cast<size_t>(tableIndex);
-
-        // Linear interpolation for better quality
-        float frac = tableIndex - index;                   // Fractional part
-        size_t nextIndex = (index + 1) % TABLE_SIZE;       // Next index (wrapped)
-
-        // Interpolated sample
-        float sample = m_sineTable[index] * (1.0f - frac) +
-                       m_sineTable[nextIndex] * frac;
+        // Interpolated sample from the shared table
+        float sample = cLFOTable::Sine(cLFOTable::toPhase(m_phase));
 
         // Advance phase
         m_phase += m_phaseIncrement;
@@ -139,8 +146,7 @@ public:
     inline float processFast()
     {
         // Direct table lookup (no interpolation)
-        size_t index = static_cast<size_t>(m_phase * TABLE_SIZE) % TABLE_SIZE;
-        float sample = m_sineTable[index];
+        float sample = cLFOTable::SineFast(cLFOTable::toPhase(m_phase));
 
         // Advance phase
         m_phase += m_phaseIncrement;
@@ -160,30 +166,9 @@ public:
     }
 
 private:
-    // =============================================================================
-    // Static constants
-    // =============================================================================
-
-    // (Static members initialized at end of file)
-
     // =============================================================================
     // Private methods
-    // -----------------------------------------------------------------------------
-
-    // -----------------------------------------------------------------------------
-    // Initializes the sine table if not already done
-    static void initTable()
-    {
-        if (!m_tableInitialized)
-        {
-            // Generate sine table
-            for (size_t i = 0; i < TABLE_SIZE; ++i)
-            {
-                m_sineTable[i] = std::sin(2.0f * M_PI * i / TABLE_SIZE);
-            }
-            m_tableInitialized = true;    // Mark table as initialized
-        }
-    }
+    // =============================================================================
 
     // -----------------------------------------------------------------------------
     // Recalculates phase increment based on frequency
@@ -197,27 +182,13 @@ private:
     // Private member variables
     // =============================================================================
 
-    // Static sine table shared by all instances
-    static std::array<float, TABLE_SIZE> m_sineTable;
-    static bool m_tableInitialized;
-
-    // Instance variables
+    // Instance variables (the sine table is cLFOTable, shared with cLFOBank)
     float m_sampleRate;               // Audio sample rate in Hz
     float m_frequency;                // LFO frequency in Hz
     float m_phase;                    // Current phase (0.0 to 1.0)
     float m_phaseIncrement;           // Phase increment per sample
 };
 
-// =============================================================================
-// Static member initialization
-// =============================================================================
-
-template<size_t TABLE_SIZE>
-std::array<float, TABLE_SIZE> cFastLFO<TABLE_SIZE>::m_sineTable;
-
-template<size_t TABLE_SIZE>
-bool cFastLFO<TABLE_SIZE>::m_tableInitialized = false;
-
 } // namespace DadDSP
 
 //***End of file**************************************************************
@@ -0,0 +1,148 @@
+//==================================================================================
+//==================================================================================
+// File: cIdleManager.h
+// Description: Tail aware idle detection of an effect
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#pragma once
+
+#include "main.h"
+#include "Denormals.h"
+#include <cstdint>
+#include <cmath>
+
+namespace DadDSP {
+
+//**********************************************************************************
+// Constants
+//**********************************************************************************
+
+constexpr uint32_t IDLE_BLOCK_SIZE   = 32;          // Detector block (0.67 ms at 48 kHz)
+constexpr float    IDLE_THRESHOLD    = 1.0e-6f;     // -120 dBFS
+constexpr float    IDLE_DEFAULT_HOLD = 0.100f;      // Default hold time in seconds
+
+//**********************************************************************************
+// Class: cIdleManager
+// Description: Decides when an effect can stop processing
+//
+// The effect goes idle when, for the whole hold time, its input was silent
+// (Silence flag or peak under IDLE_THRESHOLD) and its output stayed under
+// IDLE_THRESHOLD. The hold time must cover the longest silent gap of the
+// effect tail (e.g. the maximum delay time), otherwise a tail made of
+// separated echoes would be cut between two echoes.
+// While idle, the output is zero and processing is skipped; the first input
+// sample over the threshold wakes the effect up. The internal state left in
+// the effect is under -120 dBFS and is not cleared.
+//
+// Cost while active: one peak update per sample, one test per block.
+//**********************************************************************************
+class cIdleManager {
+public:
+    // -----------------------------------------------------------------------------
+    // Initializes the detector (active state)
+    void Initialize(float SampleRate, float HoldTime = IDLE_DEFAULT_HOLD) {
+        m_SampleRate = SampleRate;
+        setHoldTime(HoldTime);
+        Reset();
+    }
+
+    // -----------------------------------------------------------------------------
+    // Sets the hold time in seconds
+    void setHoldTime(float HoldTime) {
+        m_HoldBlocks = static_cast<uint32_t>(HoldTime * m_SampleRate / IDLE_BLOCK_SIZE) + 1;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Back to the active state
+    void Reset() {
+        m_Idle = false;
+        m_Peak = 0.0f;
+        m_Count = 0;
+        m_SilentBlocks = 0;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Returns true while the effect is idle
+    inline bool isIdle() const { return m_Idle; }
+
+    // -----------------------------------------------------------------------------
+    // Idle state: returns true when the input wakes the effect up
+    inline bool WakeUp(const AudioBuffer* pIn, bool Silence) {
+        if (!Silence && (fabsf(pIn->Left) > IDLE_THRESHOLD || fabsf(pIn->Right) > IDLE_THRESHOLD)) {
+            Reset();
+            return true;
+        }
+        return false;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Active state: feeds the detector with one input/output sample
+    inline void Track(const AudioBuffer* pIn, const AudioBuffer* pOut, bool Silence) {
+        float a = fabsf(pOut->Left);
+        float b = fabsf(pOut->Right);
+        if (b > a) a = b;
+        if (!Silence) {
+            b = fabsf(pIn->Left);
+            if (b > a) a = b;
+            b = fabsf(pIn->Right);
+            if (b > a) a = b;
+        }
+        if (a > m_Peak) m_Peak = a;
+
+        if (++m_Count == IDLE_BLOCK_SIZE) {
+            UpdateBlock();
+        }
+    }
+
+#ifdef MONITOR
+    // -----------------------------------------------------------------------------
+    // FTZ state seen by the audio interrupt (checked on the first block)
+    inline bool isFlushToZeroChecked() const { return m_FTZChecked; }
+    inline bool isFlushToZeroActive() const { return m_FTZActive; }
+#endif
+
+protected:
+    // -----------------------------------------------------------------------------
+    // Block decision
+    void UpdateBlock() {
+        m_Count = 0;
+        if (m_Peak < IDLE_THRESHOLD) {
+            if (++m_SilentBlocks >= m_HoldBlocks) {
+                m_Idle = true;
+            }
+        } else {
+            m_SilentBlocks = 0;
+        }
+        m_Peak = 0.0f;
+
+#ifdef MONITOR
+        if (!m_FTZChecked) {
+            m_FTZActive = DadDSP::isFlushToZeroActive();
+            m_FTZChecked = true;
+        }
+#endif
+    }
+
+    // =============================================================================
+    // Member variables
+    // =============================================================================
+
+    float    m_SampleRate = SAMPLING_RATE;  // Sampling rate in Hz
+    uint32_t m_HoldBlocks = 0;              // Silent blocks before going idle
+    uint32_t m_SilentBlocks = 0;            // Consecutive silent blocks
+    uint32_t m_Count = 0;                   // Sample position inside the block
+    float    m_Peak = 0.0f;                 // Peak of the current block
+    bool     m_Idle = false;                // Processing skipped
+
+#ifdef MONITOR
+    bool     m_FTZChecked = false;
+    bool     m_FTZActive = false;
+#endif
+};
+
+} // namespace DadDSP
+
+//***End of file**************************************************************
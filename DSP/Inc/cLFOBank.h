@@ -0,0 +1,206 @@
+//==================================================================================
+//==================================================================================
+// File: cLFOBank.h
+// Description: Bank of low frequency oscillators advanced in a single pass
+//              Fixed point phase accumulators and a shared sine table
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#pragma once
+#include "main.h"
+#include <cstddef>
+
+namespace DadDSP {
+
+// =============================================================================
+// Configuration Constants
+// =============================================================================
+
+constexpr uint32_t LFO_TABLE_BITS  = 11;                            // log2 of the table size
+constexpr uint32_t LFO_TABLE_SIZE  = 1UL << LFO_TABLE_BITS;         // Sine table size (2048)
+constexpr uint32_t LFO_FRAC_BITS   = 32 - LFO_TABLE_BITS;           // Phase bits below the index
+constexpr uint32_t LFO_FRAC_MASK   = (1UL << LFO_FRAC_BITS) - 1;    // Fractional part mask
+constexpr float    LFO_PHASE_SCALE = 4294967296.0f;                 // 2^32 (one full cycle)
+constexpr float    LFO_FRAC_SCALE  = 1.0f / static_cast<float>(1UL << LFO_FRAC_BITS);
+
+//**********************************************************************************
+// Class: cLFOTable
+// Description: Sine table shared by every LFO of the firmware
+//
+// One period of sin(2*PI*x), LFO_TABLE_SIZE points plus a guard point so that
+// the interpolation never wraps. Phases are 32 bit fixed point: the upper
+// LFO_TABLE_BITS bits index the table, the lower bits are the fraction.
+//**********************************************************************************
+
+class cLFOTable
+{
+public:
+    // -----------------------------------------------------------------------------
+    // Builds the table (only once, later calls return immediately)
+    static void Initialize();
+
+    // -----------------------------------------------------------------------------
+    // Interpolated sine [-1, 1] of a fixed point phase
+    static inline float Sine(uint32_t Phase) {
+        uint32_t Index = Phase >> LFO_FRAC_BITS;
+        float    Frac  = static_cast<float>(Phase & LFO_FRAC_MASK) * LFO_FRAC_SCALE;
+        float    S0    = m_SineTable[Index];
+        return S0 + Frac * (m_SineTable[Index + 1] - S0);
+    }
+
+    // -----------------------------------------------------------------------------
+    // Nearest point sine [-1, 1] of a fixed point phase (no interpolation)
+    static inline float SineFast(uint32_t Phase) {
+        return m_SineTable[Phase >> LFO_FRAC_BITS];
+    }
+
+    // -----------------------------------------------------------------------------
+    // Conversion of a normalized phase [0, 1) to fixed point
+    static inline uint32_t toPhase(float Phase) {
+        Phase -= static_cast<float>(static_cast<int32_t>(Phase));      // Keep the fraction
+        if (Phase < 0.0f) Phase += 1.0f;
+        return static_cast<uint32_t>(static_cast<uint64_t>(Phase * LFO_PHASE_SCALE));
+    }
+
+    // -----------------------------------------------------------------------------
+    // Conversion of a fixed point phase to a normalized phase [0, 1)
+    static inline float toNormalized(uint32_t Phase) {
+        return static_cast<float>(Phase) * (1.0f / LFO_PHASE_SCALE);
+    }
+
+private:
+    static float m_SineTable[LFO_TABLE_SIZE + 1];   // Sine period + guard point
+    static bool  m_Initialized;                     // Table built
+};
+
+//**********************************************************************************
+// Class: cLFOBank
+// Description: NB_LANES oscillators stored as parallel arrays
+//
+// Step() advances every phase accumulator and refreshes every sine output in
+// one loop over contiguous arrays. Phases wrap for free on the 32 bit
+// overflow, so the loop has no branch and is unrolled/pipelined by the
+// compiler. Each lane is then read with no further computation.
+//**********************************************************************************
+
+template<size_t NB_LANES>
+class cLFOBank
+{
+public:
+    // =============================================================================
+    // Initialization
+    // =============================================================================
+
+    // -----------------------------------------------------------------------------
+    // Initializes the bank, every lane stopped at phase 0
+    void Initialize(float SampleRate) {
+        cLFOTable::Initialize();
+        m_IncScale = LFO_PHASE_SCALE / SampleRate;
+        for (size_t Lane = 0; Lane < NB_LANES; Lane++) {
+            m_Phase[Lane] = 0;
+            m_Increment[Lane] = 0;
+            m_Sine[Lane] = 0.0f;
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+    // Configures one lane with its frequency (Hz) and initial phase [0, 1)
+    void setLane(size_t Lane, float Frequency, float Phase) {
+        setFrequency(Lane, Frequency);
+        setPhase(Lane, Phase);
+    }
+
+    // =============================================================================
+    // Lane control
+    // =============================================================================
+
+    // -----------------------------------------------------------------------------
+    // Sets the frequency of a lane in Hz
+    inline void setFrequency(size_t Lane, float Frequency) {
+        m_Increment[Lane] = static_cast<uint32_t>(static_cast<uint64_t>(Frequency * m_IncScale));
+    }
+
+    // -----------------------------------------------------------------------------
+    // Gets the frequency of a lane in Hz
+    inline float getFrequency(size_t Lane) const {
+        return static_cast<float>(m_Increment[Lane]) / m_IncScale;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Sets the phase of a lane [0, 1)
+    inline void setPhase(size_t Lane, float Phase) {
+        m_Phase[Lane] = cLFOTable::toPhase(Phase);
+        m_Sine[Lane] = cLFOTable::Sine(m_Phase[Lane]);
+    }
+
+    // -----------------------------------------------------------------------------
+    // Gets the phase of a lane [0, 1)
+    inline float getPhase(size_t Lane) const {
+        return cLFOTable::toNormalized(m_Phase[Lane]);
+    }
+
+    // =============================================================================
+    // Processing
+    // =============================================================================
+
+    // -----------------------------------------------------------------------------
+    // Advances every lane by one sample and refreshes the sine outputs
+    inline void Step() {
+        for (size_t Lane = 0; Lane < NB_LANES; Lane++) {
+            uint32_t Phase = m_Phase[Lane] + m_Increment[Lane];    // Wraps at 2^32
+            m_Phase[Lane] = Phase;
+            m_Sine[Lane] = cLFOTable::Sine(Phase);
+        }
+    }
+
+    // =============================================================================
+    // Outputs
+    // =============================================================================
+
+    // -----------------------------------------------------------------------------
+    // Interpolated sine [-1, 1] computed by the last Step()
+    inline float getSine(size_t Lane) const {
+        return m_Sine[Lane];
+    }
+
+    // -----------------------------------------------------------------------------
+    // All sine outputs as one contiguous array
+    inline const float* getSines() const {
+        return m_Sine;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Nearest point sine [-1, 1]: only changes when the table index changes
+    inline float getSineFast(size_t Lane) const {
+        return cLFOTable::SineFast(m_Phase[Lane]);
+    }
+
+    // -----------------------------------------------------------------------------
+    // Triangle [0, 1] (0 at phase 0, 1 at phase 0.5)
+    inline float getTriangle(size_t Lane) const {
+        uint32_t Phase = m_Phase[Lane];
+        uint32_t Folded = (Phase & 0x80000000UL) ? ~Phase : Phase;  // Mirror the second half
+        return static_cast<float>(Folded) * (2.0f / LFO_PHASE_SCALE);
+    }
+
+    // -----------------------------------------------------------------------------
+    // Square [0, 1] (1 on the first half of the period)
+    inline float getSquare(size_t Lane) const {
+        return (m_Phase[Lane] & 0x80000000UL) ? 0.0f : 1.0f;
+    }
+
+private:
+    // =============================================================================
+    // Member variables
+    // =============================================================================
+    uint32_t m_Phase[NB_LANES];             // Fixed point phases
+    uint32_t m_Increment[NB_LANES];         // Fixed point increments per sample
+    float    m_Sine[NB_LANES];              // Sine outputs of the last Step()
+    float    m_IncScale = 0.0f;             // Hz to increment factor (2^32 / Fs)
+};
+
+} // namespace DadDSP
+
+//***End of file**************************************************************
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "main.h"
+#include <cmath>
 
 namespace DadDSP {
 
@@ -19,10 +20,22 @@ namespace DadDSP {
 
 // Forward declaration
 class cParameter;
+class cParameterScheduler;
 
 // Define the callback function type
 using CallbackType = void(*)(cParameter*, uint32_t);
 
+// MIDI values closer than this interval (seconds) form a sweep: the value ramps
+// from one to the next over the measured interval
+constexpr float PARAM_MIDI_SWEEP_INTERVAL = 0.100f;
+
+// Smoothing curve applied between the current and the target value
+enum class eSmoothCurve : uint8_t {
+    Linear,         // Constant step per Process call (default)
+    OnePole,        // Exponential approach (fast start, soft landing)
+    Exponential     // Constant ratio per Process call (frequencies, gains), needs Min > 0 and Max > 0
+};
+
 class cParameter {
 public:
     virtual ~cParameter() {}
@@ -34,7 +47,8 @@ public:
               CallbackType Callback = nullptr,
               uint32_t CallbackUserData = 0,
               float Slope = 0,
-              uint8_t Control = 0xFF);
+              uint8_t Control = 0xFF,
+              bool RTControl = false);
 
     // -----------------------------------------------------------------------------
     // Increment the parameter value by a number of steps
@@ -50,6 +64,12 @@ public:
     // Set the parameter value directly with boundary checks
     void setValue(float value);
 
+    // -----------------------------------------------------------------------------
+    // Set the parameter value at a sample offset of the next processed block
+    // (audio context, the target changes at that sample: Process counts the
+    // offset down one call per sample, ProcessBlock splits the block)
+    void setValueAt(float value, uint32_t SampleOffset);
+
     // -----------------------------------------------------------------------------
     // Get the target value of the parameter
     inline float getTargetValue() const {
@@ -125,10 +145,68 @@ public:
     // Return true if the value was updated, false otherwise
     bool Process();
 
+    // -----------------------------------------------------------------------------
+    // Refresh the value over a block of NbSamples Process steps and write each
+    // intermediate value in pRamp (may be nullptr). The callback is called at most
+    // once, at the end of the block.
+    // Return true if the value was updated, false otherwise
+    bool ProcessBlock(float* pRamp, uint32_t NbSamples);
+
+    // -----------------------------------------------------------------------------
+    // Select the smoothing curve and the callback decimation
+    // (callback called every CallbackDecimation steps and when the target is reached)
+    void setSmoothing(eSmoothCurve Curve, uint16_t CallbackDecimation = 1);
+
+    // -----------------------------------------------------------------------------
+    // Return true while the value is moving toward the target
+    // or a sample accurate target is pending
+    inline bool isRamping() const {
+        return (m_Value != m_TargetValue) || m_HasPending;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Rate of the Process calls (steps per second), enables the MIDI sweep
+    // interpolation (0: MIDI values follow the slope)
+    inline void setStepRate(float StepsPerSecond) {
+        m_StepRate = StepsPerSecond;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Control the parameter with a 14-bit controller pair: Msb (0-31) and its
+    // LSB (Msb + 32). Returns false if the LSB is already routed as a Control
+    // Change: the parameter then follows Msb alone (7-bit)
+    // Channel 0-15 or 0xFF for all channels
+    bool addCC14Control(uint8_t Msb, uint8_t Channel = 0xFF);
+
+    // -----------------------------------------------------------------------------
+    // Control the parameter with a NRPN (0-16383), 14-bit data entry
+    // Channel 0-15 or 0xFF for all channels
+    bool addNRPNControl(uint16_t Number, uint8_t Channel = 0xFF);
+
+    // -----------------------------------------------------------------------------
+    // Attach the parameter to the scheduler that processes it while it moves
+    // (set by cParameterScheduler::Register)
+    inline void setScheduler(cParameterScheduler* pScheduler, uint8_t Slot) {
+        m_pScheduler = pScheduler;
+        m_SchedulerSlot = Slot;
+    }
+
     // -----------------------------------------------------------------------------
     // Function call when this CC is received
     static void MIDIControlChangeCallBack(uint8_t control, uint8_t value, uint32_t userData);
 
+    // -----------------------------------------------------------------------------
+    // Function call in the audio block when this CC is received
+    static void MIDIControlChangeRTCallBack(uint8_t control, uint8_t value, uint32_t SampleOffset, uint32_t userData);
+
+    // -----------------------------------------------------------------------------
+    // Function call when a high resolution value (14-bit CC, NRPN) is received
+    static void MIDIHighResCallBack(uint16_t number, uint32_t value, uint32_t userData);
+
+    // -----------------------------------------------------------------------------
+    // Function call in the audio block when a high resolution value is received
+    static void MIDIHighResRTCallBack(uint16_t number, uint32_t value, uint32_t SampleOffset, uint32_t userData);
+
 protected:
     // -----------------------------------------------------------------------------
     // Function calcStepValue
@@ -139,8 +217,37 @@ protected:
         }else{
             m_Step = std::abs(m_Max-m_Min)/ m_Slope;   // Scaled step based on slope
         }
+        calcCurveCoeff();
     }
 
+    // -----------------------------------------------------------------------------
+    // Function calcCurveCoeff
+    // Calculate OnePole / Exponential coefficients from slope and range
+    void calcCurveCoeff();
+
+    // -----------------------------------------------------------------------------
+    // Function Step
+    // Move the value one step toward the target according to the curve
+    void Step();
+
+    // -----------------------------------------------------------------------------
+    // Function ClampValue
+    // Clamp a value to the parameter range (supports inverted ranges)
+    float ClampValue(float value) const;
+
+    // -----------------------------------------------------------------------------
+    // Function setMidiValue
+    // Set the target from a MIDI value scaled to 32 bits. Inside a sweep the
+    // value ramps linearly to the target over the interval between the
+    // reception times (TimeStamp) of consecutive messages
+    void setMidiValue(uint32_t Value32, uint32_t TimeStamp, bool AtOffset, uint32_t SampleOffset);
+
+    // -----------------------------------------------------------------------------
+    // Function Ramp
+    // Step over NbSamples values, writing each one in pRamp (may be nullptr)
+    // Return true if the value was updated
+    bool Ramp(float* pRamp, uint32_t NbSamples);
+
     // =============================================================================
     // Member Variables
     // =============================================================================
@@ -157,6 +264,24 @@ protected:
     uint32_t      m_CallbackUserData;        // User data for callback
     bool          m_Dirty;                   // Dirty flag for change tracking
 
+    eSmoothCurve  m_Curve = eSmoothCurve::Linear; // Smoothing curve
+    float         m_CurveCoeff = 1.0f;       // OnePole coefficient or Exponential ratio
+    uint16_t      m_CallbackDecimation = 1;  // Callback every N steps
+    uint16_t      m_CallbackCounter = 0;     // Steps since last callback
+
+    float         m_PendingTarget = 0.0f;    // Target applied at m_PendingOffset
+    uint32_t      m_PendingOffset = 0;       // Sample offset of the pending target
+    volatile bool m_HasPending = false;      // A sample accurate target is pending
+
+    cParameterScheduler* m_pScheduler = nullptr; // Active-set scheduler (RT parameters)
+    uint8_t       m_SchedulerSlot = 0;       // Slot in the scheduler
+
+    bool          m_RTControl = false;       // MIDI applied in the audio block
+    float         m_StepRate = 0.0f;         // Process calls per second (0: unknown)
+    float         m_MidiStep = 0.0f;         // Sweep step toward the MIDI target (0: slope)
+    float         m_MidiInterval = 0.0f;     // Averaged interval of the sweep messages (s)
+    uint32_t      m_MidiTime = 0;            // Reception time stamp of the last MIDI value (cycles)
+
 };
 
 } // namespace DadDSP
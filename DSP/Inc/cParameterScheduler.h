@@ -0,0 +1,124 @@
+//==================================================================================
+//==================================================================================
+// File: cParameterScheduler.h
+// Description: Active-set scheduler of the parameters smoothed in the audio thread
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#pragma once
+
+#include "main.h"
+#include "cParameter.h"
+
+#ifndef PARAM_SCHEDULER_MAX
+#define PARAM_SCHEDULER_MAX 64          // Capacity of the scheduler (parameters)
+#endif
+
+namespace DadDSP {
+
+constexpr uint32_t PARAM_SCHEDULER_WORDS = (PARAM_SCHEDULER_MAX + 31) / 32;
+static_assert(PARAM_SCHEDULER_MAX <= 256, "Parameter slots are stored on 8 bits");
+
+#ifdef MONITOR
+//**********************************************************************************
+// Benchmark result (see cParameterScheduler::Benchmark), cycles per dispatch
+//**********************************************************************************
+struct sParamSchedBenchmark {
+    float FanOutCycles;         // Process() called on every parameter (previous dispatch)
+    float IdleCycles;           // Scheduler, no parameter moving
+    float OneRampingCycles;     // Scheduler, one parameter moving
+};
+#endif
+
+//**********************************************************************************
+// Class: cParameterScheduler
+// Description: Calls Process() only on the parameters moving toward their target
+//
+// Every registered parameter owns a slot. setValue()/setValueAt() set the
+// pending bit of the slot (any context, interrupts masked for the OR); the
+// audio thread moves the pending slots to a compact active list, processes
+// that list and drops the parameters that reached their target. A parameter
+// woken again after being dropped is re-added on the next dispatch: a target
+// change is never lost.
+//
+// Families follow RTEventTable: family 0 parameters are always processed,
+// the others only when their family is active. A parameter of an inactive
+// family stays in the active list and moves once its family is active again.
+//
+// Idle cost: one test of the pending words per dispatch.
+//**********************************************************************************
+class cParameterScheduler {
+public:
+    // -----------------------------------------------------------------------------
+    // Constructor
+    cParameterScheduler() { Clear(); }
+
+    // -----------------------------------------------------------------------------
+    // Removes all parameters
+    void Clear();
+
+    // -----------------------------------------------------------------------------
+    // Registers a parameter (initialization, main thread)
+    // Returns false if the scheduler is full
+    bool Register(cParameter* pParameter, uint32_t Family = 0);
+
+    // -----------------------------------------------------------------------------
+    // Families
+    inline void SetActiveFamily(uint32_t Family) { m_ActiveFamily = Family; }
+    inline uint32_t GetActiveFamily() const { return m_ActiveFamily; }
+    bool SetParameterFamily(cParameter* pParameter, uint32_t NewFamily);
+    bool MoveFamily(uint32_t OldFamily, uint32_t NewFamily);
+
+    // -----------------------------------------------------------------------------
+    // Marks a parameter as moving (any context)
+    inline void Wake(uint8_t Slot) {
+        uint32_t Primask = __get_PRIMASK();
+        __disable_irq();
+        m_Pending[Slot >> 5] |= (1UL << (Slot & 31));
+        __set_PRIMASK(Primask);
+    }
+
+    // -----------------------------------------------------------------------------
+    // Audio thread: processes the moving parameters of the active family
+    inline void ProcessActive() { Process(m_ActiveFamily); }
+    void Process(uint32_t Family);
+
+    // -----------------------------------------------------------------------------
+    // Counters
+    inline uint32_t getRegisteredCount() const { return m_NbParameters; }
+    inline uint32_t getActiveCount() const { return m_NbActive; }
+
+#ifdef MONITOR
+    // -----------------------------------------------------------------------------
+    // Measures the dispatch cost of NbParameters parameters on target,
+    // previous fan-out dispatch against the active-set scheduler
+    // (reported by the SysEx BENCH command; the set logic is checked in
+    // Tests/TestParameterScheduler)
+    static sParamSchedBenchmark Benchmark(uint32_t NbParameters);
+#endif
+
+protected:
+    // -----------------------------------------------------------------------------
+    // Moves the pending slots to the active list
+    void CollectPending();
+
+    // =============================================================================
+    // Member variables
+    // =============================================================================
+    cParameter*         m_pParameters[PARAM_SCHEDULER_MAX];  // Registered parameters
+    uint32_t            m_Family[PARAM_SCHEDULER_MAX];       // Family of each slot
+    uint32_t            m_NbParameters = 0;
+
+    uint8_t             m_Active[PARAM_SCHEDULER_MAX];       // Slots of the moving parameters
+    bool                m_InActive[PARAM_SCHEDULER_MAX];     // Slot present in m_Active
+    uint32_t            m_NbActive;
+
+    volatile uint32_t   m_Pending[PARAM_SCHEDULER_WORDS];    // Woken slots, one bit per slot
+    volatile uint32_t   m_ActiveFamily;
+};
+
+} // namespace DadDSP
+
+//***End of file**************************************************************
@@ -0,0 +1,76 @@
+//==================================================================================
+//==================================================================================
+// File: cRealFFT.h
+// Description: Real FFT wrapper
+//              CMSIS-DSP arm_rfft_fast_f32 on target, portable radix-2 on host
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#pragma once
+
+#include "main.h"
+#include <cstdint>
+
+// CMSIS-DSP is used when building for an ARM core, unless FFT_PORTABLE is defined
+#if defined(__ARM_ARCH) && !defined(FFT_PORTABLE)
+#define FFT_USE_CMSIS 1
+#include "arm_math.h"
+#else
+#define FFT_USE_CMSIS 0
+#endif
+
+namespace DadDSP {
+
+constexpr uint32_t FFT_MIN_SIZE = 32;       // Smallest size supported by arm_rfft_fast_f32
+constexpr uint32_t FFT_MAX_SIZE = 4096;     // Largest size supported by arm_rfft_fast_f32
+
+//**********************************************************************************
+// Class: cRealFFT
+// Description: Forward/inverse FFT of a real signal of Size points
+//
+// The spectrum uses the CMSIS packed layout on both implementations:
+//     [Re(0), Re(Size/2), Re(1), Im(1), Re(2), Im(2), ... ]
+// The inverse transform includes the 1/Size scaling.
+// As with CMSIS, the input buffer is used as scratch and is modified.
+//**********************************************************************************
+
+class cRealFFT {
+public:
+    // -----------------------------------------------------------------------------
+    // Initializes the transform (Size: power of 2, FFT_MIN_SIZE..FFT_MAX_SIZE)
+    // Returns false if the size is not supported
+    bool Initialize(uint32_t Size);
+
+    // -----------------------------------------------------------------------------
+    // Time (Size reals) to packed spectrum (Size floats)
+    void Forward(float* pIn, float* pOut);
+
+    // -----------------------------------------------------------------------------
+    // Packed spectrum (Size floats) to time (Size reals)
+    void Inverse(float* pIn, float* pOut);
+
+    // -----------------------------------------------------------------------------
+    // Transform size
+    inline uint32_t getSize() const { return m_Size; }
+
+private:
+    uint32_t m_Size = 0;                        // Number of real points
+
+#if FFT_USE_CMSIS
+    arm_rfft_fast_instance_f32 m_Instance;      // CMSIS instance (shared twiddle tables)
+#else
+    // -----------------------------------------------------------------------------
+    // In place complex radix-2 FFT of Size/2 points (interleaved re/im)
+    void ComplexFFT(float* pData, bool Inverse);
+
+    // Half size complex scratch + real/complex split twiddles
+    float    m_Scratch[FFT_MAX_SIZE];
+    float    m_Twiddle[FFT_MAX_SIZE];
+#endif
+};
+
+} // namespace DadDSP
+
+//***End of file**************************************************************
@@ -0,0 +1,253 @@
+//==================================================================================
+//==================================================================================
+// File: cSaturator.h
+// Description: Oversampled, anti-aliased saturation stage
+//              Polyphase halfband interpolation/decimation (x1, x2, x4)
+//              around a choice of transfer curves
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#pragma once
+
+#include "main.h"
+#include <cstdint>
+#include <cmath>
+
+namespace DadDSP {
+
+//**********************************************************************************
+// Constants and enumerations
+//**********************************************************************************
+
+constexpr uint32_t SAT_HB1_PAIRS = 8;       // Halfband x1 <-> x2: 31 taps (8 non-zero pairs)
+constexpr uint32_t SAT_HB2_PAIRS = 4;       // Halfband x2 <-> x4: 15 taps (4 non-zero pairs)
+constexpr float    SAT_TUBE_BIAS = 0.3f;    // Operating point shift of the tube curve
+constexpr float    SAT_DC_COEFF  = 0.995f;  // DC blocker pole (tube curve)
+constexpr float    SAT_ADAA_EPS  = 1.0e-4f; // ADAA ill-conditioning threshold
+
+// -----------------------------------------------------------------------------
+// Transfer curves
+// -----------------------------------------------------------------------------
+enum class eSatCurve : uint8_t {
+    Tanh = 0,   // Rational tanh approximation, hard limited at |x| = 3
+    Tube,       // Asymmetric curve (biased tanh), even harmonics, DC blocked
+    TanhADAA    // tanh with first order antiderivative anti-aliasing
+};
+
+// -----------------------------------------------------------------------------
+// Oversampling factors
+// -----------------------------------------------------------------------------
+enum class eSatOversampling : uint8_t {
+    x1 = 1,     // Base rate
+    x2 = 2,     // One halfband stage
+    x4 = 4      // Two cascaded halfband stages
+};
+
+//**********************************************************************************
+// Class: cHalfband
+// Description: Polyphase halfband filter pair (x2 interpolator and decimator)
+//
+// A halfband low-pass has h[0] = 0.5 and all other even taps at zero, so only
+// NB_PAIRS symmetric coefficients are used. The interpolator computes the
+// even output as a pure delay and the odd output from the NB_PAIRS
+// coefficients; the decimator filters only the odd phase. Both paths have a
+// latency of NB_PAIRS base rate samples.
+//**********************************************************************************
+
+template<uint32_t NB_PAIRS>
+class cHalfband {
+public:
+    // -----------------------------------------------------------------------------
+    // Computes the coefficients (Blackman windowed sinc) and clears the states
+    void Initialize() {
+        constexpr float Pi = 3.14159265358979f;
+        constexpr float Len = static_cast<float>(4 * NB_PAIRS);     // Window length (taps + 1)
+        float Sum = 0.0f;
+        for (uint32_t j = 0; j < NB_PAIRS; j++) {
+            float n = static_cast<float>(2 * j + 1);                // Odd tap index
+            float Sinc = sinf(Pi * n * 0.5f) / (Pi * n);            // 0.5 * sinc(n / 2)
+            float t = (n + Len * 0.5f) / Len;
+            float Window = 0.42f - 0.5f * cosf(2.0f * Pi * t) + 0.08f * cosf(4.0f * Pi * t);
+            m_Coeffs[j] = Sinc * Window;
+            Sum += m_Coeffs[j];
+        }
+        // Unity DC gain: 0.5 + 2 * sum(c) = 1
+        for (uint32_t j = 0; j < NB_PAIRS; j++) {
+            m_Coeffs[j] *= 0.25f / Sum;
+        }
+        Reset();
+    }
+
+    // -----------------------------------------------------------------------------
+    // Clears the filter states
+    void Reset() {
+        for (uint32_t i = 0; i < 2 * NB_PAIRS; i++) {
+            m_UpHistory[i] = 0.0f;
+            m_DownHistory[i] = 0.0f;
+        }
+        for (uint32_t i = 0; i < NB_PAIRS; i++) {
+            m_DownEven[i] = 0.0f;
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+    // x2 interpolation: one input sample gives two output samples
+    inline void Upsample(float In, float& Out0, float& Out1) {
+        Shift(m_UpHistory, 2 * NB_PAIRS, In);
+        Out0 = m_UpHistory[NB_PAIRS];
+        Out1 = 2.0f * Symmetric(m_UpHistory);
+    }
+
+    // -----------------------------------------------------------------------------
+    // x2 decimation: two input samples give one output sample
+    inline float Downsample(float In0, float In1) {
+        float Out = 0.5f * m_DownEven[NB_PAIRS - 1] + Symmetric(m_DownHistory);
+        Shift(m_DownEven, NB_PAIRS, In0);
+        Shift(m_DownHistory, 2 * NB_PAIRS, In1);
+        return Out;
+    }
+
+private:
+    // -----------------------------------------------------------------------------
+    // Pushes a sample at the head of a short history
+    static inline void Shift(float* pHistory, uint32_t Size, float In) {
+        for (uint32_t i = Size - 1; i > 0; i--) {
+            pHistory[i] = pHistory[i - 1];
+        }
+        pHistory[0] = In;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Symmetric odd phase convolution centered between History[NB_PAIRS - 1]
+    // and History[NB_PAIRS]
+    inline float Symmetric(const float* pHistory) const {
+        float Acc = 0.0f;
+        for (uint32_t j = 0; j < NB_PAIRS; j++) {
+            Acc += m_Coeffs[j] * (pHistory[NB_PAIRS - 1 - j] + pHistory[NB_PAIRS + j]);
+        }
+        return Acc;
+    }
+
+    float m_Coeffs[NB_PAIRS];               // Odd taps h[1], h[3], ...
+    float m_UpHistory[2 * NB_PAIRS];        // Interpolator input history
+    float m_DownHistory[2 * NB_PAIRS];      // Decimator odd phase history
+    float m_DownEven[NB_PAIRS];             // Decimator even phase delay
+};
+
+//**********************************************************************************
+// Class: cSaturator
+// Description: Mono saturation stage with optional oversampling
+//
+// Output = Curve(In * Drive) / Drive, so low levels keep unity gain whatever
+// the drive. The curve runs at Fs * Oversampling; aliasing of the generated
+// harmonics is removed by the halfband decimator before returning to Fs.
+//**********************************************************************************
+
+class cSaturator {
+public:
+    // =============================================================================
+    // Initialization
+    // =============================================================================
+
+    // -----------------------------------------------------------------------------
+    // Initializes the stage with a curve and an oversampling factor
+    void Initialize(eSatCurve Curve, eSatOversampling Oversampling, float Drive = 1.0f);
+
+    // -----------------------------------------------------------------------------
+    // Clears the filter and curve states
+    void Reset();
+
+    // -----------------------------------------------------------------------------
+    // Sets the transfer curve
+    void setCurve(eSatCurve Curve);
+
+    // -----------------------------------------------------------------------------
+    // Sets the oversampling factor (the filters are cleared)
+    void setOversampling(eSatOversampling Oversampling);
+
+    // -----------------------------------------------------------------------------
+    // Sets the input drive (>= 1)
+    inline void setDrive(float Drive) {
+        m_Drive = (Drive < 1.0f) ? 1.0f : Drive;
+        m_InvDrive = 1.0f / m_Drive;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Getters
+    inline eSatCurve getCurve() const { return m_Curve; }
+    inline eSatOversampling getOversampling() const { return m_Oversampling; }
+    inline float getDrive() const { return m_Drive; }
+
+    // -----------------------------------------------------------------------------
+    // Latency in base rate samples introduced by the oversampling filters
+    uint32_t getLatency() const;
+
+    // =============================================================================
+    // Processing
+    // =============================================================================
+
+    // -----------------------------------------------------------------------------
+    // Processes one base rate sample
+    float Process(float In);
+
+    // -----------------------------------------------------------------------------
+    // Processes a block of base rate samples (pIn and pOut may be the same)
+    void ProcessBlock(const float* pIn, float* pOut, uint32_t Size);
+
+#ifdef MONITOR
+    // -----------------------------------------------------------------------------
+    // Average CPU cycles per base rate sample of a configuration on target
+    // (reported for each factor by the SysEx BENCH command; the aliasing is
+    // checked by the host test TestSaturator)
+    static float Benchmark(eSatCurve Curve, eSatOversampling Oversampling, float Drive);
+#endif
+
+protected:
+    // =============================================================================
+    // Transfer curves
+    // =============================================================================
+
+    // -----------------------------------------------------------------------------
+    // Rational tanh approximation (C1 continuous at the |x| = 3 limit)
+    static inline float TanhApprox(float x) {
+        if (x > 3.0f) return 1.0f;
+        if (x < -3.0f) return -1.0f;
+        float x2 = x * x;
+        return x * (27.0f + x2) / (27.0f + 9.0f * x2);
+    }
+
+    // -----------------------------------------------------------------------------
+    // Antiderivative of tanh: log(cosh(x)), overflow free
+    static inline float LogCosh(float x) {
+        float a = fabsf(x);
+        return a + log1pf(expf(-2.0f * a)) - 0.69314718f;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Applies the curve to one (oversampled) sample
+    float Shape(float x);
+
+    // =============================================================================
+    // Member variables
+    // =============================================================================
+
+    eSatCurve        m_Curve = eSatCurve::Tanh;                 // Transfer curve
+    eSatOversampling m_Oversampling = eSatOversampling::x1;     // Oversampling factor
+    float            m_Drive = 1.0f;                            // Input gain
+    float            m_InvDrive = 1.0f;                         // Output compensation
+
+    cHalfband<SAT_HB1_PAIRS> m_Stage1;                          // Fs <-> 2Fs
+    cHalfband<SAT_HB2_PAIRS> m_Stage2;                          // 2Fs <-> 4Fs
+
+    float            m_AdaaX1 = 0.0f;                           // ADAA previous input
+    float            m_AdaaF1 = 0.0f;                           // ADAA previous antiderivative
+    float            m_TubeOffset = 0.0f;                       // Curve value at the bias point
+    float            m_DcX1 = 0.0f;                             // DC blocker previous input
+    float            m_DcY1 = 0.0f;                             // DC blocker previous output
+};
+
+} // namespace DadDSP
+
+//***End of file**************************************************************
@@ -66,6 +66,16 @@ public:
     // Parameters: input - Audio sample to process
     void CalcPeakAndLevel(float input);
 
+    // -----------------------------------------------------------------------------
+    // CalcPeakAndLevelBlock
+    // Description: Block version of CalcPeakAndLevel. Block peak and mean square are
+    //              computed in a branch-free loop, then the envelope, peak hold and
+    //              clip detection are updated once per block.
+    // Parameters: pSamples - First sample of the channel
+    //             NbSamples - Number of samples in the block
+    //             Stride - Distance between two samples (2 for an interleaved AudioBuffer)
+    void CalcPeakAndLevelBlock(const float* pSamples, uint32_t NbSamples, uint32_t Stride = 1);
+
     // -----------------------------------------------------------------------------
     // getLevelPercent
     // Description: Gets current audio level as percentage (0.0 to 1.0)
@@ -90,6 +100,18 @@ public:
     // Returns: Peak level in dB
     float getPeakDB() const { return linearToDb(m_peakLevel); }
 
+    // -----------------------------------------------------------------------------
+    // getRMSPercent
+    // Description: Gets smoothed RMS level (0.0 to 1.0), updated by block processing
+    // Returns: RMS level as linear percentage
+    float getRMSPercent() const { return std::sqrt(m_meanSquare); }
+
+    // -----------------------------------------------------------------------------
+    // getRMSDB
+    // Description: Gets smoothed RMS level in decibels
+    // Returns: RMS level in dB
+    float getRMSDB() const { return linearToDb(getRMSPercent()); }
+
     // -----------------------------------------------------------------------------
     // getLevelPercentDB
     // Description: Gets current level normalized to dB range for display
@@ -132,6 +154,7 @@ public:
     {
         m_currentLevel = 0.0f;
         m_peakLevel = 0.0f;
+        m_meanSquare = 0.0f;
         m_peakHoldCounter = 0;
         m_clipCounter = 0;
         m_clipActive = false;
@@ -144,6 +167,7 @@ public:
     void setSampleRate(float sampleRate)
     {
         m_sampleRate = sampleRate;
+        m_blockSize = 0;
         updateAttackRelease();
     }
 
@@ -172,6 +196,11 @@ protected:
     // Description: Updates attack and release coefficients based on sample rate
     void updateAttackRelease();
 
+    // -----------------------------------------------------------------------------
+    // updateBlockCoeffs
+    // Description: Updates the per block coefficients for a given block size
+    void updateBlockCoeffs(uint32_t NbSamples);
+
     // =============================================================================
     // Member Variables
     // =============================================================================
@@ -187,6 +216,12 @@ protected:
     uint32_t m_clipHoldSamples;    // Clip hold time in samples
     float    m_attackCoeff;        // Attack coefficient for envelope
     float    m_releaseCoeff;       // Release coefficient for envelope
+
+    float    m_meanSquare;         // Smoothed mean square level (block processing)
+    uint32_t m_blockSize;          // Block size of the per block coefficients
+    float    m_blockAttackCoeff;   // Attack coefficient for one block
+    float    m_blockReleaseCoeff;  // Release coefficient for one block
+    float    m_blockPeakDecay;     // Peak decay factor for one block
 };
 
 } // namespace DadDSP
@@ -17,6 +17,19 @@ namespace DadDSP {
 // Description: Handles smooth audio transitions between two sources using equal-power curves
 //**********************************************************************************
 
+// Quarter sine gain table shared by all faders
+float cAudioFader::m_GainTable[FADER_TABLE_SIZE + 2];
+bool  cAudioFader::m_GainTableReady = false;
+
+//--------------------------------------------------------------------------------
+// Interpolated read of the gain table
+//--------------------------------------------------------------------------------
+static inline float ReadGain(const float* pTable, float Pos) {
+    int32_t Index = static_cast<int32_t>(Pos);
+    float   Frac  = Pos - static_cast<float>(Index);
+    return pTable[Index] + Frac * (pTable[Index + 1] - pTable[Index]);
+}
+
 //--------------------------------------------------------------------------------
 // Initializes the audio fader with sample rate and fade duration
 //--------------------------------------------------------------------------------
@@ -27,6 +40,19 @@ void cAudioFader::Initialize(uint32_t sampleRate, float fadeTimeSeconds) {
     m_currentFadeSample = 0;                    // Current fade position
     m_state             = NO_FADE;              // Current fade state
     m_lastState         = FADING_OUT_A;         // Last completed fade state
+    m_tablePos          = 0.0f;                 // Gain table position
+    m_tableStep         = (m_totalFadeSamples > 0) ?
+                          static_cast<float>(FADER_TABLE_SIZE) / static_cast<float>(m_totalFadeSamples) :
+                          static_cast<float>(FADER_TABLE_SIZE);
+
+    // Build the equal-power curve once (sin rising 0 -> 1, cos read backwards)
+    if (!m_GainTableReady) {
+        for (int i = 0; i <= FADER_TABLE_SIZE; i++) {
+            m_GainTable[i] = std::sin((static_cast<float>(i) / FADER_TABLE_SIZE) * static_cast<float>(M_PI_2));
+        }
+        m_GainTable[FADER_TABLE_SIZE + 1] = 1.0f;   // Guard for interpolation at the end
+        m_GainTableReady = true;
+    }
 }
 
 //--------------------------------------------------------------------------------
@@ -34,6 +60,7 @@ void cAudioFader::Initialize(uint32_t sampleRate, float fadeTimeSeconds) {
 //--------------------------------------------------------------------------------
 void cAudioFader::startFadeInB() {
     m_currentFadeSample = 0;    // Reset fade counter
+    m_tablePos = 0.0f;          // Restart the gain curve
     m_state = FADING_IN_B;      // Set state to fading in B
 }
 
@@ -42,6 +69,7 @@ void cAudioFader::startFadeInB() {
 //--------------------------------------------------------------------------------
 void cAudioFader::startFadeOutA() {
     m_currentFadeSample = 0;    // Reset fade counter
+    m_tablePos = 0.0f;          // Restart the gain curve
     m_state = FADING_OUT_A;     // Set state to fading out A
 }
 
@@ -55,25 +83,25 @@ void cAudioFader::Process(float inputA1, float inputA2, float inputB1, float inp
 
     // Handle active fade states
     if (m_state != NO_FADE) {
-        // Calculate fade progress with clamping
-        float progress = static_cast<float>(m_currentFadeSample) / static_cast<float>(m_totalFadeSamples);
-        if (progress < 0) progress = 0;
-        if (progress > 1) progress = 1;
+        // Equal-power gains from the quarter sine table
+        float Rise = ReadGain(m_GainTable, m_tablePos);                     // 0.0 → 1.0
+        float Fall = ReadGain(m_GainTable, FADER_TABLE_SIZE - m_tablePos);  // 1.0 → 0.0
 
-        // Apply equal-power crossfade curves
         if (m_state == FADING_IN_B) {
             // Fade from A to B: A decreases, B increases
-            gainA = std::cos(progress * static_cast<float>(M_PI_2));  // Cosine fade: 1.0 → 0.0
-            gainB = std::sin(progress * static_cast<float>(M_PI_2));  // Sine fade: 0.0 → 1.0
+            gainA = Fall;
+            gainB = Rise;
         }
-        else if (m_state == FADING_OUT_A) {
+        else {
             // Fade from B to A: A increases, B decreases
-            gainA = std::sin(progress * static_cast<float>(M_PI_2));  // Sine fade: 0.0 → 1.0
-            gainB = std::cos(progress * static_cast<float>(M_PI_2));  // Cosine fade: 1.0 → 0.0
+            gainA = Rise;
+            gainB = Fall;
         }
 
         // Update fade position and check for completion
         m_currentFadeSample++;
+        m_tablePos += m_tableStep;
+        if (m_tablePos > FADER_TABLE_SIZE) m_tablePos = FADER_TABLE_SIZE;
         if (m_currentFadeSample >= m_totalFadeSamples) {
             // Fade completed - set final gain values and update state
             if (m_state == FADING_IN_B) {
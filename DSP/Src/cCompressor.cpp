@@ -0,0 +1,167 @@
+//==================================================================================
+//==================================================================================
+// File: cCompressor.cpp
+// Description: Block based dynamics processors implementation
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "cCompressor.h"
+
+namespace DadDSP {
+
+// -----------------------------------------------------------------------------
+// Block rate one pole coefficient for a time constant in seconds
+// -----------------------------------------------------------------------------
+static float BlockCoeff(float Seconds, float SampleRate) {
+    if (Seconds <= 0.0f) return 0.0f;
+    return expf(-static_cast<float>(COMP_BLOCK_SIZE) / (Seconds * SampleRate));
+}
+
+//**********************************************************************************
+// Class: cCompressor
+// Description: Stereo linked feed-forward compressor with a block envelope detector
+//**********************************************************************************
+
+// -----------------------------------------------------------------------------
+// Initializes the compressor (threshold 0 dB, ratio 1:1, no makeup)
+// -----------------------------------------------------------------------------
+void cCompressor::Initialize(float SampleRate) {
+    m_SampleRate = SampleRate;
+    m_ThresholdDb = 0.0f;
+    m_Slope = 0.0f;
+    m_KneeDb = 0.0f;
+    m_MakeupDb = 0.0f;
+    setAttack(0.010f);
+    setRelease(0.150f);
+    Reset();
+}
+
+// -----------------------------------------------------------------------------
+// Clears the detector and sets the gain to its static value
+// -----------------------------------------------------------------------------
+void cCompressor::Reset() {
+    m_Peak = 0.0f;
+    m_EnvDb = 0.0f;
+    m_GainTarget = FastDbToLin(m_MakeupDb);
+    m_Gain = m_GainTarget;
+    m_GainStep = 0.0f;
+}
+
+// -----------------------------------------------------------------------------
+// Sets the attack time constant
+// -----------------------------------------------------------------------------
+void cCompressor::setAttack(float Seconds) {
+    m_AttackCoeff = BlockCoeff(Seconds, m_SampleRate);
+}
+
+// -----------------------------------------------------------------------------
+// Sets the release time constant
+// -----------------------------------------------------------------------------
+void cCompressor::setRelease(float Seconds) {
+    m_ReleaseCoeff = BlockCoeff(Seconds, m_SampleRate);
+}
+
+// -----------------------------------------------------------------------------
+// Static curve: gain reduction in dB (<= 0) for an input level in dB
+// Quadratic interpolation inside the knee
+// -----------------------------------------------------------------------------
+float cCompressor::ComputeReduction(float LevelDb) const {
+    float Over = LevelDb - m_ThresholdDb;
+    float HalfKnee = 0.5f * m_KneeDb;
+
+    if (Over <= -HalfKnee) {
+        return 0.0f;
+    }
+    if (Over >= HalfKnee) {
+        return m_Slope * Over;
+    }
+    float x = Over + HalfKnee;
+    return m_Slope * x * x / (2.0f * m_KneeDb);
+}
+
+// -----------------------------------------------------------------------------
+// Updates the gain ramp from the block peak (once per COMP_BLOCK_SIZE samples)
+// -----------------------------------------------------------------------------
+void cCompressor::UpdateBlock() {
+    float TargetDb = ComputeReduction(FastLinToDb(m_Peak));
+    m_Peak = 0.0f;
+
+    // Attack when the reduction increases, release otherwise
+    float Coeff = (TargetDb < m_EnvDb) ? m_AttackCoeff : m_ReleaseCoeff;
+    m_EnvDb = TargetDb + Coeff * (m_EnvDb - TargetDb);
+
+    // The previous ramp ended on its target: restart from it to avoid drift
+    m_Gain = m_GainTarget;
+    m_GainTarget = FastDbToLin(m_EnvDb + m_MakeupDb);
+    m_GainStep = (m_GainTarget - m_Gain) * (1.0f / COMP_BLOCK_SIZE);
+}
+
+//**********************************************************************************
+// Class: cLimiter
+// Description: Stereo look-ahead brickwall limiter
+//**********************************************************************************
+
+// -----------------------------------------------------------------------------
+// Initializes the limiter (ceiling 0 dBFS)
+// -----------------------------------------------------------------------------
+void cLimiter::Initialize(float SampleRate) {
+    m_SampleRate = SampleRate;
+    m_CeilingDb = 0.0f;
+    setRelease(0.100f);
+    Reset();
+}
+
+// -----------------------------------------------------------------------------
+// Clears the look-ahead buffer and the detector
+// -----------------------------------------------------------------------------
+void cLimiter::Reset() {
+    for (uint32_t i = 0; i < LIMITER_DELAY; i++) {
+        m_DelayLeft[i] = 0.0f;
+        m_DelayRight[i] = 0.0f;
+    }
+    m_Index = 0;
+    m_Count = 0;
+    m_Peak = 0.0f;
+    m_PrevNeedDb = 0.0f;
+    m_EnvDb = 0.0f;
+    m_Gain = 1.0f;
+    m_GainTarget = 1.0f;
+    m_GainStep = 0.0f;
+}
+
+// -----------------------------------------------------------------------------
+// Sets the release time constant
+// -----------------------------------------------------------------------------
+void cLimiter::setRelease(float Seconds) {
+    m_ReleaseCoeff = BlockCoeff(Seconds, m_SampleRate);
+}
+
+// -----------------------------------------------------------------------------
+// Updates the gain ramp from the block peak
+// The ramp played next covers the previous block: it must satisfy both
+// -----------------------------------------------------------------------------
+void cLimiter::UpdateBlock() {
+    float NeedDb = m_CeilingDb - FastLinToDb(m_Peak);
+    if (NeedDb > 0.0f) NeedDb = 0.0f;
+    m_Peak = 0.0f;
+
+    float RequiredDb = (NeedDb < m_PrevNeedDb) ? NeedDb : m_PrevNeedDb;
+    m_PrevNeedDb = NeedDb;
+
+    // Instantaneous attack, release limited by the required reduction
+    if (RequiredDb < m_EnvDb) {
+        m_EnvDb = RequiredDb;
+    } else {
+        m_EnvDb = RequiredDb + m_ReleaseCoeff * (m_EnvDb - RequiredDb);
+    }
+
+    m_Gain = m_GainTarget;
+    m_GainTarget = FastDbToLin(m_EnvDb);
+    m_GainStep = (m_GainTarget - m_Gain) * (1.0f / COMP_BLOCK_SIZE);
+}
+
+} // namespace DadDSP
+
+//***End of file**************************************************************
@@ -9,6 +9,7 @@
 //==================================================================================
 
 #include "cDelayLine.h"
+#include "TCMPlacement.h"
 
 namespace DadDSP {
 
@@ -26,14 +27,14 @@ void cDelayLine::Initialize(float* buffer, uint32_t bufferSize) {
 }
 
 // -----------------------------------------------------------------------------
-// Clears the entire buffer by setting all values to zero
+// Clears the buffer: the samples not pushed since are read as zero
 void cDelayLine::Clear() {
-    memset(m_Buffer, 0, (m_NumElements * sizeof(float))); // Zero out buffer memory
+    m_Filled = 0;
 }
 
 // -----------------------------------------------------------------------------
 // Adds a new sample to the delay line
-void cDelayLine::Push(float inputSample) {
+ITCM_CODE void cDelayLine::Push(float inputSample) {
     if (m_Buffer) {
         // Increment current index with circular buffer wrapping
         m_CurrentIndex++;
@@ -41,14 +42,20 @@ void cDelayLine::Push(float inputSample) {
             m_CurrentIndex = 0; // Wrap around to beginning
 
         m_Buffer[m_CurrentIndex] = inputSample; // Store new sample
+
+        if (m_Filled < m_NumElements)
+            m_Filled++;                         // Valid samples since the last clear
     }
 }
 
 // -----------------------------------------------------------------------------
 // Retrieves a delayed sample without interpolation
-float cDelayLine::Pull(uint32_t delay) {
+ITCM_CODE float cDelayLine::Pull(uint32_t delay) {
     //assert(delay < m_NumElements);
     if (m_Buffer) {
+        if (static_cast<int32_t>(delay) >= m_Filled)
+            return 0.0f;                  // Not pushed since the last clear
+
         // Calculate output index with circular buffer wrapping
         int32_t outputIndex = m_CurrentIndex - delay;
         if (outputIndex < 0)
@@ -61,7 +68,7 @@ float cDelayLine::Pull(uint32_t delay) {
 
 // -----------------------------------------------------------------------------
 // Retrieves a delayed sample with linear interpolation
-float cDelayLine::Pull(float delay) {
+ITCM_CODE float cDelayLine::Pull(float delay) {
     //assert(delay < m_NumElements);
 
     if (m_Buffer) {
@@ -83,9 +90,9 @@ float cDelayLine::Pull(float delay) {
         if (index2 == m_NumElements)
             index2 = 0; // Wrap around to beginning
 
-        // Retrieve the two adjacent samples
-        float sample1 = m_Buffer[index1];
-        float sample2 = m_Buffer[index2];
+        // Retrieve the two adjacent samples (zero if not pushed since the last clear)
+        float sample1 = (delayInt + 1 < m_Filled) ? m_Buffer[index1] : 0.0f;
+        float sample2 = (delayInt < m_Filled) ? m_Buffer[index2] : 0.0f;
 
         // Perform linear interpolation between samples
         float interpolatedValue = sample2 + ((sample1 - sample2) * interpFactor);
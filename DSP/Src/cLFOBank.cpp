@@ -0,0 +1,38 @@
+//==================================================================================
+//==================================================================================
+// File: cLFOBank.cpp
+// Description: Shared sine table of the LFO bank
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "cLFOBank.h"
+#include <cmath>
+
+namespace DadDSP {
+
+//**********************************************************************************
+// Class: cLFOTable
+// Description: Sine table shared by every LFO of the firmware
+//**********************************************************************************
+
+float cLFOTable::m_SineTable[LFO_TABLE_SIZE + 1];
+bool  cLFOTable::m_Initialized = false;
+
+// -----------------------------------------------------------------------------
+// Builds the table (only once, later calls return immediately)
+// -----------------------------------------------------------------------------
+void cLFOTable::Initialize() {
+    if (m_Initialized) return;
+
+    for (uint32_t i = 0; i < LFO_TABLE_SIZE; i++) {
+        m_SineTable[i] = std::sin((2.0f * static_cast<float>(M_PI) * i) / LFO_TABLE_SIZE);
+    }
+    m_SineTable[LFO_TABLE_SIZE] = m_SineTable[0];   // Guard point for interpolation
+    m_Initialized = true;
+}
+
+} // namespace DadDSP
+
+//***End of file**************************************************************
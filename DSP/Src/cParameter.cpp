@@ -9,7 +9,9 @@
 
 #include "Serialize.h"
 #include "cParameter.h"
+#include "cParameterScheduler.h"
 #include <algorithm>  // pour std::abs, std::min, etc.
+#include <cmath>
 #include "cMidi.h"
 
 // *****************************************************************************
@@ -29,7 +31,8 @@ void cParameter::Init(float InitValue, float Min, float Max,
                       float RapidIncrement, float SlowIncrement,
                       CallbackType Callback, uint32_t CallbackUserData,
                       float Slope,
-                      uint8_t Control) {
+                      uint8_t Control,
+                      bool RTControl) {
     m_Min = Min;                                    // Minimum parameter value
     m_Max = Max;                                    // Maximum parameter value
     m_RapidIncrement = RapidIncrement;              // Fast adjustment step size
@@ -44,8 +47,15 @@ void cParameter::Init(float InitValue, float Min, float Max,
     m_Value = m_Min;                                // Initialize value
 
     // Register MIDI control change callback if control specified
+    // (7-bit; see addCC14Control for a 14-bit controller pair)
+    m_RTControl = RTControl;
     if(Control != 0xFF){
-        __Midi.addControlChangeCallback(Control, (uint32_t) this, MIDIControlChangeCallBack );
+        if(RTControl){
+            // Applied in the audio block at the sample offset of the message
+            __Midi.addRTControlChangeCallback(Control, (uint32_t) this, MIDIControlChangeRTCallBack );
+        }else{
+            __Midi.addControlChangeCallback(Control, (uint32_t) this, MIDIControlChangeCallBack );
+        }
     }
 
     // Ensure the initial value is within bounds
@@ -57,57 +67,228 @@ void cParameter::Init(float InitValue, float Min, float Max,
 // -----------------------------------------------------------------------------
 // Set the parameter value directly with boundary checks
 void cParameter::setValue(float value) {
-    // Clamp value to valid range (support inverted ranges)
+    m_MidiStep = 0.0f;                              // Back to the slope
+    m_TargetValue = ClampValue(value);
+    if (m_pScheduler) {
+        __DMB();                                    // Target visible before the wake-up
+        m_pScheduler->Wake(m_SchedulerSlot);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Set the parameter value at a sample offset of the next processed block
+void cParameter::setValueAt(float value, uint32_t SampleOffset) {
+    if (m_HasPending) {
+        m_TargetValue = m_PendingTarget;            // Previous pending target not consumed yet
+    }
+    m_PendingTarget = ClampValue(value);
+    m_PendingOffset = SampleOffset;
+    m_HasPending = true;
+    if (m_pScheduler) {
+        m_pScheduler->Wake(m_SchedulerSlot);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Clamp a value to the parameter range (supports inverted ranges)
+float cParameter::ClampValue(float value) const {
     if(m_Max >= m_Min) {
         if(value > m_Max) {
-            m_TargetValue = m_Max;
+            return m_Max;
         } else if(value < m_Min){
-            m_TargetValue = m_Min;
-        } else {
-            m_TargetValue = value;
+            return m_Min;
         }
     } else {
         if(value > m_Min) {
-            m_TargetValue = m_Min;
+            return m_Min;
         } else if(value < m_Max){
-            m_TargetValue = m_Max;
-        } else {
-            m_TargetValue = value;
+            return m_Max;
         }
     }
+    return value;
 }
 
 // -----------------------------------------------------------------------------
 // Update the current value smoothly according to the slope
 // Return true if the value was updated, false otherwise
 bool cParameter::Process() {
+    // Pending sample accurate target: one Process call per sample, the
+    // target changes at the call of its sample offset
+    if (m_HasPending) {
+        if (m_PendingOffset == 0) {
+            m_TargetValue = m_PendingTarget;
+            m_HasPending = false;
+        } else {
+            m_PendingOffset--;
+        }
+    }
+
     // Check if current value needs to approach target
     if(m_Value != m_TargetValue){
-        // Determine direction
-        bool increasing = (m_TargetValue > m_Value);
-
-        if (increasing)
-        {
-            m_Value += m_Step;                      // Increment toward target
-            if (m_Value > m_TargetValue)
-                m_Value = m_TargetValue;            // Prevent overshoot
-        }
-        else
-        {
-            m_Value -= m_Step;                      // Decrement toward target
-            if (m_Value < m_TargetValue)
-                m_Value = m_TargetValue;            // Prevent overshoot
-        }
+        Step();
 
-        // Trigger callback if value changed and callback is defined
+        // Trigger callback (decimated) if value changed and callback is defined
         if (m_Callback) {
-            m_Callback(this, m_CallbackUserData);
+            if ((++m_CallbackCounter >= m_CallbackDecimation) || (m_Value == m_TargetValue)) {
+                m_CallbackCounter = 0;
+                m_Callback(this, m_CallbackUserData);
+            }
         }
         return true;
     }
     return false;
 }
 
+// -----------------------------------------------------------------------------
+// Refresh the value over a block of Process steps, writing each value in pRamp
+// Return true if the value was updated, false otherwise
+bool cParameter::ProcessBlock(float* pRamp, uint32_t NbSamples) {
+    bool Updated;
+
+    if (m_HasPending) {
+        // Sample accurate target: ramp to the old target up to the offset
+        uint32_t Offset = (m_PendingOffset < NbSamples) ? m_PendingOffset : NbSamples;
+        Updated = Ramp(pRamp, Offset);
+        m_TargetValue = m_PendingTarget;
+        m_HasPending = false;
+        Updated |= Ramp(pRamp ? (pRamp + Offset) : nullptr, NbSamples - Offset);
+    } else {
+        Updated = Ramp(pRamp, NbSamples);
+    }
+
+    // One callback per block (control rate)
+    if (Updated) {
+        m_CallbackCounter = 0;
+        if (m_Callback) {
+            m_Callback(this, m_CallbackUserData);
+        }
+    }
+    return Updated;
+}
+
+// -----------------------------------------------------------------------------
+// Step over NbSamples values, writing each one in pRamp (may be nullptr)
+// Return true if the value was updated
+bool cParameter::Ramp(float* pRamp, uint32_t NbSamples) {
+    if(m_Value == m_TargetValue){
+        if (pRamp) {
+            for (uint32_t Index = 0; Index < NbSamples; Index++) pRamp[Index] = m_Value;
+        }
+        return false;
+    }
+
+    for (uint32_t Index = 0; Index < NbSamples; Index++) {
+        Step();
+        if (pRamp) pRamp[Index] = m_Value;
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Move the value one step toward the target according to the curve
+void cParameter::Step() {
+    // Determine direction
+    bool increasing = (m_TargetValue > m_Value);
+
+    // MIDI sweep: linear step sized on the message interval
+    if (m_MidiStep > 0.0f) {
+        if (increasing) {
+            m_Value += m_MidiStep;
+            if (m_Value > m_TargetValue) m_Value = m_TargetValue;
+        } else {
+            m_Value -= m_MidiStep;
+            if (m_Value < m_TargetValue) m_Value = m_TargetValue;
+        }
+        return;
+    }
+
+    switch (m_Curve) {
+    case eSmoothCurve::OnePole: {
+        float Next = m_Value + (m_TargetValue - m_Value) * m_CurveCoeff;
+        // Snap to target when the remaining distance is negligible against the range,
+        // or when the step is lost in the float resolution (no progress)
+        if ((Next == m_Value) ||
+            (std::abs(m_TargetValue - Next) <= (std::abs(m_Max - m_Min) * 1.0e-6f)))
+            Next = m_TargetValue;
+        m_Value = Next;
+        return;
+    }
+
+    case eSmoothCurve::Exponential:
+        if ((m_CurveCoeff > 1.0f) && (m_Value > 0.0f) && (m_TargetValue > 0.0f)) {
+            float Previous = m_Value;
+            if (increasing) {
+                m_Value *= m_CurveCoeff;            // Constant ratio toward target
+                if (m_Value > m_TargetValue)
+                    m_Value = m_TargetValue;        // Prevent overshoot
+            } else {
+                m_Value /= m_CurveCoeff;
+                if (m_Value < m_TargetValue)
+                    m_Value = m_TargetValue;
+            }
+            if (m_Value == Previous)
+                m_Value = m_TargetValue;            // Ratio lost in the float resolution
+            return;
+        }
+        break;                                      // Not in positive domain: linear step
+
+    default:
+        break;
+    }
+
+    if (increasing)
+    {
+        m_Value += m_Step;                          // Increment toward target
+        if (m_Value > m_TargetValue)
+            m_Value = m_TargetValue;                // Prevent overshoot
+    }
+    else
+    {
+        m_Value -= m_Step;                          // Decrement toward target
+        if (m_Value < m_TargetValue)
+            m_Value = m_TargetValue;                // Prevent overshoot
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Select the smoothing curve and the callback decimation
+void cParameter::setSmoothing(eSmoothCurve Curve, uint16_t CallbackDecimation) {
+    m_Curve = Curve;
+    m_CallbackDecimation = (CallbackDecimation == 0) ? 1 : CallbackDecimation;
+    m_CallbackCounter = 0;
+    calcCurveCoeff();
+}
+
+// -----------------------------------------------------------------------------
+// Calculate OnePole / Exponential coefficients from slope and range
+void cParameter::calcCurveCoeff() {
+    if (m_Slope <= 1.0f) {
+        m_CurveCoeff = (m_Curve == eSmoothCurve::Exponential) ? 1.0e6f : 1.0f; // Immediate
+        return;
+    }
+
+    switch (m_Curve) {
+    case eSmoothCurve::OnePole:
+        // ~99% of a full range move in m_Slope steps
+        m_CurveCoeff = 1.0f - std::exp(-4.6f / m_Slope);
+        break;
+
+    case eSmoothCurve::Exponential:
+        // Full range ratio spread over m_Slope steps
+        if ((m_Min > 0.0f) && (m_Max > 0.0f)) {
+            float Ratio = (m_Max > m_Min) ? (m_Max / m_Min) : (m_Min / m_Max);
+            m_CurveCoeff = std::pow(Ratio, 1.0f / m_Slope);
+        } else {
+            m_CurveCoeff = 1.0f;                    // Unused, falls back to linear
+        }
+        break;
+
+    default:
+        m_CurveCoeff = 1.0f;
+        break;
+    }
+}
+
 // -----------------------------------------------------------------------------
 // Increment the parameter value by a number of steps
 void cParameter::Increment(int32_t nbStep, bool Switch) {
@@ -126,6 +307,63 @@ void cParameter::Increment(int32_t nbStep, bool Switch) {
     setValue(Value);                                // Set new target value
 }
 
+// -----------------------------------------------------------------------------
+// Control the parameter with a 14-bit controller pair (Msb 0-31, LSB Msb + 32)
+// Replaces the 7-bit route of Msb given to Init
+bool cParameter::addCC14Control(uint8_t Msb, uint8_t Channel) {
+    if(Msb >= 32) return false;
+    if(m_RTControl){
+        if(!__Midi.addRTHighResCallback(eMidiHighRes::CC14, Msb, (uint32_t) this, MIDIHighResRTCallBack, Channel)) return false;
+        __Midi.removeRTControlChangeCallback(Msb, (uint32_t) this, MIDIControlChangeRTCallBack);
+    }else{
+        if(!__Midi.addHighResCallback(eMidiHighRes::CC14, Msb, (uint32_t) this, MIDIHighResCallBack, Channel)) return false;
+        __Midi.removeControlChangeCallback(Msb, (uint32_t) this, MIDIControlChangeCallBack);
+    }
+    // Refused if the LSB is assigned to another control: 7-bit only
+    return __Midi.isCC14Paired(Msb);
+}
+
+// -----------------------------------------------------------------------------
+// Control the parameter with a NRPN, 14-bit data entry
+bool cParameter::addNRPNControl(uint16_t Number, uint8_t Channel) {
+    if(m_RTControl){
+        return __Midi.addRTHighResCallback(eMidiHighRes::NRPN, Number, (uint32_t) this, MIDIHighResRTCallBack, Channel);
+    }
+    return __Midi.addHighResCallback(eMidiHighRes::NRPN, Number, (uint32_t) this, MIDIHighResCallBack, Channel);
+}
+
+// -----------------------------------------------------------------------------
+// Set the target from a MIDI value scaled to 32 bits
+void cParameter::setMidiValue(uint32_t Value32, uint32_t TimeStamp, bool AtOffset, uint32_t SampleOffset) {
+    // Convert to parameter range (works with inverted ranges)
+    float Normalized = static_cast<float>(Value32) * (1.0f / 4294967295.0f);
+    float NewVal = m_Min + Normalized * (m_Max - m_Min);
+
+    // Sweep detection: interval since the previous value, from the reception
+    // times (a block dispatches a whole burst at once)
+    float Interval = static_cast<float>(TimeStamp - m_MidiTime) / static_cast<float>(SystemCoreClock);
+    m_MidiTime = TimeStamp;
+
+    float MidiStep = 0.0f;
+    if ((m_StepRate > 0.0f) && (Interval < PARAM_MIDI_SWEEP_INTERVAL)) {
+        // Averaged interval: the ramp ends when the next value is expected
+        m_MidiInterval = (m_MidiInterval == 0.0f) ? Interval : (m_MidiInterval + (Interval - m_MidiInterval) * 0.25f);
+        float Steps = m_MidiInterval * m_StepRate;
+        if (Steps < 1.0f) Steps = 1.0f;
+        MidiStep = std::abs(ClampValue(NewVal) - m_Value) / Steps;
+    } else {
+        m_MidiInterval = 0.0f;                      // Isolated value: slope
+    }
+
+    if (AtOffset) {
+        setValueAt(NewVal, SampleOffset);           // Update parameter value at the sample offset
+    } else {
+        setValue(NewVal);                           // Update parameter value
+    }
+    m_MidiStep = MidiStep;
+    m_Dirty = true;                                 // Mark parameter as changed
+}
+
 // -----------------------------------------------------------------------------
 // Function call when this CC is received
 void cParameter::MIDIControlChangeCallBack(uint8_t control, uint8_t value, uint32_t userData) {
@@ -134,11 +372,32 @@ void cParameter::MIDIControlChangeCallBack(uint8_t control, uint8_t value, uint3
     // Clamp MIDI value to valid range
     value = (value > 127) ? 127 : value;
 
-    // Convert MIDI value to parameter range (works with inverted ranges)
-    float NewVal = pThis->m_Min + (value * (pThis->m_Max - pThis->m_Min)) / 127.0f;
+    pThis->setMidiValue(DadDrivers::cMidiHighResParser::Upscale(value, 7), __Midi.getEventTimeStamp(), false, 0);
+}
 
-    pThis->setValue(NewVal);                        // Update parameter value
-    pThis->m_Dirty = true;                          // Mark parameter as changed
+// -----------------------------------------------------------------------------
+// Function call in the audio block when this CC is received
+void cParameter::MIDIControlChangeRTCallBack(uint8_t control, uint8_t value, uint32_t SampleOffset, uint32_t userData) {
+    cParameter* pThis = reinterpret_cast<cParameter*>(userData);
+
+    // Clamp MIDI value to valid range
+    value = (value > 127) ? 127 : value;
+
+    pThis->setMidiValue(DadDrivers::cMidiHighResParser::Upscale(value, 7), __Midi.getRTEventTimeStamp(), true, SampleOffset);
+}
+
+// -----------------------------------------------------------------------------
+// Function call when a high resolution value (14-bit CC, NRPN) is received
+void cParameter::MIDIHighResCallBack(uint16_t number, uint32_t value, uint32_t userData) {
+    cParameter* pThis = reinterpret_cast<cParameter*>(userData);
+    pThis->setMidiValue(value, __Midi.getEventTimeStamp(), false, 0);
+}
+
+// -----------------------------------------------------------------------------
+// Function call in the audio block when a high resolution value is received
+void cParameter::MIDIHighResRTCallBack(uint16_t number, uint32_t value, uint32_t SampleOffset, uint32_t userData) {
+    cParameter* pThis = reinterpret_cast<cParameter*>(userData);
+    pThis->setMidiValue(value, __Midi.getRTEventTimeStamp(), true, SampleOffset);
 }
 
 } // namespace DadDSP
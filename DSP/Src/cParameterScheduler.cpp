@@ -0,0 +1,192 @@
+//==================================================================================
+//==================================================================================
+// File: cParameterScheduler.cpp
+// Description: Active-set scheduler of the parameters smoothed in the audio thread
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "cParameterScheduler.h"
+#include "TCMPlacement.h"
+
+namespace DadDSP {
+
+//**********************************************************************************
+// class cParameterScheduler
+//**********************************************************************************
+
+// -----------------------------------------------------------------------------
+// Removes all parameters
+void cParameterScheduler::Clear() {
+    for (uint32_t Slot = 0; Slot < m_NbParameters; Slot++) {
+        m_pParameters[Slot]->setScheduler(nullptr, 0);
+    }
+    m_NbParameters = 0;
+    m_NbActive = 0;
+    m_ActiveFamily = 0;
+    for (uint32_t Word = 0; Word < PARAM_SCHEDULER_WORDS; Word++) {
+        m_Pending[Word] = 0;
+    }
+    for (uint32_t Slot = 0; Slot < PARAM_SCHEDULER_MAX; Slot++) {
+        m_InActive[Slot] = false;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Registers a parameter, woken at once (it ramps from its minimum at init)
+bool cParameterScheduler::Register(cParameter* pParameter, uint32_t Family) {
+    if ((pParameter == nullptr) || (m_NbParameters >= PARAM_SCHEDULER_MAX)) {
+        return false;
+    }
+
+    uint8_t Slot = static_cast<uint8_t>(m_NbParameters);
+    m_pParameters[Slot] = pParameter;
+    m_Family[Slot] = Family;
+    __DMB();                        // Slot visible before it can be woken
+    m_NbParameters++;
+
+    pParameter->setScheduler(this, Slot);
+    Wake(Slot);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Changes the family of a parameter
+bool cParameterScheduler::SetParameterFamily(cParameter* pParameter, uint32_t NewFamily) {
+    for (uint32_t Slot = 0; Slot < m_NbParameters; Slot++) {
+        if (m_pParameters[Slot] == pParameter) {
+            m_Family[Slot] = NewFamily;
+            return true;
+        }
+    }
+    return false;
+}
+
+// -----------------------------------------------------------------------------
+// Moves every parameter of a family to another family
+bool cParameterScheduler::MoveFamily(uint32_t OldFamily, uint32_t NewFamily) {
+    bool Found = false;
+    for (uint32_t Slot = 0; Slot < m_NbParameters; Slot++) {
+        if (m_Family[Slot] == OldFamily) {
+            m_Family[Slot] = NewFamily;
+            Found = true;
+        }
+    }
+    return Found;
+}
+
+// -----------------------------------------------------------------------------
+// Moves the pending slots to the active list
+ITCM_CODE void cParameterScheduler::CollectPending() {
+    for (uint32_t Word = 0; Word < PARAM_SCHEDULER_WORDS; Word++) {
+        if (m_Pending[Word] == 0) continue;
+
+        uint32_t Primask = __get_PRIMASK();
+        __disable_irq();
+        uint32_t Bits = m_Pending[Word];
+        m_Pending[Word] = 0;
+        __set_PRIMASK(Primask);
+
+        while (Bits != 0) {
+            uint32_t Slot = (Word << 5) + static_cast<uint32_t>(__builtin_ctz(Bits));
+            Bits &= Bits - 1;
+            if (!m_InActive[Slot]) {
+                m_InActive[Slot] = true;
+                m_Active[m_NbActive++] = static_cast<uint8_t>(Slot);
+            }
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Processes the moving parameters of a family (and of family 0)
+ITCM_CODE void cParameterScheduler::Process(uint32_t Family) {
+    CollectPending();
+
+    uint32_t Index = 0;
+    while (Index < m_NbActive) {
+        uint8_t Slot = m_Active[Index];
+        uint32_t SlotFamily = m_Family[Slot];
+        if ((SlotFamily != 0) && (SlotFamily != Family)) {
+            Index++;                                // Waits for its family
+            continue;
+        }
+
+        cParameter* pParameter = m_pParameters[Slot];
+        pParameter->Process();
+        if (pParameter->isRamping()) {
+            Index++;
+        } else {
+            // Target reached: swap with the last entry
+            m_InActive[Slot] = false;
+            m_Active[Index] = m_Active[--m_NbActive];
+        }
+    }
+}
+
+#ifdef MONITOR
+// -----------------------------------------------------------------------------
+// Benchmark
+// -----------------------------------------------------------------------------
+constexpr uint32_t PARAM_BENCH_DISPATCH = 4800;     // 100 ms of samples at 48 kHz
+
+// -----------------------------------------------------------------------------
+// Measures the dispatch cost of NbParameters parameters on target
+// The parameters are private to the benchmark: the running patch is not
+// touched. The fan-out loop calls Process() on every parameter as the
+// per-sample RT_Process event did (without the member function call).
+// -----------------------------------------------------------------------------
+sParamSchedBenchmark cParameterScheduler::Benchmark(uint32_t NbParameters) {
+    static cParameter Parameters[PARAM_SCHEDULER_MAX];
+    static cParameterScheduler Scheduler;
+
+    if (NbParameters > PARAM_SCHEDULER_MAX) NbParameters = PARAM_SCHEDULER_MAX;
+
+    Scheduler.Clear();
+    for (uint32_t i = 0; i < NbParameters; i++) {
+        // Slope of one benchmark run: the ramping parameter never settles
+        Parameters[i].Init(0.0f, 0.0f, 1.0f, 0.1f, 0.01f, nullptr, 0,
+                           static_cast<float>(PARAM_BENCH_DISPATCH * 4));
+        Parameters[i].setValue(0.0f);
+        Scheduler.Register(&Parameters[i]);
+    }
+    Scheduler.Process(0);                   // Settles the registration wake-ups
+
+    sParamSchedBenchmark Result;
+    uint32_t Start;
+    volatile uint32_t Sink = 0;
+
+    // Previous dispatch: every parameter, every sample
+    Start = DWT->CYCCNT;
+    for (uint32_t n = 0; n < PARAM_BENCH_DISPATCH; n++) {
+        for (uint32_t i = 0; i < NbParameters; i++) {
+            Sink += Parameters[i].Process();
+        }
+    }
+    Result.FanOutCycles = static_cast<float>(DWT->CYCCNT - Start) / PARAM_BENCH_DISPATCH;
+
+    // Scheduler, idle patch
+    Start = DWT->CYCCNT;
+    for (uint32_t n = 0; n < PARAM_BENCH_DISPATCH; n++) {
+        Scheduler.Process(0);
+    }
+    Result.IdleCycles = static_cast<float>(DWT->CYCCNT - Start) / PARAM_BENCH_DISPATCH;
+
+    // Scheduler, one parameter moving
+    if (NbParameters > 0) Parameters[0].setValue(1.0f);
+    Start = DWT->CYCCNT;
+    for (uint32_t n = 0; n < PARAM_BENCH_DISPATCH; n++) {
+        Scheduler.Process(0);
+    }
+    Result.OneRampingCycles = static_cast<float>(DWT->CYCCNT - Start) / PARAM_BENCH_DISPATCH;
+
+    Scheduler.Clear();
+    (void)Sink;
+    return Result;
+}
+#endif
+
+} // namespace DadDSP
+
+//***End of file**************************************************************
@@ -0,0 +1,191 @@
+//==================================================================================
+//==================================================================================
+// File: cRealFFT.cpp
+// Description: Real FFT wrapper implementation
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "cRealFFT.h"
+#include <cmath>
+#include <cstring>
+
+namespace DadDSP {
+
+//**********************************************************************************
+// Class: cRealFFT
+// Description: Forward/inverse FFT of a real signal of Size points
+//**********************************************************************************
+
+#if FFT_USE_CMSIS
+
+// =============================================================================
+// CMSIS-DSP implementation
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+// Initializes the transform
+// -----------------------------------------------------------------------------
+bool cRealFFT::Initialize(uint32_t Size) {
+    if (arm_rfft_fast_init_f32(&m_Instance, static_cast<uint16_t>(Size)) != ARM_MATH_SUCCESS) {
+        m_Size = 0;
+        return false;
+    }
+    m_Size = Size;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Time to packed spectrum
+// -----------------------------------------------------------------------------
+void cRealFFT::Forward(float* pIn, float* pOut) {
+    arm_rfft_fast_f32(&m_Instance, pIn, pOut, 0);
+}
+
+// -----------------------------------------------------------------------------
+// Packed spectrum to time
+// -----------------------------------------------------------------------------
+void cRealFFT::Inverse(float* pIn, float* pOut) {
+    arm_rfft_fast_f32(&m_Instance, pIn, pOut, 1);
+}
+
+#else
+
+// =============================================================================
+// Portable implementation
+// A real FFT of N points is a complex FFT of N/2 points on (even + i*odd)
+// followed by a split step
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+// Initializes the transform
+// -----------------------------------------------------------------------------
+bool cRealFFT::Initialize(uint32_t Size) {
+    if ((Size < FFT_MIN_SIZE) || (Size > FFT_MAX_SIZE) || ((Size & (Size - 1)) != 0)) {
+        m_Size = 0;
+        return false;
+    }
+    m_Size = Size;
+
+    // W^k = exp(-2*PI*i*k/N), stored as (cos, sin) of 2*PI*k/N, k < N/2
+    for (uint32_t k = 0; k < (Size / 2); k++) {
+        double Angle = (2.0 * M_PI * k) / Size;
+        m_Twiddle[2 * k] = static_cast<float>(cos(Angle));
+        m_Twiddle[2 * k + 1] = static_cast<float>(sin(Angle));
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Time to packed spectrum
+// -----------------------------------------------------------------------------
+void cRealFFT::Forward(float* pIn, float* pOut) {
+    const uint32_t M = m_Size / 2;
+    float* Z = m_Scratch;
+
+    memcpy(Z, pIn, m_Size * sizeof(float));     // z[n] = x[2n] + i*x[2n+1]
+    ComplexFFT(Z, false);
+
+    // DC and Nyquist are real
+    pOut[0] = Z[0] + Z[1];
+    pOut[1] = Z[0] - Z[1];
+
+    for (uint32_t k = 1; k < M; k++) {
+        float ZkR = Z[2 * k],       ZkI = Z[2 * k + 1];
+        float ZmR = Z[2 * (M - k)], ZmI = -Z[2 * (M - k) + 1];     // conj(Z[M-k])
+
+        float FeR = 0.5f * (ZkR + ZmR), FeI = 0.5f * (ZkI + ZmI);
+        float DR  = 0.5f * (ZkR - ZmR), DI  = 0.5f * (ZkI - ZmI);
+        float FoR = DI, FoI = -DR;                                  // D / i
+
+        float c = m_Twiddle[2 * k], s = m_Twiddle[2 * k + 1];       // W^k = c - i*s
+        pOut[2 * k]     = FeR + (FoR * c + FoI * s);
+        pOut[2 * k + 1] = FeI + (FoI * c - FoR * s);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Packed spectrum to time
+// -----------------------------------------------------------------------------
+void cRealFFT::Inverse(float* pIn, float* pOut) {
+    const uint32_t M = m_Size / 2;
+    float* Z = m_Scratch;
+
+    // k = 0: X[0] and X[M] are real
+    float X0 = pIn[0], XM = pIn[1];
+    Z[0] = 0.5f * (X0 + XM);
+    Z[1] = 0.5f * (X0 - XM);
+
+    for (uint32_t k = 1; k < M; k++) {
+        float XkR = pIn[2 * k],       XkI = pIn[2 * k + 1];
+        float XmR = pIn[2 * (M - k)], XmI = -pIn[2 * (M - k) + 1]; // conj(X[M-k])
+
+        float FeR = 0.5f * (XkR + XmR), FeI = 0.5f * (XkI + XmI);
+        float DR  = 0.5f * (XkR - XmR), DI  = 0.5f * (XkI - XmI);
+
+        float c = m_Twiddle[2 * k], s = m_Twiddle[2 * k + 1];       // W^-k = c + i*s
+        float FoR = DR * c - DI * s;
+        float FoI = DR * s + DI * c;
+
+        Z[2 * k]     = FeR - FoI;                                   // Fe + i*Fo
+        Z[2 * k + 1] = FeI + FoR;
+    }
+
+    ComplexFFT(Z, true);
+    memcpy(pOut, Z, m_Size * sizeof(float));
+}
+
+// -----------------------------------------------------------------------------
+// In place complex radix-2 FFT of Size/2 points (interleaved re/im)
+// The inverse transform is scaled by 2/Size
+// -----------------------------------------------------------------------------
+void cRealFFT::ComplexFFT(float* pData, bool Inverse) {
+    const uint32_t M = m_Size / 2;
+
+    // Bit reversal permutation
+    for (uint32_t i = 1, j = 0; i < M; i++) {
+        uint32_t Bit = M >> 1;
+        for (; j & Bit; Bit >>= 1) j ^= Bit;
+        j ^= Bit;
+        if (i < j) {
+            float t;
+            t = pData[2 * i];     pData[2 * i] = pData[2 * j];         pData[2 * j] = t;
+            t = pData[2 * i + 1]; pData[2 * i + 1] = pData[2 * j + 1]; pData[2 * j + 1] = t;
+        }
+    }
+
+    // Butterflies; the twiddles of an M point FFT are W_N^(2j)
+    for (uint32_t Len = 2; Len <= M; Len <<= 1) {
+        uint32_t Stride = (M / Len) * 2;                // Twiddle index step in W_N
+        for (uint32_t Start = 0; Start < M; Start += Len) {
+            for (uint32_t j = 0; j < (Len / 2); j++) {
+                float c = m_Twiddle[2 * (j * Stride)];
+                float s = m_Twiddle[2 * (j * Stride) + 1];
+                if (!Inverse) s = -s;                   // exp(-i*a) forward, exp(+i*a) inverse
+
+                uint32_t a = 2 * (Start + j);
+                uint32_t b = 2 * (Start + j + Len / 2);
+                float tR = pData[b] * c - pData[b + 1] * s;
+                float tI = pData[b] * s + pData[b + 1] * c;
+                pData[b]     = pData[a] - tR;
+                pData[b + 1] = pData[a + 1] - tI;
+                pData[a]     += tR;
+                pData[a + 1] += tI;
+            }
+        }
+    }
+
+    if (Inverse) {
+        float Scale = 1.0f / M;
+        for (uint32_t i = 0; i < m_Size; i++) {
+            pData[i] *= Scale;
+        }
+    }
+}
+
+#endif
+
+} // namespace DadDSP
+
+//***End of file**************************************************************
@@ -0,0 +1,210 @@
+//==================================================================================
+//==================================================================================
+// File: cSaturator.cpp
+// Description: Oversampled, anti-aliased saturation stage implementation
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "cSaturator.h"
+
+namespace DadDSP {
+
+//**********************************************************************************
+// Class: cSaturator
+// Description: Mono saturation stage with optional oversampling
+//**********************************************************************************
+
+// =============================================================================
+// Initialization
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+// Initializes the stage with a curve and an oversampling factor
+// -----------------------------------------------------------------------------
+void cSaturator::Initialize(eSatCurve Curve, eSatOversampling Oversampling, float Drive) {
+    m_Stage1.Initialize();
+    m_Stage2.Initialize();
+    m_Oversampling = Oversampling;
+    setDrive(Drive);
+    setCurve(Curve);
+}
+
+// -----------------------------------------------------------------------------
+// Clears the filter and curve states
+// -----------------------------------------------------------------------------
+void cSaturator::Reset() {
+    m_Stage1.Reset();
+    m_Stage2.Reset();
+    m_AdaaX1 = 0.0f;
+    m_AdaaF1 = LogCosh(0.0f);
+    m_DcX1 = 0.0f;
+    m_DcY1 = 0.0f;
+}
+
+// -----------------------------------------------------------------------------
+// Sets the transfer curve
+// -----------------------------------------------------------------------------
+void cSaturator::setCurve(eSatCurve Curve) {
+    m_Curve = Curve;
+    m_TubeOffset = TanhApprox(SAT_TUBE_BIAS);
+    Reset();
+}
+
+// -----------------------------------------------------------------------------
+// Sets the oversampling factor (the filters are cleared)
+// -----------------------------------------------------------------------------
+void cSaturator::setOversampling(eSatOversampling Oversampling) {
+    if (Oversampling != m_Oversampling) {
+        m_Oversampling = Oversampling;
+        Reset();
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Latency in base rate samples introduced by the oversampling filters
+// -----------------------------------------------------------------------------
+uint32_t cSaturator::getLatency() const {
+    switch (m_Oversampling) {
+        case eSatOversampling::x2:
+            return 2 * SAT_HB1_PAIRS;
+        case eSatOversampling::x4:
+            return 2 * SAT_HB1_PAIRS + SAT_HB2_PAIRS;     // Stage 2 runs at 2Fs
+        default:
+            return 0;
+    }
+}
+
+// =============================================================================
+// Processing
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+// Processes one base rate sample
+// -----------------------------------------------------------------------------
+float cSaturator::Process(float In) {
+    float x = In * m_Drive;
+    float y;
+
+    switch (m_Oversampling) {
+        case eSatOversampling::x2: {
+            float a, b;
+            m_Stage1.Upsample(x, a, b);
+            a = Shape(a);                   // Shape() has state (ADAA): keep the time order
+            b = Shape(b);
+            y = m_Stage1.Downsample(a, b);
+            break;
+        }
+        case eSatOversampling::x4: {
+            float a, b, a0, a1, b0, b1;
+            m_Stage1.Upsample(x, a, b);
+            m_Stage2.Upsample(a, a0, a1);
+            m_Stage2.Upsample(b, b0, b1);
+            a0 = Shape(a0);                 // Shape() has state (ADAA): keep the time order
+            a1 = Shape(a1);
+            b0 = Shape(b0);
+            b1 = Shape(b1);
+            a = m_Stage2.Downsample(a0, a1);
+            b = m_Stage2.Downsample(b0, b1);
+            y = m_Stage1.Downsample(a, b);
+            break;
+        }
+        default:
+            y = Shape(x);
+            break;
+    }
+
+    // The tube curve generates DC: one pole DC blocker at base rate
+    if (m_Curve == eSatCurve::Tube) {
+        float Out = y - m_DcX1 + SAT_DC_COEFF * m_DcY1;
+        m_DcX1 = y;
+        m_DcY1 = Out;
+        y = Out;
+    }
+
+    return y * m_InvDrive;
+}
+
+// -----------------------------------------------------------------------------
+// Processes a block of base rate samples (pIn and pOut may be the same)
+// -----------------------------------------------------------------------------
+void cSaturator::ProcessBlock(const float* pIn, float* pOut, uint32_t Size) {
+    for (uint32_t i = 0; i < Size; i++) {
+        pOut[i] = Process(pIn[i]);
+    }
+}
+
+// =============================================================================
+// Transfer curves
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+// Applies the curve to one (oversampled) sample
+// -----------------------------------------------------------------------------
+float cSaturator::Shape(float x) {
+    switch (m_Curve) {
+        case eSatCurve::Tube:
+            // Shifting the operating point makes the clipping asymmetric
+            return TanhApprox(x + SAT_TUBE_BIAS) - m_TubeOffset;
+
+        case eSatCurve::TanhADAA: {
+            // y = (F(x) - F(x1)) / (x - x1), F = log(cosh)
+            float F = LogCosh(x);
+            float dx = x - m_AdaaX1;
+            float y;
+            if (fabsf(dx) < SAT_ADAA_EPS) {
+                y = tanhf(0.5f * (x + m_AdaaX1));     // Ill-conditioned: midpoint value
+            } else {
+                y = (F - m_AdaaF1) / dx;
+            }
+            m_AdaaX1 = x;
+            m_AdaaF1 = F;
+            return y;
+        }
+
+        default:
+            return TanhApprox(x);
+    }
+}
+
+#ifdef MONITOR
+// =============================================================================
+// Benchmark
+// =============================================================================
+
+constexpr uint32_t SAT_BENCH_SAMPLES = 9600;        // 200 ms at 48 kHz
+constexpr uint32_t SAT_BENCH_BLOCK   = 48;          // Timed block size
+constexpr float    SAT_BENCH_FREQ    = 5250.0f;     // Test tone
+
+// -----------------------------------------------------------------------------
+// Average CPU cycles per base rate sample of a configuration on target
+// -----------------------------------------------------------------------------
+float cSaturator::Benchmark(eSatCurve Curve, eSatOversampling Oversampling, float Drive) {
+    constexpr float Fs = static_cast<float>(SAMPLING_RATE);
+    constexpr float TwoPi = 6.28318530717959f;
+
+    static cSaturator Saturator;
+    Saturator.Initialize(Curve, Oversampling, Drive);
+
+    float In[SAT_BENCH_BLOCK];
+    float Out[SAT_BENCH_BLOCK];
+    uint32_t Cycles = 0;
+
+    for (uint32_t Block = 0; Block < (SAT_BENCH_SAMPLES / SAT_BENCH_BLOCK); Block++) {
+        for (uint32_t i = 0; i < SAT_BENCH_BLOCK; i++) {
+            In[i] = 0.5f * sinf(TwoPi * SAT_BENCH_FREQ * static_cast<float>(Block * SAT_BENCH_BLOCK + i) / Fs);
+        }
+
+        uint32_t Start = DWT->CYCCNT;
+        Saturator.ProcessBlock(In, Out, SAT_BENCH_BLOCK);
+        Cycles += DWT->CYCCNT - Start;
+    }
+
+    return static_cast<float>(Cycles) / SAT_BENCH_SAMPLES;
+}
+#endif
+
+} // namespace DadDSP
+
+//***End of file**************************************************************
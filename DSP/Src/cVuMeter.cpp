@@ -61,6 +61,68 @@ void cVuMeter::CalcPeakAndLevel(float input)
     }
 }
 
+// -----------------------------------------------------------------------------
+// CalcPeakAndLevelBlock
+// Description: Block version of CalcPeakAndLevel
+// Parameters: pSamples - First sample of the channel
+//             NbSamples - Number of samples in the block
+//             Stride - Distance between two samples
+// -----------------------------------------------------------------------------
+void cVuMeter::CalcPeakAndLevelBlock(const float* pSamples, uint32_t NbSamples, uint32_t Stride)
+{
+    if (NbSamples == 0) return;
+    if (NbSamples != m_blockSize) updateBlockCoeffs(NbSamples);
+
+    // Block peak and sum of squares, two independent accumulators (no branch)
+    float Peak0 = 0.0f, Peak1 = 0.0f;
+    float Sum0 = 0.0f, Sum1 = 0.0f;
+    uint32_t Index = 0;
+    for (; Index + 1 < NbSamples; Index += 2) {
+        const float x0 = pSamples[0];
+        const float x1 = pSamples[Stride];
+        Peak0 = std::fmax(Peak0, std::fabs(x0));
+        Peak1 = std::fmax(Peak1, std::fabs(x1));
+        Sum0 += x0 * x0;
+        Sum1 += x1 * x1;
+        pSamples += 2 * Stride;
+    }
+    if (Index < NbSamples) {
+        const float x0 = pSamples[0];
+        Peak0 = std::fmax(Peak0, std::fabs(x0));
+        Sum0 += x0 * x0;
+    }
+    const float BlockPeak = std::fmin(std::fmax(Peak0, Peak1), 1.0f);
+    const float BlockMeanSquare = (Sum0 + Sum1) / static_cast<float>(NbSamples);
+
+    // Attack/release envelope, one step per block
+    const float Coeff = (BlockPeak > m_currentLevel) ? m_blockAttackCoeff : m_blockReleaseCoeff;
+    m_currentLevel += (BlockPeak - m_currentLevel) * Coeff;
+    m_meanSquare += (BlockMeanSquare - m_meanSquare) * m_blockReleaseCoeff;
+
+    // Peak detection with hold time algorithm
+    if (m_currentLevel > m_peakLevel) {
+        m_peakLevel = m_currentLevel;
+        m_peakHoldCounter = m_peakHoldSamples;
+    } else if (m_peakHoldCounter > NbSamples) {
+        m_peakHoldCounter -= NbSamples;
+    } else if (m_peakHoldCounter > 0) {
+        m_peakHoldCounter = 0;
+    } else {
+        m_peakLevel *= m_blockPeakDecay;
+    }
+
+    // Clipping detection with hold time
+    if (m_currentLevel >= CLIP_THRESHOLD) {
+        m_clipActive = true;
+        m_clipCounter = m_clipHoldSamples;
+    } else if (m_clipCounter > NbSamples) {
+        m_clipCounter -= NbSamples;
+    } else if (m_clipCounter > 0) {
+        m_clipCounter = 0;
+        m_clipActive = false;
+    }
+}
+
 // =============================================================================
 // Conversion Utilities
 // =============================================================================
@@ -113,6 +175,20 @@ void cVuMeter::updateAttackRelease()
     m_releaseCoeff = 1.0f - std::exp(-1.0f / (RELEASE_TIME * m_sampleRate));
 }
 
+// -----------------------------------------------------------------------------
+// updateBlockCoeffs
+// Description: Updates the per block coefficients so that one block step
+//              matches NbSamples per sample steps
+// -----------------------------------------------------------------------------
+void cVuMeter::updateBlockCoeffs(uint32_t NbSamples)
+{
+    const float n = static_cast<float>(NbSamples);
+    m_blockSize = NbSamples;
+    m_blockAttackCoeff = 1.0f - std::pow(1.0f - m_attackCoeff, n);
+    m_blockReleaseCoeff = 1.0f - std::pow(1.0f - m_releaseCoeff, n);
+    m_blockPeakDecay = std::pow(0.999f, n);
+}
+
 } // namespace DadDSP
 
 //***End of file**************************************************************
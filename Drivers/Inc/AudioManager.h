@@ -33,8 +33,25 @@ struct AudioBuffer {
 
 // -----------------------------------------------------------------------------
 // Initialize and start audio processing
+// After PrestartAudio, only enables AudioCallback (SAI already running)
 // -----------------------------------------------------------------------------
 extern HAL_StatusTypeDef StartAudio(SAI_HandleTypeDef *phSaiTx, SAI_HandleTypeDef *phSaiRx);
 
+// -----------------------------------------------------------------------------
+// Start the SAI DMA early in the boot, silence out, AudioCallback not called
+// until StartAudio (the effect and the GUI initialize meanwhile)
+// -----------------------------------------------------------------------------
+extern HAL_StatusTypeDef PrestartAudio(SAI_HandleTypeDef *phSaiTx, SAI_HandleTypeDef *phSaiRx);
+
+#ifdef MONITOR
+// -----------------------------------------------------------------------------
+// On-target probes (SysEx BENCH): AudioCallback no longer called from the SAI
+// interrupt (silence out) until ResumeAudio, and AudioCallback timed from the
+// main loop meanwhile (cycles per block)
+// -----------------------------------------------------------------------------
+extern void SuspendAudio();
+extern void ResumeAudio();
+extern void ProbeAudioCallback(uint32_t NbBlocks, uint32_t& Average, uint32_t& Max);
+#endif
 
 //***End of file**************************************************************
@@ -160,61 +160,89 @@ union ResetRegister {
 //****************************************************************************
 // cWM8731
 //
+// Initialize configures the codec with blocking writes (10 ms apart).
+// StartInitialize sends the same sequence in the background, one write per
+// I2C interrupt, so the boot goes on (GUI, presets) while the codec is set up:
+//
+//     __Codec.StartInitialize(&hi2c1);      // I2C event / error IRQs enabled
+//     PrestartAudio(&hsai_BlockA1, &hsai_BlockB1);
+//     __GUI.Initialize(); ...               // Codec and SAI start meanwhile
+//     while (!__Codec.isReady()) {}
+//     StartAudio(&hsai_BlockA1, &hsai_BlockB1);
+//
+#define WM8731_NB_WRITES 12
+
 class cWM8731 {
 public:
 	cWM8731(){};
 	HAL_StatusTypeDef Initialize(I2C_HandleTypeDef *phi2c){
 		m_phi2c = phi2c;
-		HAL_StatusTypeDef Result;
+		HAL_StatusTypeDef Result = HAL_OK;
+
+		BuildSequence();
+		for(uint8_t Index = 0; Index < WM8731_NB_WRITES; Index++){
+		    if( HAL_OK != (Result = WriteReg(m_Sequence[Index].Reg, m_Sequence[Index].Data))){
+		    	return Result;
+		    }
+		}
+	    m_State = eState::Ready;
+	    return Result;
+	}
+
+	// Start the register sequence in the background (I2C interrupt)
+	HAL_StatusTypeDef StartInitialize(I2C_HandleTypeDef *phi2c);
+
+	// Sequence state
+	inline bool isReady() const { return m_State == eState::Ready; }
+	inline bool isFailed() const { return m_State == eState::Failed; }
+
+	// I2C interrupt: next write of the background sequence
+	void OnTxComplete(I2C_HandleTypeDef *phi2c, bool Error);
+
+protected:
+	enum class eState : uint8_t { Idle, Busy, Ready, Failed };
+
+	struct sWrite {
+		uint8_t		Reg;
+		uint16_t	Data;
+	};
+
+	// Register writes of the configuration, in order
+	void BuildSequence(){
+		uint8_t Index = 0;
 
 		// Reset
 		m_ResetRegister.raw = 0;
-	    if( HAL_OK != (Result = WriteReg(m_ResetRegister.address, m_ResetRegister.raw))){
-	    	return Result;
-	    }
+		m_Sequence[Index++] = {m_ResetRegister.address, m_ResetRegister.raw};
 
 		// Set Line Inputs to 0DB
 		m_LeftLineIn.raw = 0;
 		m_LeftLineIn.bits.linvol = 0x17;
-	    if( HAL_OK != (Result = WriteReg(m_LeftLineIn.address, m_LeftLineIn.raw))){
-	    	return Result;
-	    }
+		m_Sequence[Index++] = {m_LeftLineIn.address, m_LeftLineIn.raw};
 		m_RightLineIn.raw = 0;
 		m_RightLineIn.bits.rinvol = 0x17;
-	    if( HAL_OK != (Result = WriteReg(m_RightLineIn.address, m_RightLineIn.raw))){
-	    	return Result;
-	    }
+		m_Sequence[Index++] = {m_RightLineIn.address, m_RightLineIn.raw};
 
 	    // Set Headphone To Mute
 	    m_LeftHeadphoneOut.raw = 0;
-	    if( HAL_OK != (Result = WriteReg(m_LeftHeadphoneOut.address, m_LeftHeadphoneOut.raw))){
-	    	return Result;
-	    }
+		m_Sequence[Index++] = {m_LeftHeadphoneOut.address, m_LeftHeadphoneOut.raw};
 	    m_RightHeadphoneOut.raw = 0;
-	    if( HAL_OK != (Result = WriteReg(m_RightHeadphoneOut.address, m_RightHeadphoneOut.raw))){
-	    	return Result;
-	    }
+		m_Sequence[Index++] = {m_RightHeadphoneOut.address, m_RightHeadphoneOut.raw};
 
 	    // Analog and Digital Routing
 	    m_AnalogAudioPath.raw = 0;
 	    m_AnalogAudioPath.bits.micMute = 1;
 	    m_AnalogAudioPath.bits.dacSel = 1;
-	    if( HAL_OK != (Result = WriteReg(m_AnalogAudioPath.address, m_AnalogAudioPath.raw))){
-	    	return Result;
-	    }
+		m_Sequence[Index++] = {m_AnalogAudioPath.address, m_AnalogAudioPath.raw};
 	    m_DigitalAudioPath.raw = 0;
-	    if( HAL_OK != (Result = WriteReg(m_DigitalAudioPath.address, m_DigitalAudioPath.raw))){
-	    	return Result;
-	    }
+		m_Sequence[Index++] = {m_DigitalAudioPath.address, m_DigitalAudioPath.raw};
 
 	    // Configure power management
 	    m_PowerDownControl.raw = 0;
 	    m_PowerDownControl.bits.micPD = 1;
 		m_PowerDownControl.bits.oscPD = 1;
 		m_PowerDownControl.bits.clkOutPD = 1;
-	    if( HAL_OK != (Result = WriteReg(m_PowerDownControl.address, m_PowerDownControl.raw))){
-	    	return Result;
-	    }
+		m_Sequence[Index++] = {m_PowerDownControl.address, m_PowerDownControl.raw};
 
 	    // Digital Format
 	    m_DigitalAudioInterfaceFormat.raw=0;
@@ -230,30 +258,26 @@ public:
 	    m_DigitalAudioInterfaceFormat.bits.lrswap = 1;      // yes
 	    m_DigitalAudioInterfaceFormat.bits.master = 0;		// Slave
 	    m_DigitalAudioInterfaceFormat.bits.bclkinv = 0;		// no
-	    if( HAL_OK != (Result = WriteReg(m_DigitalAudioInterfaceFormat.address, m_DigitalAudioInterfaceFormat.raw))){
-	    	return Result;
-	    }
+		m_Sequence[Index++] = {m_DigitalAudioInterfaceFormat.address, m_DigitalAudioInterfaceFormat.raw};
 
 	    // Sample rate
 	    m_SampleRateControl.raw = 0;
-	    if( HAL_OK != (Result = WriteReg(m_SampleRateControl.address, m_SampleRateControl.raw))){
-	    	return Result;
-	    }
+		m_Sequence[Index++] = {m_SampleRateControl.address, m_SampleRateControl.raw};
 
 	    // Enable
 	    m_DigitalInterfaceActivation.raw = 0;
-	    if( HAL_OK != (Result = WriteReg(m_DigitalInterfaceActivation.address, m_DigitalInterfaceActivation.raw))){
-	    	return Result;
-	    }
+		m_Sequence[Index++] = {m_DigitalInterfaceActivation.address, m_DigitalInterfaceActivation.raw};
 	    m_DigitalInterfaceActivation.bits.activate = 1;
-	    if( HAL_OK != (Result = WriteReg(m_DigitalInterfaceActivation.address, m_DigitalInterfaceActivation.raw))){
-	    	return Result;
-	    }
+		m_Sequence[Index++] = {m_DigitalInterfaceActivation.address, m_DigitalInterfaceActivation.raw};
+	}
 
-	    return Result;
+	// Send write Index of the sequence without waiting (interrupt mode)
+	HAL_StatusTypeDef SendAsync(uint8_t Index){
+	    m_TxBuff[0] = ((m_Sequence[Index].Reg << 1) & 0xfe) | ((m_Sequence[Index].Data >> 8) & 0x01);
+	    m_TxBuff[1] = m_Sequence[Index].Data & 0xff;
+	    return HAL_I2C_Master_Transmit_IT(m_phi2c, WM8731_ADR << 1, m_TxBuff, 2);
 	}
 
-protected:
 	HAL_StatusTypeDef WriteReg(uint8_t Reg, uint16_t Data){
 		HAL_StatusTypeDef Result;
 
@@ -282,5 +306,11 @@ protected:
 	SampleRateControl			m_SampleRateControl;
 	DigitalInterfaceActivation  m_DigitalInterfaceActivation;
 	ResetRegister				m_ResetRegister;
+
+	// Background sequence
+	sWrite						m_Sequence[WM8731_NB_WRITES];
+	uint8_t						m_TxBuff[2];			// Sent by the I2C interrupt
+	volatile uint8_t			m_NextWrite = 0;
+	volatile eState				m_State = eState::Idle;
 };
 }//Dad
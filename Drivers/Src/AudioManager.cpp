@@ -4,7 +4,9 @@
 // Optimized for Speed using ARM DSP Extensions and Hardware Intrinsics
 //==================================================================================
 #include "HardwareDefines.h"
+#include "TCMPlacement.h"
 #include "AudioManager.h"
+#include "cBootProfiler.h"
 #include "arm_math.h" // Nécessaire pour les intrinsics ARM et CMSIS-DSP
 
 // =============================================================================
@@ -37,10 +39,13 @@ ALIGN_8 NO_CACHE_RAM int32_t txBuffer[SAI_BUFFER_SIZE];
 SAI_HandleTypeDef *__phSaiTx = nullptr;
 SAI_HandleTypeDef *__phSaiRx = nullptr;
 
+// AudioCallback called (false between PrestartAudio and StartAudio)
+static volatile bool __AudioCallbackEnabled = true;
+
 // =============================================================================
 // Default  AudioCallback Function
 // =============================================================================
-void __attribute__((weak)) AudioCallback(AudioBuffer* input, AudioBuffer* output){
+ITCM_CODE void __attribute__((weak)) AudioCallback(AudioBuffer* input, AudioBuffer* output){
 }
 
 // =============================================================================
@@ -50,7 +55,7 @@ void __attribute__((weak)) AudioCallback(AudioBuffer* input, AudioBuffer* output
 // -----------------------------------------------------------------------------
 // Convert int32_t buffer to float AudioBuffer (Optimized)
 // -----------------------------------------------------------------------------
-void ConvertToAudioBuffer(const int32_t* __restrict intBuf, AudioBuffer* __restrict floatBuf) {
+ITCM_CODE void ConvertToAudioBuffer(const int32_t* __restrict intBuf, AudioBuffer* __restrict floatBuf) {
 
     // Pointers for iteration
     const int32_t* pSrc = intBuf;
@@ -72,7 +77,7 @@ void ConvertToAudioBuffer(const int32_t* __restrict intBuf, AudioBuffer* __restr
 // -----------------------------------------------------------------------------
 // Convert float AudioBuffer to int32_t buffer (Optimized)
 // -----------------------------------------------------------------------------
-void ConvertFromAudioBuffer(const AudioBuffer* __restrict floatBuf, int32_t* __restrict intBuf) {
+ITCM_CODE void ConvertFromAudioBuffer(const AudioBuffer* __restrict floatBuf, int32_t* __restrict intBuf) {
 
     const AudioBuffer* pSrc = floatBuf;
     int32_t* pDst = intBuf;
@@ -115,11 +120,11 @@ inline void ProcessTxCallback(SAI_HandleTypeDef *hsai, int32_t* targetBuffer) {
     }
 }
 
-void HAL_SAI_TxCpltCallback(SAI_HandleTypeDef *hsai) {
+ITCM_CODE void HAL_SAI_TxCpltCallback(SAI_HandleTypeDef *hsai) {
     ProcessTxCallback(hsai, &txBuffer[SAI_HALF_BUFFER_SIZE]);
 }
 
-void HAL_SAI_TxHalfCpltCallback(SAI_HandleTypeDef *hsai) {
+ITCM_CODE void HAL_SAI_TxHalfCpltCallback(SAI_HandleTypeDef *hsai) {
     ProcessTxCallback(hsai, txBuffer);
 }
 
@@ -132,7 +137,10 @@ inline void ProcessRxCallback(SAI_HandleTypeDef *hsai, int32_t* sourceBuffer, Au
         ConvertToAudioBuffer(sourceBuffer, In);
 
         // 2. Traitement Audio (Callback Utilisateur)
-        AudioCallback(In, targetFloatBuf);
+        //    Before StartAudio the output buffers stay at zero (silence)
+        if (__AudioCallbackEnabled) {
+            AudioCallback(In, targetFloatBuf);
+        }
 
         // 3. Swap Buffer Output
         // L'assignation d'un pointeur 32 bits est atomique sur ARM Cortex-M.
@@ -141,11 +149,11 @@ inline void ProcessRxCallback(SAI_HandleTypeDef *hsai, int32_t* sourceBuffer, Au
     }
 }
 
-void HAL_SAI_RxCpltCallback(SAI_HandleTypeDef *hsai) {
+ITCM_CODE void HAL_SAI_RxCpltCallback(SAI_HandleTypeDef *hsai) {
     ProcessRxCallback(hsai, &rxBuffer[SAI_HALF_BUFFER_SIZE], Out2);
 }
 
-void HAL_SAI_RxHalfCpltCallback(SAI_HandleTypeDef *hsai) {
+ITCM_CODE void HAL_SAI_RxHalfCpltCallback(SAI_HandleTypeDef *hsai) {
     ProcessRxCallback(hsai, rxBuffer, Out1);
 }
 
@@ -153,7 +161,10 @@ void HAL_SAI_RxHalfCpltCallback(SAI_HandleTypeDef *hsai) {
 // Audio Management Functions
 // =============================================================================
 
-HAL_StatusTypeDef StartAudio(SAI_HandleTypeDef *phSaiTx, SAI_HandleTypeDef *phSaiRx) {
+// -----------------------------------------------------------------------------
+// Clear the buffers and start the SAI DMA
+// -----------------------------------------------------------------------------
+static HAL_StatusTypeDef StartSAI(SAI_HandleTypeDef *phSaiTx, SAI_HandleTypeDef *phSaiRx) {
     HAL_StatusTypeDef Result;
 
     // Initialize buffers and pointers
@@ -176,3 +187,67 @@ HAL_StatusTypeDef StartAudio(SAI_HandleTypeDef *phSaiTx, SAI_HandleTypeDef *phSa
     return HAL_SAI_Transmit_DMA(phSaiTx, (uint8_t*)txBuffer, SAI_BUFFER_SIZE);
 }
 
+// -----------------------------------------------------------------------------
+// Start the SAI early: the clocks, the codec and the DMA settle while the rest
+// of the boot runs, StartAudio then only opens the callback
+// -----------------------------------------------------------------------------
+HAL_StatusTypeDef PrestartAudio(SAI_HandleTypeDef *phSaiTx, SAI_HandleTypeDef *phSaiRx) {
+    __AudioCallbackEnabled = false;
+    HAL_StatusTypeDef Result = StartSAI(phSaiTx, phSaiRx);
+    __BootProfiler.Mark("SAI");
+    return Result;
+}
+
+// -----------------------------------------------------------------------------
+// Start audio processing (SAI started here unless PrestartAudio did it)
+// -----------------------------------------------------------------------------
+HAL_StatusTypeDef StartAudio(SAI_HandleTypeDef *phSaiTx, SAI_HandleTypeDef *phSaiRx) {
+    HAL_StatusTypeDef Result = HAL_OK;
+
+    __AudioCallbackEnabled = true;                  // Next block is processed
+    if ((__phSaiTx != phSaiTx) || (__phSaiRx != phSaiRx)) {
+        Result = StartSAI(phSaiTx, phSaiRx);
+    }
+    __BootProfiler.Mark("Audio");                   // Time to first audio
+    return Result;
+}
+
+#ifdef MONITOR
+// -----------------------------------------------------------------------------
+// Audio suspended for the on-target probes: the SAI keeps running on silence
+// -----------------------------------------------------------------------------
+void SuspendAudio() {
+    __AudioCallbackEnabled = false;                 // A callback in progress ends first (interrupt)
+    memset((void*)Out1, 0, sizeof(Out1));
+    memset((void*)Out2, 0, sizeof(Out2));
+}
+
+void ResumeAudio() {
+    __AudioCallbackEnabled = true;
+}
+
+// -----------------------------------------------------------------------------
+// AudioCallback cycles per block on silent input, called from the main loop
+// while the audio is suspended, interrupts masked during each block
+// -----------------------------------------------------------------------------
+void ProbeAudioCallback(uint32_t NbBlocks, uint32_t& Average, uint32_t& Max) {
+    AudioBuffer ProbeIn[AUDIO_BUFFER_SIZE];
+    AudioBuffer ProbeOut[AUDIO_BUFFER_SIZE];
+    memset(ProbeIn, 0, sizeof(ProbeIn));
+
+    uint64_t Total = 0;
+    Max = 0;
+    for (uint32_t Block = 0; Block < NbBlocks; Block++) {
+        uint32_t Primask = __get_PRIMASK();
+        __disable_irq();
+        uint32_t Start = DWT->CYCCNT;
+        AudioCallback(ProbeIn, ProbeOut);
+        uint32_t Cycles = DWT->CYCCNT - Start;
+        __set_PRIMASK(Primask);
+
+        Total += Cycles;
+        if (Cycles > Max) Max = Cycles;
+    }
+    Average = (NbBlocks != 0) ? static_cast<uint32_t>(Total / NbBlocks) : 0;
+}
+#endif
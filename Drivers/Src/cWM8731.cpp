@@ -0,0 +1,92 @@
+//==================================================================================
+//==================================================================================
+// File: cWM8731.cpp
+// Description: WM8731 background initialization (I2C interrupt chain)
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "cWM8731.h"
+
+namespace DadDrivers {
+
+// Codec running the background sequence (one I2C transfer at a time)
+static cWM8731* __pAsyncCodec = nullptr;
+
+#if (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
+static void I2C_TxCplt_CallBack(I2C_HandleTypeDef* phi2c) {
+    if (__pAsyncCodec) __pAsyncCodec->OnTxComplete(phi2c, false);
+}
+static void I2C_Error_CallBack(I2C_HandleTypeDef* phi2c) {
+    if (__pAsyncCodec) __pAsyncCodec->OnTxComplete(phi2c, true);
+}
+#endif
+
+//**********************************************************************************
+// cWM8731 background initialization
+//**********************************************************************************
+
+// -----------------------------------------------------------------------------
+// Start the register sequence: the first write is sent here, each I2C
+// completion interrupt sends the next one. The writes are not spaced: the
+// codec takes a register as soon as it is received.
+// -----------------------------------------------------------------------------
+HAL_StatusTypeDef cWM8731::StartInitialize(I2C_HandleTypeDef *phi2c){
+	m_phi2c = phi2c;
+	BuildSequence();
+
+#if (USE_HAL_I2C_REGISTER_CALLBACKS == 1)
+	HAL_I2C_RegisterCallback(m_phi2c, HAL_I2C_MASTER_TX_COMPLETE_CB_ID, I2C_TxCplt_CallBack);
+	HAL_I2C_RegisterCallback(m_phi2c, HAL_I2C_ERROR_CB_ID, I2C_Error_CallBack);
+#endif
+
+	// Wait for previous transfer to be finished
+	while(HAL_I2C_GetState(m_phi2c) != HAL_I2C_STATE_READY) {};
+
+	__pAsyncCodec = this;
+	m_NextWrite = 1;
+	m_State = eState::Busy;
+	HAL_StatusTypeDef Result = SendAsync(0);
+	if(Result != HAL_OK){
+		m_State = eState::Failed;
+		__pAsyncCodec = nullptr;
+	}
+	return Result;
+}
+
+// -----------------------------------------------------------------------------
+// I2C interrupt: send the next write or close the sequence
+// -----------------------------------------------------------------------------
+void cWM8731::OnTxComplete(I2C_HandleTypeDef *phi2c, bool Error){
+	if((phi2c != m_phi2c) || (m_State != eState::Busy)) return;
+
+	if(Error){
+		m_State = eState::Failed;
+	}else if(m_NextWrite >= WM8731_NB_WRITES){
+		m_State = eState::Ready;
+	}else if(SendAsync(m_NextWrite) != HAL_OK){
+		m_State = eState::Failed;
+	}else{
+		m_NextWrite = m_NextWrite + 1;
+		return;
+	}
+	__pAsyncCodec = nullptr;
+}
+
+} // namespace DadDrivers
+
+#if (USE_HAL_I2C_REGISTER_CALLBACKS != 1)
+// -----------------------------------------------------------------------------
+// HAL I2C callbacks (weak in the HAL)
+// -----------------------------------------------------------------------------
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef* phi2c) {
+    if (DadDrivers::__pAsyncCodec) DadDrivers::__pAsyncCodec->OnTxComplete(phi2c, false);
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef* phi2c) {
+    if (DadDrivers::__pAsyncCodec) DadDrivers::__pAsyncCodec->OnTxComplete(phi2c, true);
+}
+#endif
+
+//***End of file**************************************************************
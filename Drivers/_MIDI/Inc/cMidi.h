@@ -15,16 +15,58 @@
 
 #include "main.h"
 #include "GUI_Event.h"
-#include <vector>
+#include "cParameter.h"
+#include "cMidiClock.h"
 
 // =============================================================================
 // Constants and Definitions
 // =============================================================================
 
-#define MIDI_BUFFER_SIZE   128   // Size of the MIDI ring buffer
-#define MIDI_USB_FIFO_SIZE 40    // Size of the MIDI USB FIFO buffer
+// Queue sizing (power of 2, 8 bytes per event). While audio runs, the
+// ingest queue is drained every audio block (AUDIO_BUFFER_SIZE samples).
+// One USB OUT packet holds up to 16 events and DIN MIDI adds at most one
+// event every 640 us. If the audio is stopped, the main loop drains it
+// every GUI_FAST_UPDATE_MS instead: 10 ms at one full USB packet per 1 ms
+// frame is 160 events. The main loop queue sees the same 10 ms burst.
+#ifndef MIDI_INGEST_QUEUE_SIZE
+#define MIDI_INGEST_QUEUE_SIZE 256      // UART + USB interrupts -> audio block
+#endif
+#ifndef MIDI_EVENT_QUEUE_SIZE
+#define MIDI_EVENT_QUEUE_SIZE 256       // Audio block -> main loop
+#endif
+#ifndef MIDI_UART_DMA_SIZE
+#define MIDI_UART_DMA_SIZE 16           // UART circular DMA buffer (half: 8 bytes, 2.5 ms)
+#endif
+#define MIDI_UART_BYTE_RATE 3125       // DIN MIDI bytes per second (31250 baud, 10 bits)
 
 #define MULTI_CHANNEL 0xFF     // Special value to listen on all MIDI channels
+#define MIDI_NB_CHANNELS 16    // MIDI channels
+#define MIDI_NB_CONTROLS 128   // Control Change numbers
+
+#ifndef MIDI_CC_ROUTE_SIZE
+#define MIDI_CC_ROUTE_SIZE 3            // Targets of one channel/controller entry
+#endif
+#ifndef MIDI_CC_MAX_TARGETS
+#define MIDI_CC_MAX_TARGETS 64          // Distinct main loop Control Change targets
+#endif
+#ifndef MIDI_RTCC_MAX_TARGETS
+#define MIDI_RTCC_MAX_TARGETS 32        // Distinct audio block Control Change targets
+#endif
+#ifndef MIDI_MAX_PC_CALLBACKS
+#define MIDI_MAX_PC_CALLBACKS 8         // Program Change callbacks
+#endif
+#ifndef MIDI_MAX_NOTE_CALLBACKS
+#define MIDI_MAX_NOTE_CALLBACKS 8       // Note On/Off callbacks
+#endif
+#ifndef MIDI_MAX_HIGHRES_CALLBACKS
+#define MIDI_MAX_HIGHRES_CALLBACKS 32   // High resolution (14-bit CC / NRPN / RPN) callbacks per context
+#endif
+#ifndef MIDI_LEARN_MAX_PARAMETERS
+#define MIDI_LEARN_MAX_PARAMETERS 128   // Parameters that can be bound by MIDI learn
+#endif
+#ifndef MIDI_LEARN_MAX_BINDINGS
+#define MIDI_LEARN_MAX_BINDINGS 32      // Learned Control Change bindings
+#endif
 
 // =============================================================================
 // MIDI USB Code Index Numbers (CIN) definitions
@@ -53,21 +95,36 @@
 using ControlChangeCallback = void (*)(uint8_t control, uint8_t value, uint32_t userData);  			// CC message callback
 using ProgramChangeCallback = void (*)(uint8_t program, uint32_t userData);                 			// PC message callback
 using NoteChangeCallback = void (*)(uint8_t OnOff, uint8_t note, uint8_t velocity, uint32_t userData);  // Note message callback
+using RTControlChangeCallback = void (*)(uint8_t control, uint8_t value, uint32_t SampleOffset, uint32_t userData); // CC callback in the audio block
 
-// =============================================================================
-// Callback Entry Structures
-// =============================================================================
+// High resolution values are scaled to 32 bits (MIDI 2.0 min-center-max scaling)
+using HighResControlCallback = void (*)(uint16_t number, uint32_t value, uint32_t userData);  	// 14-bit CC / NRPN / RPN callback
+using RTHighResControlCallback = void (*)(uint16_t number, uint32_t value, uint32_t SampleOffset, uint32_t userData); // Same in the audio block
 
 //**********************************************************************************
-// CC_CallbackEntry
-// Structure to store Control Change callback information
+// eMidiHighRes
+// Kind of high resolution controller
 //**********************************************************************************
-struct CC_CallbackEntry {
-    uint8_t control;                    // Control Change number (0-127)
-    uint32_t userData;                  // User-defined data passed to callback
-    ControlChangeCallback callback;     // Function to call when this CC is received
+enum class eMidiHighRes : uint8_t {
+    CC14 = 0,       // Controller 0-31 (MSB) paired with controller 32-63 (LSB)
+    NRPN,           // Non registered parameter number (CC 99/98, data entry CC 6/38)
+    RPN             // Registered parameter number (CC 101/100, data entry CC 6/38)
 };
 
+//**********************************************************************************
+// eMidiLearn
+// Result of the last MIDI learn
+//**********************************************************************************
+enum class eMidiLearn : uint8_t {
+    None = 0,       // Waiting, canceled or never started
+    Learned,        // Controller bound and saved
+    Failed          // Bindings or routing table full, previous binding kept
+};
+
+// =============================================================================
+// Callback Entry Structures
+// =============================================================================
+
 //**********************************************************************************
 // PC_CallbackEntry
 // Structure to store Program Change callback information
@@ -87,6 +144,30 @@ struct Note_CallbackEntry {
 };
 
 
+//**********************************************************************************
+// HighRes_CallbackEntry
+// Structure to store high resolution controller callback information
+//**********************************************************************************
+struct HighRes_CallbackEntry {
+    eMidiHighRes kind;                  // 14-bit CC, NRPN or RPN
+    uint8_t channel;                    // MIDI channel (0-15) or MULTI_CHANNEL
+    uint16_t number;                    // Controller (0-31) or parameter number (0-16383)
+    uint32_t userData;                  // User-defined data passed to callback
+    HighResControlCallback callback;    // Function to call when the value is complete
+};
+
+//**********************************************************************************
+// RTHighRes_CallbackEntry
+// Structure to store audio-side high resolution controller callback information
+//**********************************************************************************
+struct RTHighRes_CallbackEntry {
+    eMidiHighRes kind;                  // 14-bit CC, NRPN or RPN
+    uint8_t channel;                    // MIDI channel (0-15) or MULTI_CHANNEL
+    uint16_t number;                    // Controller (0-31) or parameter number (0-16383)
+    uint32_t userData;                  // User-defined data passed to callback
+    RTHighResControlCallback callback;  // Function called in the audio block
+};
+
 //**********************************************************************************
 // UsbMidiCallback
 // Callback function for handling incoming MIDI events originating from the USB bus.
@@ -98,49 +179,549 @@ void UsbMidiCallback(uint8_t code, uint8_t channel, uint8_t data1, uint8_t data2
 
 namespace DadDrivers {
 // =============================================================================
-// MIDI message reception from the USB bus.
+// Timestamped MIDI message reception (UART and USB).
 // =============================================================================
 
 //**********************************************************************************
 // MIDI event structure
+// Complete channel message time stamped (DWT->CYCCNT) at reception
 //**********************************************************************************
 typedef struct {
-    uint8_t code;  			// Event type
-    uint8_t channel;
-    uint8_t data1;
-    uint8_t data2;
+    uint32_t timeStamp;     // Reception time (CPU cycles)
+    uint8_t  status;        // Status byte (type | channel)
+    uint8_t  data1;         // First data byte
+    uint8_t  data2;         // Second data byte (0 for single data byte messages)
+    uint8_t  source;        // eMidiSource (fills the padding byte)
 } stMidiEvent_t;
 
 //**********************************************************************************
-// class cMidiFifo
-// FIFO buffer management for USB MIDI messages.
+// eMidiSource
+// Interface an event was received on
+//**********************************************************************************
+enum eMidiSource : uint8_t {
+    MIDI_SOURCE_UART = 0,   // DIN MIDI
+    MIDI_SOURCE_USB,        // USB MIDI
+    MIDI_NB_SOURCES
+};
+
+//**********************************************************************************
+// class cMidiIngestQueue
+// Lock-free multi producer / single consumer queue of MIDI events.
+// Every interrupt (UART, USB) pushes into the same queue, in any priority
+// order: a producer reserves a cell by compare-and-swap on the head (LDREX/
+// STREX, an interrupted reservation is retried), writes it and publishes it
+// through the cell sequence. The consumer stops at the first cell not yet
+// published, so a producer preempted between reservation and publication
+// only delays the following events to the next block.
+// Overflows are counted per source; the consumer tracks the deepest fill.
+//**********************************************************************************
+class cMidiIngestQueue{
+	static_assert((MIDI_INGEST_QUEUE_SIZE & (MIDI_INGEST_QUEUE_SIZE - 1)) == 0, "MIDI_INGEST_QUEUE_SIZE must be a power of 2");
+public:
+	cMidiIngestQueue() { Clear(); }
+	~cMidiIngestQueue()=default;
+
+	//**********************************************************************************
+	// Clear
+	// Empty the queue and the counters (no producer running)
+	//**********************************************************************************
+	inline void Clear() {
+		for (uint32_t Index = 0; Index < MIDI_INGEST_QUEUE_SIZE; Index++) {
+			m_Cells[Index].Sequence = Index;
+		}
+		m_Head = 0;
+		m_Tail = 0;
+		m_HighWater = 0;
+		for (uint32_t Source = 0; Source < MIDI_NB_SOURCES; Source++) {
+			m_Pushed[Source] = 0;
+			m_Overflows[Source] = 0;
+		}
+	}
+
+	//**********************************************************************************
+	// Push
+	// Add MIDI event to the queue (any producer)
+	// Returns false and counts an overflow of the event source if the queue is full
+	//**********************************************************************************
+	inline bool Push(const stMidiEvent_t& event) {
+		uint32_t Head = __atomic_load_n(&m_Head, __ATOMIC_RELAXED);
+		sCell* pCell;
+		for (;;) {
+			pCell = &m_Cells[Head & (MIDI_INGEST_QUEUE_SIZE - 1)];
+			int32_t Diff = static_cast<int32_t>(__atomic_load_n(&pCell->Sequence, __ATOMIC_ACQUIRE) - Head);
+			if (Diff == 0) {
+				// Cell free: reserve it (Head reloaded on failure)
+				if (__atomic_compare_exchange_n(&m_Head, &Head, Head + 1, true,
+				                                __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+					break;
+				}
+			} else if (Diff < 0) {
+				m_Overflows[event.source]++;		// Queue full (one producer per source)
+				return false;
+			} else {
+				Head = __atomic_load_n(&m_Head, __ATOMIC_RELAXED);	// Reserved by a preempting producer
+			}
+		}
+		pCell->Event = event;
+		__atomic_store_n(&pCell->Sequence, Head + 1, __ATOMIC_RELEASE);	// Publish
+		m_Pushed[event.source]++;
+		return true;
+	}
+
+	//**********************************************************************************
+	// Peek
+	// Get the oldest published MIDI event without removing it (consumer side)
+	//**********************************************************************************
+	inline const stMidiEvent_t* Peek() {
+		const sCell& Cell = m_Cells[m_Tail & (MIDI_INGEST_QUEUE_SIZE - 1)];
+		if (__atomic_load_n(&Cell.Sequence, __ATOMIC_ACQUIRE) != (m_Tail + 1)) {
+			return nullptr; 			// Empty or not yet published
+		}
+		uint32_t Depth = __atomic_load_n(&m_Head, __ATOMIC_RELAXED) - m_Tail;
+		if (Depth > m_HighWater) m_HighWater = Depth;
+		return &Cell.Event;
+	}
+
+	//**********************************************************************************
+	// Pop
+	// Release the oldest MIDI event (consumer side, after Peek)
+	//**********************************************************************************
+	inline void Pop() {
+		sCell& Cell = m_Cells[m_Tail & (MIDI_INGEST_QUEUE_SIZE - 1)];
+		__atomic_store_n(&Cell.Sequence, m_Tail + MIDI_INGEST_QUEUE_SIZE, __ATOMIC_RELEASE);
+		m_Tail++;
+	}
+
+	//**********************************************************************************
+	// Counters
+	//**********************************************************************************
+	inline uint32_t getOverflows(eMidiSource Source) const { return m_Overflows[Source]; }
+	inline uint32_t getOverflows() const {
+		uint32_t Total = 0;
+		for (uint32_t Source = 0; Source < MIDI_NB_SOURCES; Source++) Total += m_Overflows[Source];
+		return Total;
+	}
+	inline uint32_t getPushed(eMidiSource Source) const { return m_Pushed[Source]; }
+	inline uint32_t getHighWater() const { return m_HighWater; }
+
+protected:
+	struct sCell {
+		uint32_t 		Sequence;				// Free for Head == Sequence, published for Tail + 1
+		stMidiEvent_t 	Event;
+	};
+
+	sCell 				m_Cells[MIDI_INGEST_QUEUE_SIZE];
+	uint32_t 			m_Head;             	// Next cell to reserve (producers)
+	uint32_t 			m_Tail;             	// Next cell to read (consumer)
+	uint32_t 			m_HighWater;        	// Deepest fill seen by the consumer
+	volatile uint32_t 	m_Pushed[MIDI_NB_SOURCES];		// Events queued per source
+	volatile uint32_t 	m_Overflows[MIDI_NB_SOURCES];	// Events lost per source
+};
+
+//**********************************************************************************
+// class cMidiEventQueue
+// Lock-free single producer / single consumer queue of MIDI events.
+// The producer only writes m_Head and the consumer only writes m_Tail, so an
+// interrupt can push while a lower or higher priority context pops.
 //**********************************************************************************
-class cMidiFifo{
+class cMidiEventQueue{
 public:
-	cMidiFifo()=default;
-	~cMidiFifo()=default;
+	cMidiEventQueue()=default;
+	~cMidiEventQueue()=default;
+
+	//**********************************************************************************
+	// Push
+	// Add MIDI event to the queue (producer side)
+	// Returns false and counts an overflow if the queue is full
+	//**********************************************************************************
+	inline bool Push(const stMidiEvent_t& event) {
+		uint32_t Head = m_Head;
+		if ((Head - m_Tail) >= MIDI_EVENT_QUEUE_SIZE) {
+			m_Overflows++;
+			return false; 				// Queue full
+		}
+		m_Buffer[Head & (MIDI_EVENT_QUEUE_SIZE - 1)] = event;
+		__DMB();						// Event visible before the head moves
+		m_Head = Head + 1;
+		return true;
+	}
+
+	//**********************************************************************************
+	// Peek
+	// Get the oldest MIDI event without removing it (consumer side)
+	//**********************************************************************************
+	inline const stMidiEvent_t* Peek() const {
+		uint32_t Tail = m_Tail;
+		if (Tail == m_Head) {
+			return nullptr; 			// Queue empty
+		}
+		__DMB();						// Head read before the event
+		return &m_Buffer[Tail & (MIDI_EVENT_QUEUE_SIZE - 1)];
+	}
 
 	//**********************************************************************************
-	// MidiFifoPush
-	// Add MIDI event to FIFO buffer (thread-safe)
+	// Pop
+	// Remove the oldest MIDI event (consumer side, after Peek)
 	//**********************************************************************************
-	bool Push(const stMidiEvent_t* event);
+	inline void Pop() {
+		__DMB();						// Event read before the slot is released
+		m_Tail = m_Tail + 1;
+	}
 
 	//**********************************************************************************
 	// Pull
-	// get and Remove MIDI event from FIFO buffer
+	// Get and remove the oldest MIDI event (consumer side)
 	//**********************************************************************************
-	bool Pull(stMidiEvent_t* event);
+	inline bool Pull(stMidiEvent_t* event) {
+		const stMidiEvent_t* pEvent = Peek();
+		if (pEvent == nullptr) {
+			return false; 				// Queue empty
+		}
+		*event = *pEvent;
+		Pop();
+		return true;
+	}
+
+	//**********************************************************************************
+	// getOverflows
+	// Number of events lost because the queue was full
+	//**********************************************************************************
+	inline uint32_t getOverflows() const {
+		return m_Overflows;
+	}
 
 protected:
+	stMidiEvent_t 		m_Buffer[MIDI_EVENT_QUEUE_SIZE];  	// Event buffer
+	volatile uint32_t 	m_Head = 0;                		// Write counter (producer)
+	volatile uint32_t 	m_Tail = 0;                		// Read counter (consumer)
+	volatile uint32_t 	m_Overflows = 0;               	// Lost events
+};
+
+//**********************************************************************************
+// class cMidiHighResParser
+// Assembles 14-bit Control Change pairs and NRPN / RPN data entries.
+//
+// Pairing is opt-in per controller (setPairs): controllers 32-63 are plain
+// 7-bit controllers unless their MSB (controller - 32) is paired. A paired
+// controller 0-31 is sent alone (7-bit) until its LSB is seen; from then on
+// the value is complete on the LSB only, so a pair never produces an
+// intermediate MSB-only value. Data entry (CC 6/38) follows the same rule for
+// the selected NRPN / RPN. Values are returned scaled to 32 bits.
+//**********************************************************************************
+class cMidiHighResParser {
+public:
+    // -------------------------------------------------------------------------
+    // Forget the MSBs, the selected parameters and the LSB detection
+    // -------------------------------------------------------------------------
+    void Reset();
+
+    // -------------------------------------------------------------------------
+    // Feed a Control Change
+    // @return true when Kind / Number / Value hold a complete value
+    // -------------------------------------------------------------------------
+    bool Parse(uint8_t Channel, uint8_t Control, uint8_t Value,
+               eMidiHighRes& Kind, uint16_t& Number, uint32_t& Value32);
 
-	// FIFO buffer and management variables
-	stMidiEvent_t 	m_midiFifoBuffer[MIDI_USB_FIFO_SIZE];  	// FIFO buffer
-	uint16_t 		m_midiFifoHead = 0;                		// Head index
-	uint16_t 		m_midiFifoTail = 0;                		// Tail index
-	uint16_t 		m_midiFifoCount = 0;               		// Number of events in FIFO
+    // -------------------------------------------------------------------------
+    // Controllers 0-31 paired with their LSB (bit n: controller n)
+    // -------------------------------------------------------------------------
+    inline void setPairs(uint32_t Mask) { m_PairMask = Mask; }
+    inline uint32_t getPairs() const { return m_PairMask; }
+
+    // -------------------------------------------------------------------------
+    // Scale a 7 or 14-bit value to 32 bits (MIDI 2.0 min-center-max scaling:
+    // 0 -> 0, center -> 0x80000000, max -> 0xFFFFFFFF)
+    // -------------------------------------------------------------------------
+    static uint32_t Upscale(uint32_t Value, uint8_t Bits);
+
+protected:
+    struct sChannel {
+        uint8_t     MSB[32];            // Last MSB of controllers 0-31
+        uint32_t    LSBSeen;            // Bit n: controller n sends its LSB
+        uint8_t     ParamMSB;           // Selected NRPN / RPN
+        uint8_t     ParamLSB;
+        uint8_t     DataMSB;            // Last data entry MSB
+        bool        DataLSBSeen;        // Data entry LSB (CC 38) is sent
+        bool        ParamSelected;      // A parameter number is selected
+        eMidiHighRes ParamKind;         // NRPN or RPN
+    };
+
+    sChannel            m_Channels[MIDI_NB_CHANNELS];
+    volatile uint32_t   m_PairMask = 0;     // Bit n: controller n + 32 is the LSB of n
 };
 
+//**********************************************************************************
+// class cMidiParser
+// Running status MIDI byte stream parser (runs in the UART interrupt)
+//**********************************************************************************
+class cMidiParser{
+public:
+	cMidiParser()=default;
+	~cMidiParser()=default;
+
+	//**********************************************************************************
+	// Reset
+	// Forget the running status
+	//**********************************************************************************
+	inline void Reset() {
+		m_status = 0;
+		m_dataIndex = 0;
+		m_statusReceived = false;
+	}
+
+	//**********************************************************************************
+	// Parse
+	// Feed one byte (real-time bytes excluded)
+	// Returns true when Event holds a complete channel message
+	//**********************************************************************************
+	bool Parse(uint8_t byte, uint32_t TimeStamp, stMidiEvent_t& Event);
+
+	//**********************************************************************************
+	// getDataLength
+	// Number of data bytes expected for a given status byte (1 or 2)
+	//**********************************************************************************
+	static inline uint8_t getDataLength(uint8_t status) {
+		switch (status & 0xF0) {
+			case 0xC0:  // Program Change
+			case 0xD0:  // Channel Pressure (Aftertouch)
+				return 1;  // Single data byte messages
+			default:      // All other message types (Note On/Off, CC, etc.)
+				return 2;  // Two data byte messages
+		}
+	}
+
+protected:
+	uint8_t 	m_status = 0;       // Running status (0 = none)
+	uint8_t 	m_data[2];          // Data bytes for current message
+	uint8_t 	m_dataIndex = 0;    // Number of data bytes received so far
+	uint32_t 	m_timeStamp = 0;    // Reception time of the first byte of the message
+	bool 		m_statusReceived = false; // Last byte was a status byte
+};
+
+//**********************************************************************************
+// class cMidiCCRouter
+// Fixed Control Change routing table indexed by [channel][controller].
+//
+// Each entry holds up to MIDI_CC_ROUTE_SIZE indexes into a pool of targets
+// (callback + user data). A target registered on MULTI_CHANNEL is shared by
+// the 16 channel entries of its controller. Dispatch reads one entry: its
+// cost does not depend on the number of registered callbacks.
+//
+// Entries are edited with interrupts masked and appended after the target
+// is written: the table can be dispatched from the audio interrupt while
+// the main loop registers.
+//**********************************************************************************
+template<typename Callback_t, uint32_t NbTargets>
+class cMidiCCRouter {
+public:
+    static_assert(NbTargets < 0xFF, "Target indexes are stored on 8 bits");
+
+    // -------------------------------------------------------------------------
+    // Remove all routes
+    // -------------------------------------------------------------------------
+    void Clear() {
+        uint32_t Primask = __get_PRIMASK();
+        __disable_irq();
+        for (uint32_t Channel = 0; Channel < MIDI_NB_CHANNELS; Channel++) {
+            for (uint32_t Control = 0; Control < MIDI_NB_CONTROLS; Control++) {
+                m_Routes[Channel][Control].Count = 0;
+            }
+        }
+        for (uint32_t Index = 0; Index < NbTargets; Index++) {
+            m_Targets[Index].callback = nullptr;
+            m_Targets[Index].userData = 0;
+            m_RefCount[Index] = 0;
+        }
+        __set_PRIMASK(Primask);
+    }
+
+    // -------------------------------------------------------------------------
+    // Route a controller to a callback
+    // @param Channel - MIDI channel (0-15) or MULTI_CHANNEL
+    // @return false if the pool or one of the entries is full (nothing added)
+    // -------------------------------------------------------------------------
+    bool Add(uint8_t Channel, uint8_t Control, uint32_t userData, Callback_t pCallback) {
+        if ((pCallback == nullptr) || (Control >= MIDI_NB_CONTROLS)) return false;
+        uint32_t First, Last;
+        if (!getChannelRange(Channel, First, Last)) return false;
+
+        // Target already known (same callback and user data) or new one
+        uint32_t Target = findTarget(userData, pCallback);
+        if (Target == NbTargets) {
+            Target = findTarget(0, nullptr);
+            if (Target == NbTargets) return false;          // Pool full
+        }
+
+        // Every entry must accept the target
+        for (uint32_t Ch = First; Ch <= Last; Ch++) {
+            const sRoute& Route = m_Routes[Ch][Control];
+            if ((findInRoute(Route, Target) == Route.Count) && (Route.Count >= MIDI_CC_ROUTE_SIZE)) {
+                return false;
+            }
+        }
+
+        m_Targets[Target].userData = userData;
+        m_Targets[Target].callback = pCallback;
+        __DMB();                                            // Target visible before its routes
+
+        for (uint32_t Ch = First; Ch <= Last; Ch++) {
+            sRoute& Route = m_Routes[Ch][Control];
+            if (findInRoute(Route, Target) != Route.Count) continue;
+            Route.Target[Route.Count] = static_cast<uint8_t>(Target);
+            __DMB();
+            Route.Count = Route.Count + 1;
+            m_RefCount[Target]++;
+        }
+        return true;
+    }
+
+    // -------------------------------------------------------------------------
+    // Remove one route (channel MULTI_CHANNEL: the 16 channels)
+    // -------------------------------------------------------------------------
+    void Remove(uint8_t Channel, uint8_t Control, uint32_t userData, Callback_t pCallback) {
+        if (Control >= MIDI_NB_CONTROLS) return;
+        uint32_t First, Last;
+        if (!getChannelRange(Channel, First, Last)) return;
+        uint32_t Target = findTarget(userData, pCallback);
+        if (Target == NbTargets) return;
+
+        for (uint32_t Ch = First; Ch <= Last; Ch++) {
+            sRoute& Route = m_Routes[Ch][Control];
+            uint32_t Pos = findInRoute(Route, Target);
+            if (Pos != Route.Count) unlink(Route, Pos);
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // Remove every route of a callback (any controller, any user data)
+    // -------------------------------------------------------------------------
+    void Remove(Callback_t pCallback) {
+        for (uint32_t Channel = 0; Channel < MIDI_NB_CHANNELS; Channel++) {
+            for (uint32_t Control = 0; Control < MIDI_NB_CONTROLS; Control++) {
+                sRoute& Route = m_Routes[Channel][Control];
+                uint32_t Pos = 0;
+                while (Pos < Route.Count) {
+                    if (m_Targets[Route.Target[Pos]].callback == pCallback) {
+                        unlink(Route, Pos);
+                    } else {
+                        Pos++;
+                    }
+                }
+            }
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // Call the targets of a controller: callback(control, Args..., userData)
+    // The entry is copied first: a callback may edit the table
+    // -------------------------------------------------------------------------
+    template<typename... Args>
+    inline void Dispatch(uint8_t Channel, uint8_t Control, Args... args) const {
+        sRoute Route = m_Routes[Channel & 0x0F][Control & 0x7F];
+        for (uint32_t Pos = 0; Pos < Route.Count; Pos++) {
+            const sTarget& Target = m_Targets[Route.Target[Pos]];
+            Callback_t pCallback = Target.callback;
+            if (pCallback != nullptr) {
+                pCallback(Control, args..., Target.userData);
+            }
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // True if the controller is routed on at least one channel
+    // -------------------------------------------------------------------------
+    bool isRouted(uint8_t Control) const {
+        if (Control >= MIDI_NB_CONTROLS) return false;
+        for (uint32_t Channel = 0; Channel < MIDI_NB_CHANNELS; Channel++) {
+            if (m_Routes[Channel][Control].Count != 0) return true;
+        }
+        return false;
+    }
+
+    // -------------------------------------------------------------------------
+    // Number of targets in use
+    // -------------------------------------------------------------------------
+    uint32_t getTargetCount() const {
+        uint32_t Count = 0;
+        for (uint32_t Index = 0; Index < NbTargets; Index++) {
+            if (m_Targets[Index].callback != nullptr) Count++;
+        }
+        return Count;
+    }
+
+protected:
+    struct sTarget {
+        Callback_t  callback;           // Function called for the controller
+        uint32_t    userData;           // User-defined data passed to callback
+    };
+
+    struct sRoute {
+        uint8_t     Count;                          // Targets in use
+        uint8_t     Target[MIDI_CC_ROUTE_SIZE];     // Indexes in m_Targets
+    };
+
+    // -------------------------------------------------------------------------
+    // Channels covered by a registration
+    // -------------------------------------------------------------------------
+    static bool getChannelRange(uint8_t Channel, uint32_t& First, uint32_t& Last) {
+        if (Channel == MULTI_CHANNEL) {
+            First = 0;
+            Last = MIDI_NB_CHANNELS - 1;
+        } else if (Channel < MIDI_NB_CHANNELS) {
+            First = Last = Channel;
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    // -------------------------------------------------------------------------
+    // Index of a target, NbTargets if not found
+    // -------------------------------------------------------------------------
+    uint32_t findTarget(uint32_t userData, Callback_t pCallback) const {
+        for (uint32_t Index = 0; Index < NbTargets; Index++) {
+            if ((m_Targets[Index].callback == pCallback) && (m_Targets[Index].userData == userData)) {
+                return Index;
+            }
+        }
+        return NbTargets;
+    }
+
+    // -------------------------------------------------------------------------
+    // Position of a target in an entry, Route.Count if not found
+    // -------------------------------------------------------------------------
+    static uint32_t findInRoute(const sRoute& Route, uint32_t Target) {
+        for (uint32_t Pos = 0; Pos < Route.Count; Pos++) {
+            if (Route.Target[Pos] == Target) return Pos;
+        }
+        return Route.Count;
+    }
+
+    // -------------------------------------------------------------------------
+    // Remove the target at Pos from an entry, free it with its last route
+    // -------------------------------------------------------------------------
+    void unlink(sRoute& Route, uint32_t Pos) {
+        uint32_t Target = Route.Target[Pos];
+        uint32_t Primask = __get_PRIMASK();
+        __disable_irq();
+        for (uint32_t Next = Pos + 1; Next < Route.Count; Next++) {
+            Route.Target[Next - 1] = Route.Target[Next];
+        }
+        Route.Count = Route.Count - 1;
+        if (--m_RefCount[Target] == 0) {
+            m_Targets[Target].callback = nullptr;
+            m_Targets[Target].userData = 0;
+        }
+        __set_PRIMASK(Primask);
+    }
+
+    // =========================================================================
+    // Member variables
+    // =========================================================================
+    sRoute      m_Routes[MIDI_NB_CHANNELS][MIDI_NB_CONTROLS];   // Routing table
+    sTarget     m_Targets[NbTargets];                           // Target pool
+    uint16_t    m_RefCount[NbTargets];                          // Entries using each target
+};
 
 //**********************************************************************************
 // class cMidi
@@ -173,18 +754,40 @@ public:
     }
 
     // -------------------------------------------------------------------------
-    // Process any MIDI messages in the buffer
-    // Should be called regularly from the main loop
+    // Dispatch the MIDI messages forwarded by the audio side to the main loop
+    // callbacks (Should be called regularly from the main loop)
     // -------------------------------------------------------------------------
     void on_GUI_FastUpdate() override;
 
+    // -------------------------------------------------------------------------
+    // Audio block, before its samples are processed: apply the received MIDI
+    // messages at their sample offset (RT callbacks) then forward them to the
+    // main loop
+    // -------------------------------------------------------------------------
+    void on_GUI_RT_ProcessInBlock(const AudioBuffer* pIn, uint32_t NbSamples) override;
+
+    // -------------------------------------------------------------------------
+    // Sample offset in the current block of a message received during the
+    // previous block period
+    // @param TimeStamp - Reception time of the message (CPU cycles)
+    // @param BlockStart - Start of the previous block period (CPU cycles)
+    // @param BlockTime - Duration of the previous block period (CPU cycles)
+    // @param NbSamples - Samples per block
+    // @return Offset in [0, NbSamples - 1]
+    // -------------------------------------------------------------------------
+    static uint32_t getSampleOffset(uint32_t TimeStamp, uint32_t BlockStart, uint32_t BlockTime,
+                                    uint32_t NbSamples);
+
     // -------------------------------------------------------------------------
     // Register a callback for a specific Control Change message
     // @param control - Control Change number (0-127)
     // @param userData - User-defined data to pass to callback
     // @param pCallback - Function to call when this CC is received
+    // @param Channel - MIDI channel (0-15) or MULTI_CHANNEL
+    // @return false if the routing table is full
     // -------------------------------------------------------------------------
-    void addControlChangeCallback(uint8_t control, uint32_t userData, ControlChangeCallback pCallback);
+    bool addControlChangeCallback(uint8_t control, uint32_t userData, ControlChangeCallback pCallback,
+                                  uint8_t Channel = MULTI_CHANNEL);
 
     // -------------------------------------------------------------------------
     // Remove a previously registered Control Change callback
@@ -192,12 +795,51 @@ public:
     // -------------------------------------------------------------------------
     void removeControlChangeCallback(ControlChangeCallback pCallback);
 
+    // -------------------------------------------------------------------------
+    // Remove one Control Change route
+    // @param control - Control Change number (0-127)
+    // @param userData - User data given at registration
+    // @param pCallback - The callback function to remove
+    // @param Channel - MIDI channel (0-15) or MULTI_CHANNEL
+    // -------------------------------------------------------------------------
+    void removeControlChangeCallback(uint8_t control, uint32_t userData, ControlChangeCallback pCallback,
+                                     uint8_t Channel = MULTI_CHANNEL);
+
+    // -------------------------------------------------------------------------
+    // Register a Control Change callback called in the audio block
+    // The callback receives the sample offset of the message in the block
+    // @param control - Control Change number (0-127)
+    // @param userData - User-defined data to pass to callback
+    // @param pCallback - Function to call when this CC is received
+    // @param Channel - MIDI channel (0-15) or MULTI_CHANNEL
+    // @return false if the routing table is full
+    // -------------------------------------------------------------------------
+    bool addRTControlChangeCallback(uint8_t control, uint32_t userData, RTControlChangeCallback pCallback,
+                                    uint8_t Channel = MULTI_CHANNEL);
+
+    // -------------------------------------------------------------------------
+    // Remove a previously registered audio block Control Change callback
+    // @param pCallback - The callback function to remove
+    // -------------------------------------------------------------------------
+    void removeRTControlChangeCallback(RTControlChangeCallback pCallback);
+
+    // -------------------------------------------------------------------------
+    // Remove one audio block Control Change route
+    // @param control - Control Change number (0-127)
+    // @param userData - User data given at registration
+    // @param pCallback - The callback function to remove
+    // @param Channel - MIDI channel (0-15) or MULTI_CHANNEL
+    // -------------------------------------------------------------------------
+    void removeRTControlChangeCallback(uint8_t control, uint32_t userData, RTControlChangeCallback pCallback,
+                                       uint8_t Channel = MULTI_CHANNEL);
+
     // -------------------------------------------------------------------------
     // Register a callback for a specific Program Change message
     // @param userData - User-defined data to pass to callback
     // @param pCallback - Function to call when this PC is received
+    // @return false if MIDI_MAX_PC_CALLBACKS callbacks are registered
     // -------------------------------------------------------------------------
-    void addProgramChangeCallback(uint32_t userData, ProgramChangeCallback pCallback);
+    bool addProgramChangeCallback(uint32_t userData, ProgramChangeCallback pCallback);
 
     // -------------------------------------------------------------------------
     // Remove a previously registered Program Change callback
@@ -209,8 +851,9 @@ public:
     // Register a callback for Note On/Off messages on a specific channel
     // @param userData - User-defined data to pass to callback
     // @param pCallback - Function to call when Note messages are received
+    // @return false if MIDI_MAX_NOTE_CALLBACKS callbacks are registered
     // -------------------------------------------------------------------------
-    void addNoteChangeCallback(uint32_t userData, NoteChangeCallback pCallback);
+    bool addNoteChangeCallback(uint32_t userData, NoteChangeCallback pCallback);
 
     // -------------------------------------------------------------------------
     // Remove a previously registered Note callback
@@ -218,6 +861,116 @@ public:
     // -------------------------------------------------------------------------
     void removeNoteChangeCallback(NoteChangeCallback pCallback);
 
+    // -------------------------------------------------------------------------
+    // Register a callback for a high resolution controller (main loop)
+    // A 14-bit CC pairs controller Number with its LSB (Number + 32) unless
+    // the LSB is itself routed as a Control Change: the callback then gets
+    // the 7-bit values of the MSB (see isCC14Paired)
+    // @param Kind - 14-bit CC (Number 0-31), NRPN or RPN (Number 0-16383)
+    // @param userData - User-defined data to pass to callback
+    // @param pCallback - Function called with the value scaled to 32 bits
+    // @param Channel - MIDI channel (0-15) or MULTI_CHANNEL
+    // @return false if MIDI_MAX_HIGHRES_CALLBACKS callbacks are registered
+    // -------------------------------------------------------------------------
+    bool addHighResCallback(eMidiHighRes Kind, uint16_t Number, uint32_t userData,
+                            HighResControlCallback pCallback, uint8_t Channel = MULTI_CHANNEL);
+
+    // -------------------------------------------------------------------------
+    // Remove a previously registered high resolution callback
+    // @param pCallback - The callback function to remove
+    // -------------------------------------------------------------------------
+    void removeHighResCallback(HighResControlCallback pCallback);
+
+    // -------------------------------------------------------------------------
+    // Register a high resolution controller callback called in the audio block
+    // The callback receives the sample offset of the completing message
+    // -------------------------------------------------------------------------
+    bool addRTHighResCallback(eMidiHighRes Kind, uint16_t Number, uint32_t userData,
+                              RTHighResControlCallback pCallback, uint8_t Channel = MULTI_CHANNEL);
+
+    // -------------------------------------------------------------------------
+    // Remove a previously registered audio block high resolution callback
+    // @param pCallback - The callback function to remove
+    // -------------------------------------------------------------------------
+    void removeRTHighResCallback(RTHighResControlCallback pCallback);
+
+    // -------------------------------------------------------------------------
+    // True if controller Msb (0-31) is assembled with its LSB (Msb + 32)
+    // -------------------------------------------------------------------------
+    inline bool isCC14Paired(uint8_t Msb) const {
+        return (Msb < 32) && (((m_HighRes.getPairs() | m_RTHighRes.getPairs()) & (1UL << Msb)) != 0);
+    }
+
+    // -------------------------------------------------------------------------
+    // MIDI learn
+    // -------------------------------------------------------------------------
+
+    // -------------------------------------------------------------------------
+    // Declare a parameter that can be bound by MIDI learn
+    // The parameter is identified by its serialize ID and its rank among the
+    // parameters of that ID: the key is stable from one boot to the next.
+    // A learned binding of the key is routed at once.
+    // @return false if the table is full or a learned binding is not routed
+    // -------------------------------------------------------------------------
+    bool addLearnableParameter(DadDSP::cParameter* pParameter, uint32_t SerializeID);
+
+    // -------------------------------------------------------------------------
+    // Bind a parameter to the next Control Change received
+    // -------------------------------------------------------------------------
+    void StartLearn(DadDSP::cParameter* pParameter);
+
+    // -------------------------------------------------------------------------
+    // Leave learn mode without binding
+    // -------------------------------------------------------------------------
+    inline void CancelLearn() {
+        m_pLearnParameter = nullptr;
+    }
+
+    // -------------------------------------------------------------------------
+    // Learn mode active
+    // -------------------------------------------------------------------------
+    inline bool isLearning() const {
+        return m_pLearnParameter != nullptr;
+    }
+
+    // -------------------------------------------------------------------------
+    // Learn mode active for this parameter
+    // -------------------------------------------------------------------------
+    inline bool isLearning(const DadDSP::cParameter* pParameter) const {
+        return (pParameter != nullptr) && (m_pLearnParameter == pParameter);
+    }
+
+    // -------------------------------------------------------------------------
+    // Result of the last learn (reset by StartLearn)
+    // -------------------------------------------------------------------------
+    inline eMidiLearn getLearnResult() const {
+        return m_LearnResult;
+    }
+
+    // -------------------------------------------------------------------------
+    // Learned bindings kept but not routed (controller router full)
+    // -------------------------------------------------------------------------
+    inline uint32_t getLearnRouteFailures() const {
+        return m_LearnRouteFailures;
+    }
+
+    // -------------------------------------------------------------------------
+    // Remove the learned binding of a parameter (saved)
+    // -------------------------------------------------------------------------
+    void ForgetLearn(DadDSP::cParameter* pParameter);
+
+    // -------------------------------------------------------------------------
+    // Remove all learned bindings (saved)
+    // -------------------------------------------------------------------------
+    void ClearLearn();
+
+    // -------------------------------------------------------------------------
+    // Number of learned bindings
+    // -------------------------------------------------------------------------
+    inline uint32_t getLearnCount() const {
+        return m_NbLearnBindings;
+    }
+
     // -------------------------------------------------------------------------
     // Handle Note On MIDI messages
     // @param channel - MIDI channel (0-15)
@@ -240,7 +993,7 @@ public:
     // @param control - Control Change number (0-127)
     // @param value - Control value (0-127)
     // -------------------------------------------------------------------------
-    void OnControlChange(uint8_t channel, uint8_t control, uint8_t value) const;
+    void OnControlChange(uint8_t channel, uint8_t control, uint8_t value);
 
     // -------------------------------------------------------------------------
     // Handle Program Change MIDI messages
@@ -261,21 +1014,155 @@ public:
     // @param status - MIDI status byte
     // @param data - Array of data bytes
     // -------------------------------------------------------------------------
-    void parseMessage(uint8_t status, uint8_t* data) const;
+    void parseMessage(uint8_t status, uint8_t* data);
+
+    // -------------------------------------------------------------------------
+    // Number of MIDI events lost because a queue was full
+    // -------------------------------------------------------------------------
+    uint32_t getOverflows() const;
+
+    // -------------------------------------------------------------------------
+    // Ingest statistics per interface (UART, USB)
+    // -------------------------------------------------------------------------
+    uint32_t getOverflows(eMidiSource Source) const;    // Lost, ingest queue full
+    uint32_t getReceived(eMidiSource Source) const;     // Queued
+    uint32_t getIngestHighWater() const;                // Deepest ingest queue fill
+    uint32_t getUartErrors() const;                     // Overrun, framing, noise
+
+#ifdef MONITOR
+    // -------------------------------------------------------------------------
+    // Longest delay between reception and audio block dispatch (CPU cycles)
+    // -------------------------------------------------------------------------
+    inline uint32_t getMaxEventLatency() const {
+        return m_MaxEventLatency;
+    }
+
+    // -------------------------------------------------------------------------
+    // Reset the latency statistic
+    // -------------------------------------------------------------------------
+    inline void resetMaxEventLatency() {
+        m_MaxEventLatency = 0;
+    }
+#endif
+
+    // -------------------------------------------------------------------------
+    // Reception time (DWT cycles) of the message being dispatched, inside a
+    // main loop callback (getEventTimeStamp) or an audio block callback
+    // (getRTEventTimeStamp). Messages are dispatched in batches: the time
+    // between two of them comes from these, not from the callback time.
+    // -------------------------------------------------------------------------
+    inline uint32_t getEventTimeStamp() const {
+        return m_EventTimeStamp;
+    }
+    inline uint32_t getRTEventTimeStamp() const {
+        return m_RTEventTimeStamp;
+    }
+
+    // -------------------------------------------------------------------------
+    // Get the MIDI clock follower (tempo, beat phase, subdivisions)
+    // @return Reference to the clock fed by the UART and USB interfaces
+    // -------------------------------------------------------------------------
+    inline const cMidiClock& getClock() const {
+        return __MidiClock;
+    }
 
 protected:
+    // =========================================================================
+    // Protected Types
+    // =========================================================================
+
+    struct sLearnParameter {
+        DadDSP::cParameter* pParameter;     // Learnable parameter
+        uint32_t            SerializeID;    // Key: serialize ID ...
+        uint8_t             Rank;           // ... and rank among the parameters of that ID
+    };
+
+    struct sLearnBinding {
+        uint32_t            SerializeID;    // Parameter key
+        uint8_t             Rank;
+        uint8_t             Channel;        // Learned channel (0-15)
+        uint8_t             Control;        // Learned Control Change number (0-127)
+    };
+
+    // =========================================================================
+    // Protected Methods
+    // =========================================================================
+
+    // -------------------------------------------------------------------------
+    // Audio stopped: route the received messages to the main loop callbacks
+    // (the audio block callbacks are not called outside the audio interrupt)
+    // -------------------------------------------------------------------------
+    void DrainIngest();
+
+    // -------------------------------------------------------------------------
+    // Bind the parameter in learn mode to a controller and save the bindings
+    // -------------------------------------------------------------------------
+    void Learn(uint8_t channel, uint8_t control);
+
+    // -------------------------------------------------------------------------
+    // Route / unroute a learned binding to its parameter (if declared)
+    // @return false if the controller router is full
+    // -------------------------------------------------------------------------
+    bool RouteBinding(const sLearnBinding& Binding, bool Add);
+
+    // -------------------------------------------------------------------------
+    // Learnable parameter entry of a parameter or of a key, nullptr if unknown
+    // -------------------------------------------------------------------------
+    const sLearnParameter* findLearnParameter(DadDSP::cParameter* pParameter) const;
+    const sLearnParameter* findLearnParameter(uint32_t SerializeID, uint8_t Rank) const;
+
+    // -------------------------------------------------------------------------
+    // Learned bindings persistence
+    // -------------------------------------------------------------------------
+    void LoadLearn();
+    void SaveLearn();
+
+    // -------------------------------------------------------------------------
+    // Pair the controllers 0-31 with a 14-bit CC callback to their LSB, if the
+    // LSB is not routed as a Control Change (after each route change)
+    // -------------------------------------------------------------------------
+    void UpdateCC14Pairs();
+
     // =========================================================================
     // Protected Member Variables
     // =========================================================================
 
     UART_HandleTypeDef*              m_phuart;           // UART interface for MIDI communication
     uint8_t                          m_Channel;          // Current MIDI channel (0-15 or MULTI_CHANNEL)
-    uint8_t                          m_status;           // Current MIDI status byte
-    uint8_t                          m_data[2];          // Data bytes for current message
-    uint8_t                          m_dataIndex;        // Number of data bytes received so far
-    std::vector<CC_CallbackEntry>    m_ccCallbacks;      // Vector of Control Change callbacks
-    std::vector<PC_CallbackEntry>    m_pcCallbacks;      // Vector of Program Change callbacks
-    std::vector<Note_CallbackEntry>  m_noteCallbacks;    // Vector of Note On/Off callbacks
+
+    cMidiCCRouter<ControlChangeCallback, MIDI_CC_MAX_TARGETS>     m_ccRouter;   // Main loop Control Change routes
+    cMidiCCRouter<RTControlChangeCallback, MIDI_RTCC_MAX_TARGETS> m_rtccRouter; // Audio block Control Change routes
+
+    PC_CallbackEntry                 m_pcCallbacks[MIDI_MAX_PC_CALLBACKS];      // Program Change callbacks
+    uint32_t                         m_NbPcCallbacks = 0;
+    Note_CallbackEntry               m_noteCallbacks[MIDI_MAX_NOTE_CALLBACKS];  // Note On/Off callbacks
+    uint32_t                         m_NbNoteCallbacks = 0;
+
+    sLearnParameter                  m_LearnParameters[MIDI_LEARN_MAX_PARAMETERS]; // Learnable parameters
+    uint32_t                         m_NbLearnParameters = 0;
+    sLearnBinding                    m_LearnBindings[MIDI_LEARN_MAX_BINDINGS];  // Learned bindings
+    uint32_t                         m_NbLearnBindings = 0;
+    DadDSP::cParameter*              m_pLearnParameter = nullptr;   // Parameter waiting for a controller
+    bool                             m_LearnLoaded = false;         // Bindings read from storage
+    eMidiLearn                       m_LearnResult = eMidiLearn::None; // Result of the last learn
+    uint32_t                         m_LearnRouteFailures = 0;      // Learned bindings not routed
+
+    cMidiHighResParser               m_HighRes;          // 14-bit CC / NRPN assembly (main loop)
+    cMidiHighResParser               m_RTHighRes;        // 14-bit CC / NRPN assembly (audio block)
+    HighRes_CallbackEntry            m_highResCallbacks[MIDI_MAX_HIGHRES_CALLBACKS];     // High resolution callbacks
+    uint32_t                         m_NbHighResCallbacks = 0;
+    RTHighRes_CallbackEntry          m_rtHighResCallbacks[MIDI_MAX_HIGHRES_CALLBACKS];   // Audio block high resolution callbacks
+    volatile uint32_t                m_NbRTHighResCallbacks = 0;
+
+    uint32_t                         m_LastBlockTime = 0;    // Start time of the previous audio block
+    volatile uint32_t                m_RTBlockCount = 0;     // Audio blocks processed
+    uint32_t                         m_FastUpdateBlockCount = 0; // m_RTBlockCount seen by the last main loop update
+    volatile bool                    m_MainDrain = false;    // The main loop reads the ingest queue
+    uint32_t                         m_EventTimeStamp = 0;   // Message dispatched by the main loop
+    uint32_t                         m_RTEventTimeStamp = 0; // Message dispatched by the audio block
+#ifdef MONITOR
+    volatile uint32_t                m_MaxEventLatency = 0;  // Longest reception to dispatch delay (cycles)
+#endif
 };
 
 } // namespace DadDrivers
@@ -0,0 +1,209 @@
+//==================================================================================
+//==================================================================================
+// File: cMidiClock.h
+// Description: MIDI clock tempo engine
+//              Phase-locks to incoming MIDI real-time clock (24 PPQN) with a
+//              second order delay-locked loop (DLL) and exposes tempo, beat
+//              phase and subdivision phase to the audio effects.
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#pragma once
+
+// =============================================================================
+// Includes
+// =============================================================================
+
+#include "main.h"
+
+// =============================================================================
+// Constants and Definitions
+// =============================================================================
+
+#define MIDI_CLOCK_PPQN             24      // MIDI clock ticks per quarter note
+
+#ifndef MIDI_CLOCK_DLL_BANDWIDTH
+#define MIDI_CLOCK_DLL_BANDWIDTH    0.01f   // DLL bandwidth normalized to the tick rate
+#endif
+
+#ifndef MIDI_CLOCK_LOCK_TICKS
+#define MIDI_CLOCK_LOCK_TICKS       24      // Consecutive in-range ticks before lock
+#endif
+
+#ifndef MIDI_CLOCK_TIMEOUT_MS
+#define MIDI_CLOCK_TIMEOUT_MS       500     // Clock loss timeout (5 BPM)
+#endif
+
+#define MIDI_CLOCK_MIN_BPM          20.0f   // Slowest tempo accepted
+#define MIDI_CLOCK_MAX_BPM          300.0f  // Fastest tempo accepted
+
+// =============================================================================
+// MIDI real-time messages
+// =============================================================================
+
+#define MIDI_RT_CLOCK               0xF8    // Timing clock
+#define MIDI_RT_START               0xFA    // Start
+#define MIDI_RT_CONTINUE            0xFB    // Continue
+#define MIDI_RT_STOP                0xFC    // Stop
+
+namespace DadDrivers {
+
+//**********************************************************************************
+// class cMidiClock
+// MIDI clock follower
+//
+// Ticks are timestamped with the DWT cycle counter in the receiving interrupt
+// (UART or USB). Each tick updates a DLL which filters the transport jitter:
+//     e  = t_tick - t1
+//     t0 = t1
+//     t1 = t1 + b*e + p
+//     p  = p + c*e
+// with w = 2*PI*bandwidth, b = sqrt(2)*w, c = w*w. p is the filtered tick period.
+//
+// The filtered state is published as a double buffered snapshot so readers in
+// the audio interrupt always see a consistent tick time / period pair.
+//**********************************************************************************
+class cMidiClock {
+public:
+    // -------------------------------------------------------------------------
+    // Constructor
+    // -------------------------------------------------------------------------
+    cMidiClock(){}
+
+    // -------------------------------------------------------------------------
+    // Initialize the clock follower (enables the DWT cycle counter)
+    // -------------------------------------------------------------------------
+    void Initialize();
+
+    // -------------------------------------------------------------------------
+    // Reset the DLL and drop the lock
+    // -------------------------------------------------------------------------
+    void Reset();
+
+    // -------------------------------------------------------------------------
+    // Handle a MIDI real-time byte (interrupt context)
+    // @param byte - Real-time status byte (0xF8..0xFF)
+    // @param TimeStamp - DWT cycle count at reception
+    // -------------------------------------------------------------------------
+    void OnRealTime(uint8_t byte, uint32_t TimeStamp);
+
+    // -------------------------------------------------------------------------
+    // Check for clock loss
+    // Should be called regularly from the main loop
+    // -------------------------------------------------------------------------
+    void Update();
+
+    // -------------------------------------------------------------------------
+    // True when the DLL is locked on an incoming clock
+    // -------------------------------------------------------------------------
+    inline bool isLocked() const {
+        return m_pSnapshot->m_Locked;
+    }
+
+    // -------------------------------------------------------------------------
+    // True between Start/Continue and Stop
+    // -------------------------------------------------------------------------
+    inline bool isRunning() const {
+        return m_pSnapshot->m_Running;
+    }
+
+    // -------------------------------------------------------------------------
+    // Tempo in beats per minute (0 if not locked)
+    // -------------------------------------------------------------------------
+    float getBPM() const;
+
+    // -------------------------------------------------------------------------
+    // Quarter note period in seconds (0 if not locked)
+    // -------------------------------------------------------------------------
+    float getBeatPeriod() const;
+
+    // -------------------------------------------------------------------------
+    // Phase [0, 1) inside a cycle of NbBeats quarter notes
+    // @param NbBeats - Cycle length in quarter notes (1 = beat, 0.5 = 1/8, 4 = bar)
+    // @return 0 if not locked
+    // -------------------------------------------------------------------------
+    float getPhase(float NbBeats) const;
+
+    // -------------------------------------------------------------------------
+    // Phase [0, 1) inside the current beat
+    // -------------------------------------------------------------------------
+    inline float getBeatPhase() const {
+        return getPhase(1.0f);
+    }
+
+    // -------------------------------------------------------------------------
+    // Per-sample phase increment of a cycle of NbBeats quarter notes
+    // @param NbBeats - Cycle length in quarter notes
+    // @param SampleRate - Audio sample rate in Hz
+    // -------------------------------------------------------------------------
+    float getPhaseIncrement(float NbBeats, float SampleRate) const;
+
+protected:
+    // =========================================================================
+    // Protected types
+    // =========================================================================
+
+    struct sSnapshot {
+        uint32_t    m_TickTime;         // Filtered time of the last tick (cycles)
+        float       m_TickPeriod;       // Filtered tick period (cycles)
+        uint32_t    m_TickCount;        // Ticks since Start
+        bool        m_Locked;           // DLL locked
+        bool        m_Running;          // Transport running
+    };
+
+    // =========================================================================
+    // Protected Methods
+    // =========================================================================
+
+    // -------------------------------------------------------------------------
+    // Process a timing clock tick
+    // -------------------------------------------------------------------------
+    void OnTick(uint32_t TimeStamp);
+
+    // -------------------------------------------------------------------------
+    // Publish the current state to the readers
+    // -------------------------------------------------------------------------
+    void Publish();
+
+    // -------------------------------------------------------------------------
+    // Elapsed fraction [0, 1) of the current tick
+    // -------------------------------------------------------------------------
+    float getTickFraction(const sSnapshot* pSnap) const;
+
+    // =========================================================================
+    // Protected Member Variables
+    // =========================================================================
+
+    float               m_CyclesPerSecond = 0.0f;   // DWT clock
+    float               m_MinPeriod = 0.0f;         // Shortest tick period accepted (cycles)
+    float               m_MaxPeriod = 0.0f;         // Longest tick period accepted (cycles)
+    uint32_t            m_TimeOut = 0;              // Clock loss timeout (cycles)
+
+    uint32_t            m_LastTimeStamp = 0;        // Raw time of the last tick
+    uint32_t            m_T0 = 0;                   // Filtered time of the last tick
+    uint32_t            m_T1 = 0;                   // Predicted time of the next tick
+    float               m_Period = 0.0f;            // Filtered tick period (cycles)
+    float               m_b = 0.0f;                 // DLL first order coefficient
+    float               m_c = 0.0f;                 // DLL second order coefficient
+    uint32_t            m_TickCount = 0;            // Ticks since Start
+    uint32_t            m_LockCount = 0;            // Consecutive in-range ticks
+    bool                m_HasTimeStamp = false;     // At least one tick received
+    bool                m_DllActive = false;        // DLL initialized on a valid period
+    bool                m_StartPending = false;     // Next tick is the first after Start
+    bool                m_Locked = false;           // DLL locked
+    bool                m_Running = false;          // Transport running
+
+    sSnapshot           m_Snapshot[2];              // Front/back snapshots
+    sSnapshot* volatile m_pSnapshot = &m_Snapshot[0]; // Published snapshot
+};
+
+// =============================================================================
+// Global MIDI clock follower (fed by the UART and USB MIDI interrupts)
+// =============================================================================
+extern cMidiClock __MidiClock;
+
+} // namespace DadDrivers
+
+//***End of file**************************************************************
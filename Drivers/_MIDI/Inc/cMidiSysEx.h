@@ -0,0 +1,299 @@
+//==================================================================================
+//==================================================================================
+// File: cMidiSysEx.h
+// Description: USB-MIDI SysEx dump / restore of the block storage
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#pragma once
+
+// =============================================================================
+// Includes
+// =============================================================================
+
+#include "main.h"
+
+// =============================================================================
+// Constants and Definitions
+// =============================================================================
+
+#ifndef MIDI_SYSEX_CHUNK_SIZE
+#define MIDI_SYSEX_CHUNK_SIZE       256     // Data bytes per DATA / WRITE_DATA message
+#endif
+
+#ifndef MIDI_SYSEX_QUEUE_SIZE
+#define MIDI_SYSEX_QUEUE_SIZE       8       // Received messages waiting for the main loop (power of 2)
+#endif
+
+#define MIDI_SYSEX_VERSION          1       // Protocol version
+
+// Message: F0 7D 44 46 <Cmd> <7-bit packed body + CRC16> F7
+#define MIDI_SYSEX_ID               0x7D    // Non-commercial manufacturer ID
+#define MIDI_SYSEX_ID1              0x44    // 'D'
+#define MIDI_SYSEX_ID2              0x46    // 'F'
+#define MIDI_SYSEX_HEADER_SIZE      4       // ID, ID1, ID2, Cmd
+
+// Largest body: ID + Offset + chunk + CRC16
+#define MIDI_SYSEX_MAX_BODY         (4 + 4 + MIDI_SYSEX_CHUNK_SIZE + 2)
+#define MIDI_SYSEX_PACKED_SIZE(n)   ((n) + (((n) + 6) / 7))
+#define MIDI_SYSEX_MAX_MESSAGE      (MIDI_SYSEX_HEADER_SIZE + MIDI_SYSEX_PACKED_SIZE(MIDI_SYSEX_MAX_BODY))
+
+// -----------------------------------------------------------------------------
+// Commands (host -> device)
+// -----------------------------------------------------------------------------
+#define MIDI_SYSEX_HELLO            0x01    // -> INFO
+#define MIDI_SYSEX_LIST             0x02    // u32 Index -> LIST
+#define MIDI_SYSEX_READ             0x03    // u32 ID, u32 Offset, u16 Length -> DATA
+#define MIDI_SYSEX_WRITE_BEGIN      0x04    // u32 ID, u32 Size -> ACK
+#define MIDI_SYSEX_WRITE_DATA       0x05    // u32 ID, u32 Offset, data -> ACK / NAK (expected offset)
+#define MIDI_SYSEX_WRITE_END        0x06    // u32 ID -> ACK
+#define MIDI_SYSEX_STATUS           0x07    // -> STATUS
+#define MIDI_SYSEX_DELETE           0x08    // u32 ID -> ACK
+#define MIDI_SYSEX_RESTART          0x09    // -> ACK, then system reset
+#define MIDI_SYSEX_BOOT             0x0A    // -> BOOT (boot profile)
+#define MIDI_SYSEX_BENCH            0x0B    // u32 Index -> BENCH (on-target probes, MONITOR builds; NAK otherwise), Index 0 runs them
+
+// -----------------------------------------------------------------------------
+// Replies (device -> host)
+// -----------------------------------------------------------------------------
+#define MIDI_SYSEX_INFO             0x41    // u8 Version, u16 Chunk, u8 Window, u32 NbBlocks, u32 BlockDataSize
+#define MIDI_SYSEX_LIST_REPLY       0x42    // u32 NextIndex (0xFFFFFFFF: end), u8 Count, Count x (u32 ID, u32 Size)
+#define MIDI_SYSEX_DATA             0x43    // u32 ID, u32 Offset, data
+#define MIDI_SYSEX_STATUS_REPLY     0x47    // u8 Active, u32 ID, u32 Offset, u32 Size
+#define MIDI_SYSEX_BOOT_REPLY       0x48    // u32 CoreClock, u32 TotalCycles, u8 Count, Count x (char Name[12], u32 Cycles)
+#define MIDI_SYSEX_BENCH_REPLY      0x49    // u32 NextIndex (0xFFFFFFFF: end), u8 Count, Count x (char Name[12], i32 Value x 100)
+#define MIDI_SYSEX_ACK              0x7E    // u8 Cmd, u32 ID, u32 Offset
+#define MIDI_SYSEX_NAK              0x7F    // u8 Cmd, u8 Error, u32 ID, u32 Offset
+
+// -----------------------------------------------------------------------------
+// NAK errors
+// -----------------------------------------------------------------------------
+#define MIDI_SYSEX_ERR_CRC          0x01    // Message corrupted
+#define MIDI_SYSEX_ERR_OFFSET       0x02    // Unexpected offset: resume at the NAK offset
+#define MIDI_SYSEX_ERR_STATE        0x03    // No save in progress / other save
+#define MIDI_SYSEX_ERR_STORAGE      0x04    // Flash full or write failure
+#define MIDI_SYSEX_ERR_COMMAND      0x05    // Unknown command
+#define MIDI_SYSEX_ERR_TRANSFER     0x06    // Reply cut by the USB transport: request it again
+
+#define MIDI_SYSEX_LIST_MAX         16      // Entries per LIST reply
+
+//**********************************************************************************
+// UsbMidiSysExCallback
+// SysEx USB-MIDI event (CIN 0x04 - 0x07) received on the USB bus
+//**********************************************************************************
+
+extern "C" {
+void UsbMidiSysExCallback(uint8_t code, uint8_t byte0, uint8_t byte1, uint8_t byte2);
+}
+
+namespace DadDrivers {
+
+// Function sending a complete SysEx message (F0 ... F7)
+using SysExSendFunction = bool (*)(const uint8_t* pData, uint32_t Length);
+
+#ifdef MONITOR
+// Cycle probe of a module, run by BENCH with the audio suspended
+using BenchProbeFunction = float (*)(uint32_t CallbackUserData);
+#endif
+
+//**********************************************************************************
+// class cSysExCodec
+// 7-bit packing and CRC of the SysEx messages.
+// Packing: every group of up to 7 bytes is sent as one byte holding their
+// MSBs (bit i for byte i) followed by the 7 low bits of each byte.
+//**********************************************************************************
+class cSysExCodec {
+public:
+    // -------------------------------------------------------------------------
+    // Pack Length bytes, returns the packed size
+    // -------------------------------------------------------------------------
+    static uint32_t Pack(const uint8_t* pIn, uint32_t Length, uint8_t* pOut);
+
+    // -------------------------------------------------------------------------
+    // Unpack Length packed bytes, returns the unpacked size
+    // -------------------------------------------------------------------------
+    static uint32_t Unpack(const uint8_t* pIn, uint32_t Length, uint8_t* pOut);
+
+    // -------------------------------------------------------------------------
+    // CRC-16/CCITT (polynomial 0x1021, initial value 0xFFFF)
+    // -------------------------------------------------------------------------
+    static uint16_t Crc16(const uint8_t* pData, uint32_t Length, uint16_t Crc = 0xFFFF);
+
+    // -------------------------------------------------------------------------
+    // Build F0 <header> <Cmd> <packed body + CRC> F7 in pOut
+    // (room: MIDI_SYSEX_MAX_MESSAGE + 2), returns the message size
+    // -------------------------------------------------------------------------
+    static uint32_t Build(uint8_t Cmd, const uint8_t* pBody, uint32_t BodySize, uint8_t* pOut);
+
+    // -------------------------------------------------------------------------
+    // Check the header and CRC of a message (bytes between F0 and F7)
+    // Unpacks the body in pBody (room: MIDI_SYSEX_MAX_BODY)
+    // @return false if the message is not ours or corrupted (Cmd still set
+    //         when the header is ours)
+    // -------------------------------------------------------------------------
+    static bool Parse(const uint8_t* pMessage, uint32_t Length, uint8_t& Cmd,
+                      uint8_t* pBody, uint32_t& BodySize);
+
+    // -------------------------------------------------------------------------
+    // Little endian fields
+    // -------------------------------------------------------------------------
+    static inline void Put32(uint8_t* p, uint32_t Value) {
+        p[0] = Value & 0xFF; p[1] = (Value >> 8) & 0xFF; p[2] = (Value >> 16) & 0xFF; p[3] = Value >> 24;
+    }
+    static inline uint32_t Get32(const uint8_t* p) {
+        return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    }
+    static inline void Put16(uint8_t* p, uint16_t Value) {
+        p[0] = Value & 0xFF; p[1] = Value >> 8;
+    }
+    static inline uint16_t Get16(const uint8_t* p) {
+        return p[0] | (p[1] << 8);
+    }
+};
+
+//**********************************************************************************
+// class cSysExQueue
+// Lock-free single producer / single consumer queue of SysEx messages
+// (bytes between F0 and F7). The USB interrupt assembles the message in the
+// head slot and commits it on F7; a message arriving on a full queue is lost.
+//**********************************************************************************
+class cSysExQueue {
+public:
+    // -------------------------------------------------------------------------
+    // Producer: one SysEx byte (F0 starts, F7 commits)
+    // -------------------------------------------------------------------------
+    void PushByte(uint8_t Byte);
+
+    // -------------------------------------------------------------------------
+    // Consumer: oldest complete message, nullptr if none
+    // -------------------------------------------------------------------------
+    inline const uint8_t* Peek(uint32_t& Length) const {
+        uint32_t Tail = m_Tail;
+        if (Tail == m_Head) return nullptr;
+        __DMB();
+        const sSlot& Slot = m_Slots[Tail & (MIDI_SYSEX_QUEUE_SIZE - 1)];
+        Length = Slot.Length;
+        return Slot.Data;
+    }
+
+    // -------------------------------------------------------------------------
+    // Consumer: release the message returned by Peek
+    // -------------------------------------------------------------------------
+    inline void Pop() {
+        __DMB();
+        m_Tail = m_Tail + 1;
+    }
+
+    // -------------------------------------------------------------------------
+    // Messages lost (queue full or message too long)
+    // -------------------------------------------------------------------------
+    inline uint32_t getOverflows() const { return m_Overflows; }
+
+protected:
+    struct sSlot {
+        uint16_t    Length;
+        uint8_t     Data[MIDI_SYSEX_MAX_MESSAGE];
+    };
+
+    sSlot               m_Slots[MIDI_SYSEX_QUEUE_SIZE];
+    volatile uint32_t   m_Head = 0;             // Committed messages (producer)
+    volatile uint32_t   m_Tail = 0;             // Released messages (consumer)
+    volatile uint32_t   m_Overflows = 0;
+    uint32_t            m_Length = 0;           // Bytes of the message being received
+    bool                m_Receiving = false;    // Between F0 and F7
+    bool                m_Drop = false;         // Current message is dropped
+};
+
+//**********************************************************************************
+// class cMidiSysEx
+// SysEx dump / restore service of the block storage (memory slots included).
+//
+// The host pulls a dump with READ requests and pushes a restore with
+// WRITE_DATA messages, MIDI_SYSEX_CHUNK_SIZE bytes each, both checked by a
+// CRC16. Flow control: the host keeps at most "Window" messages without
+// reply (INFO). Resume: a WRITE_DATA at another offset than expected is
+// NAKed with the expected offset, STATUS gives the save in progress after a
+// host restart, and a dump restarts at any offset. A save is streamed to
+// flash one block at a time and replaces the previous one only when complete.
+//**********************************************************************************
+class cMidiSysEx {
+public:
+    // -------------------------------------------------------------------------
+    // Initialize the service (replies sent on the USB MIDI interface)
+    // -------------------------------------------------------------------------
+    void Initialize();
+
+    // -------------------------------------------------------------------------
+    // USB interrupt: one SysEx USB-MIDI event
+    // -------------------------------------------------------------------------
+    void OnUsbPacket(uint8_t Code, uint8_t Byte0, uint8_t Byte1, uint8_t Byte2);
+
+    // -------------------------------------------------------------------------
+    // Main loop: process the received messages
+    // -------------------------------------------------------------------------
+    void Process();
+
+    // -------------------------------------------------------------------------
+    // Replace the reply transport
+    // -------------------------------------------------------------------------
+    inline void setSender(SysExSendFunction pSend) { m_pSend = pSend; }
+
+    // -------------------------------------------------------------------------
+    // Counters
+    // -------------------------------------------------------------------------
+    inline uint32_t getOverflows() const { return m_Queue.getOverflows(); }
+    inline uint32_t getErrors() const { return m_Errors; }
+
+#ifdef MONITOR
+    // -------------------------------------------------------------------------
+    // Register a cycle probe, reported by BENCH after the framework ones
+    // @return false if the probe table is full
+    // -------------------------------------------------------------------------
+    bool addBenchProbe(const char* pName, BenchProbeFunction pProbe, uint32_t CallbackUserData);
+#endif
+
+protected:
+    // -------------------------------------------------------------------------
+    // Handle one message
+    // -------------------------------------------------------------------------
+    void Handle(const uint8_t* pMessage, uint32_t Length);
+
+    // -------------------------------------------------------------------------
+    // Replies
+    // -------------------------------------------------------------------------
+    void Reply(uint8_t Cmd, const uint8_t* pBody, uint32_t BodySize);
+    void Ack(uint8_t Cmd, uint32_t ID, uint32_t Offset);
+    void Nak(uint8_t Cmd, uint8_t Error, uint32_t ID, uint32_t Offset);
+
+#ifdef MONITOR
+    // -------------------------------------------------------------------------
+    // BENCH: runs the on-target cycle probes in the main loop with the
+    // audio suspended, then replies the results page by page (returns the
+    // reply size)
+    // -------------------------------------------------------------------------
+    void RunBenchmarks();
+    uint32_t BenchPage(uint32_t Index, uint8_t* pReply);
+#endif
+
+    // =========================================================================
+    // Member variables
+    // =========================================================================
+    cSysExQueue         m_Queue;                        // USB interrupt -> main loop
+    SysExSendFunction   m_pSend = nullptr;              // Reply transport
+    uint8_t             m_Body[MIDI_SYSEX_MAX_BODY];    // Unpacked body
+    uint8_t             m_TxMessage[MIDI_SYSEX_MAX_MESSAGE + 2]; // Reply being built
+    uint32_t            m_Errors = 0;                   // Corrupted or refused messages
+    bool                m_RestartPending = false;       // RESTART acknowledged
+    bool                m_TxFailed = false;             // A reply to the current message was cut
+};
+
+// =============================================================================
+// Global SysEx service (fed by the USB MIDI interrupt)
+// =============================================================================
+extern cMidiSysEx __MidiSysEx;
+
+} // namespace DadDrivers
+
+//***End of file**************************************************************
@@ -31,6 +31,9 @@ extern USBD_MIDI_ItfTypeDef USBD_MIDI_fops;  // MIDI interface callbacks
 //**********************************************************************************
 
 uint8_t MIDI_Transmit(uint8_t *buffer, uint16_t length);  // Transmit MIDI data over USB
+uint8_t MIDI_SendSysEx(const uint8_t *pData, uint32_t Length);  // Transmit a SysEx message (F0 ... F7)
+
+#define MIDI_SYSEX_TX_TIMEOUT_MS    100   // Host not reading the IN endpoint
 
 // =============================================================================
 // MIDI USB Code Index Numbers (CIN) definitions
@@ -8,92 +8,127 @@
 //==================================================================================
 
 #include "cMidi.h"
+#include "cMidiClock.h"
+#include "cMidiSysEx.h"
 #include "MainGUI.h"
+#include "ID.h"
+#include "Serialize.h"
+#include "cBlockStorageManager.h"
 
 // =============================================================================
 // Global Variables
 // =============================================================================
 
-// Aligned buffer for DMA + MIDI ring buffer
+// Aligned buffer for DMA
 // NO_CACHE_RAM ensures the buffer is not cached for proper DMA operation
-NO_CACHE_RAM uint8_t __RxData[2];        // DMA receive buffer (double buffered)
-uint8_t __MidiBuffer[MIDI_BUFFER_SIZE];  // Ring buffer to store MIDI bytes
-uint8_t __MidiBufferWriteIndex = 0;      // Write position in the ring buffer
-uint8_t __MidiBufferReadIndex  = 0;      // Read position in the ring buffer
+NO_CACHE_RAM uint8_t __RxData[MIDI_UART_DMA_SIZE]; // DMA receive buffer (circular)
+
+static UART_HandleTypeDef*  __pMidiUart = nullptr;  // UART receiving MIDI
+static uint32_t             __RxPos = 0;            // Next byte of __RxData to parse
+static uint32_t             __ByteCycles = 0;       // Duration of one byte on the wire (CPU cycles)
+static volatile uint32_t    __UartErrors = 0;       // UART errors (overrun, framing, noise)
+
+DadDrivers::cMidiParser      __MidiUartParser;  // UART byte stream parser (UART interrupt)
+DadDrivers::cMidiIngestQueue __MidiIngestQueue; // UART and USB interrupts -> audio block
+DadDrivers::cMidiEventQueue  __MidiMainQueue;   // Audio block -> main loop
+
+extern DadPersistentStorage::cBlockStorageManager __BlockStorageManager; // Read and write data on persistent block storage
 
 // =============================================================================
 // HAL Callback Functions
 // =============================================================================
 
 //**********************************************************************************
-// HAL_UART_RxCpltCallback
-// Called when DMA has filled the second half of __RxData
+// UartMidiByte
+// Parse one byte received on the UART at TimeStamp
 //**********************************************************************************
-void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart){
-    __MidiBuffer[__MidiBufferWriteIndex] = __RxData[1];              // Store byte from second buffer half
-    __MidiBufferWriteIndex = (__MidiBufferWriteIndex + 1) % MIDI_BUFFER_SIZE;  // Increment write index with wrap-around
+static inline void UartMidiByte(uint8_t byte, uint32_t TimeStamp){
+    if (byte >= MIDI_RT_CLOCK) {
+        // Real-time messages go to the clock follower and never enter the parser
+        DadDrivers::__MidiClock.OnRealTime(byte, TimeStamp);
+        return;
+    }
+    DadDrivers::stMidiEvent_t Event;
+    if (__MidiUartParser.Parse(byte, TimeStamp, Event)) {
+        Event.source = DadDrivers::MIDI_SOURCE_UART;
+        __MidiIngestQueue.Push(Event);                               // Complete message for the audio side
+    }
 }
 
 //**********************************************************************************
-// HAL_UART_RxHalfCpltCallback
-// Called when DMA has filled the first half of __RxData
+// StartUartReception
+// Circular DMA reception, event on idle line, half and full buffer
 //**********************************************************************************
-void HAL_UART_RxHalfCpltCallback(UART_HandleTypeDef *huart){
-    __MidiBuffer[__MidiBufferWriteIndex] = __RxData[0];              // Store byte from first buffer half
-    __MidiBufferWriteIndex = (__MidiBufferWriteIndex + 1) % MIDI_BUFFER_SIZE;  // Increment write index with wrap-around
+static void StartUartReception(){
+    __RxPos = 0;
+    HAL_UARTEx_ReceiveToIdle_DMA(__pMidiUart, __RxData, MIDI_UART_DMA_SIZE);
 }
 
 //**********************************************************************************
-// UsbMidiCallback
-// Callback function for handling incoming MIDI events originating from the USB bus.
+// HAL_UARTEx_RxEventCallback
+// Called on idle line (end of a burst) and when DMA reaches the half or the
+// end of __RxData. Size is the DMA position in the buffer.
+// The bytes arrived back to back: each one is time stamped back from now by
+// its distance to the last byte (plus the idle frame on an idle event), so
+// a burst keeps the timing of a byte per interrupt reception.
 //**********************************************************************************
-DadDrivers::cMidiFifo __MidiFifo;
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size){
+    if (huart != __pMidiUart) return;
+    uint32_t Now = DWT->CYCCNT;
+    if (HAL_UARTEx_GetRxEventType(huart) == HAL_UART_RXEVENT_IDLE) {
+        Now -= __ByteCycles;                                         // Line idle for one frame
+    }
 
-void UsbMidiCallback(uint8_t code, uint8_t channel, uint8_t data1, uint8_t data2){
-	DadDrivers::stMidiEvent_t Event;
-	Event.code = code;
-	Event.channel = channel;
-	Event.data1 = data1;
-	Event.data2 = data2;
-	__MidiFifo.Push(& Event);
+    uint32_t End = (Size > MIDI_UART_DMA_SIZE) ? MIDI_UART_DMA_SIZE : Size;
+    if (End < __RxPos) return;                                       // Position lost (restart pending)
+    for (uint32_t Pos = __RxPos; Pos < End; Pos++) {
+        UartMidiByte(__RxData[Pos], Now - (End - 1 - Pos) * __ByteCycles);
+    }
+    __RxPos = (End == MIDI_UART_DMA_SIZE) ? 0 : End;                 // Circular: wrap at the end
 }
 
-namespace DadDrivers {
-
-//**********************************************************************************
-// class cMidiFifo
-// FIFO buffer management for USB MIDI messages.
 //**********************************************************************************
-
-//**********************************************************************************
-// MidiFifoPush
-// Add MIDI event to FIFO buffer (thread-safe)
+// HAL_UART_ErrorCallback
+// Count the error and restart the reception if the HAL stopped it
 //**********************************************************************************
-bool cMidiFifo::Push(const stMidiEvent_t* event) {
-	uint16_t nextHead = (m_midiFifoHead + 1) % MIDI_USB_FIFO_SIZE;
-	if (nextHead == m_midiFifoTail) {
-		return false; // FIFO full
-	}
-	m_midiFifoBuffer[m_midiFifoHead] = *event;
-	m_midiFifoHead = nextHead;
-	m_midiFifoCount++;
-	return true;
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart){
+    if (huart != __pMidiUart) return;
+    __UartErrors = __UartErrors + 1;
+    __MidiUartParser.Reset();                                        // Message in progress is broken
+    if (huart->RxState == HAL_UART_STATE_READY) {
+        StartUartReception();
+    }
 }
 
 //**********************************************************************************
-// Pull
-// get and Remove MIDI event from FIFO buffer
+// UsbMidiCallback
+// Callback function for handling incoming MIDI events originating from the USB bus.
 //**********************************************************************************
-bool cMidiFifo::Pull(stMidiEvent_t* event) {
-	if (m_midiFifoCount == 0) {
-		return false; // FIFO empty
+void UsbMidiCallback(uint8_t code, uint8_t channel, uint8_t data1, uint8_t data2){
+	uint32_t TimeStamp = DWT->CYCCNT;
+	// Single byte real-time messages (status = 0xF0 | channel) go to the clock follower
+	if ((code == MIDI_CIN_SINGLE_BYTE) && ((0xF0 | channel) >= MIDI_RT_CLOCK)) {
+		DadDrivers::__MidiClock.OnRealTime(0xF0 | channel, TimeStamp);
+		return;
+	}
+	// Channel messages only (the CIN is the status type)
+	if ((code < MIDI_CIN_NOTE_OFF) || (code > MIDI_CIN_PITCH_BEND)) {
+		return;
 	}
-	*event = m_midiFifoBuffer[m_midiFifoTail];
-	m_midiFifoTail = (m_midiFifoTail + 1) % MIDI_USB_FIFO_SIZE;
-	m_midiFifoCount--;
-	return true;
+	DadDrivers::stMidiEvent_t Event;
+	Event.timeStamp = TimeStamp;
+	Event.status = (code << 4) | channel;
+	Event.data1 = data1;
+	Event.data2 = data2;
+	Event.source = DadDrivers::MIDI_SOURCE_USB;
+	__MidiIngestQueue.Push(Event);
 }
 
+namespace DadDrivers {
+
+constexpr uint32_t MIDI_LEARN_ID      = BUILD_ID('M','L','R','N');  // Learned bindings identifier
+constexpr uint8_t  MIDI_LEARN_VERSION = 1;                          // Learned bindings format
+
 //**********************************************************************************
 // class cMidi
 // MIDI message parser and event handler with callback registration
@@ -111,80 +146,148 @@ bool cMidiFifo::Pull(stMidiEvent_t* event) {
 void cMidi::Initialize(UART_HandleTypeDef* phuart, uint8_t Channel){
     m_phuart = phuart;                    // Store UART handle pointer
     m_Channel = Channel;                  // Set MIDI channel
-    __MidiBufferWriteIndex = 0;           // Reset buffer indices
-    __MidiBufferReadIndex = 0;
-    m_status = 0;                         // Clear the current MIDI status byte
-    m_dataIndex = 0;                      // Reset data byte counter
-    m_ccCallbacks.clear();                // Clear any existing callbacks
+    __MidiUartParser.Reset();             // Clear the running status
+    m_HighRes.Reset();                    // Clear the 14-bit / NRPN assembly
+    m_RTHighRes.Reset();
+    m_ccRouter.Clear();                   // Clear any existing callbacks
+    UpdateCC14Pairs();
+    __MidiClock.Initialize();             // Reset the MIDI clock follower (enables DWT time stamps)
+    __MidiSysEx.Initialize();             // SysEx dump / restore service
+    m_LastBlockTime = DWT->CYCCNT;
 
     DadGUI::__GUI_EventManager.Subscribe_FastUpdate(this);
+    DadGUI::__GUI_EventManager.Subscribe_RT_ProcessInBlock(this);
 
     // Start DMA reception in circular mode (continuously receives data)
-    HAL_UART_Receive_DMA(phuart, __RxData, 2);
+    __pMidiUart = phuart;
+    __ByteCycles = SystemCoreClock / MIDI_UART_BYTE_RATE;
+    StartUartReception();
 }
 
 // -----------------------------------------------------------------------------
-// Process any MIDI messages in the buffer
-// Should be called regularly from the main loop
+// Dispatch the MIDI messages forwarded by the audio side to the main loop
+// callbacks (Should be called regularly from the main loop)
 // -----------------------------------------------------------------------------
 void cMidi::on_GUI_FastUpdate(){
 
-	// ****************************************************************************
-    // Process all available bytes in the UART buffer
-    while (__MidiBufferReadIndex != __MidiBufferWriteIndex) {
-        uint8_t byte = __MidiBuffer[__MidiBufferReadIndex];  // Get next byte from buffer
-        __MidiBufferReadIndex = (__MidiBufferReadIndex + 1) % MIDI_BUFFER_SIZE;  // Increment read index
+    // ****************************************************************************
+    // Detect MIDI clock loss
+    __MidiClock.Update();
 
-        if (byte & 0x80) {
-            // This is a status byte (MSB set)
-            m_status = byte;              // Store status for current message
-            m_dataIndex = 0;              // Reset data byte counter
-        } else {
-            // This is a data byte (MSB clear)
-            if (m_status == 0) continue;  // Skip if no valid status yet
+    // ****************************************************************************
+    // SysEx dump / restore requests (flash access: main loop only)
+    __MidiSysEx.Process();
 
-            // Store the data byte
-            m_data[m_dataIndex++] = byte;
+    // ****************************************************************************
+    // Learned bindings (storage is ready once the main loop runs)
+    if (!m_LearnLoaded) {
+        LoadLearn();
+    }
 
-            // Check if we have received all expected data bytes for this message
-            uint8_t expected = getDataLength(m_status);
-            if (m_dataIndex >= expected) {
-                parseMessage(m_status, m_data);  // Process the complete MIDI message
-                m_dataIndex = 0;                 // Reset for next message
-            }
+    // ****************************************************************************
+    // No audio block since the previous pass: the main loop takes the ingest
+    // queue over (main loop callbacks only, interrupts enabled). m_MainDrain
+    // makes the audio block skip the queue if it restarts meanwhile; the
+    // second compare catches a block run before the flag was seen.
+    if (m_RTBlockCount == m_FastUpdateBlockCount) {
+        m_MainDrain = true;
+        __DMB();
+        if (m_RTBlockCount == m_FastUpdateBlockCount) {
+            DrainIngest();
         }
+        __DMB();
+        m_MainDrain = false;
     }
+    m_FastUpdateBlockCount = m_RTBlockCount;
 
     // ****************************************************************************
-    // Process all pending MIDI events from the USB FIFO
-    stMidiEvent_t event;
+    // Process all messages forwarded by the audio side (already parsed)
+    stMidiEvent_t Event;
+    while (__MidiMainQueue.Pull(&Event)) {
+        uint8_t Data[2] = {Event.data1, Event.data2};
+        m_EventTimeStamp = Event.timeStamp;
+        parseMessage(Event.status, Data);
+    }
+}
 
-    // Safely pop event from FIFO with interrupts disabled
-    __disable_irq();
-    bool IsNotEmpty = __MidiFifo.Pull(&event);
-    __enable_irq();
-
-    // Process all events in FIFO
-    while (IsNotEmpty) {
-        switch (event.code) {
-            case MIDI_CIN_NOTE_ON :
-                OnNoteOn(event.channel, event.data1, event.data2);
-                break;
-            case MIDI_CIN_NOTE_OFF:
-                OnNoteOff(event.channel, event.data1, event.data2);
-                break;
-            case MIDI_CIN_CONTROL_CHANGE:
-                OnControlChange(event.channel, event.data1, event.data2);
-                break;
-            case MIDI_CIN_PROGRAM_CHANGE:
-                OnProgramChange(event.channel, event.data1);
-                break;
+// -----------------------------------------------------------------------------
+// Audio block, before its samples are processed: apply the received MIDI
+// messages at their sample offset (RT callbacks) then forward them to the
+// main loop
+//
+// RT_ProcessInBlock is sent once per block ahead of the per sample
+// RT_Process events. Messages received during the previous block period
+// are applied in this block at the same relative position: a constant one
+// block latency instead of the main loop polling jitter.
+// -----------------------------------------------------------------------------
+void cMidi::on_GUI_RT_ProcessInBlock(const AudioBuffer* pIn, uint32_t NbSamples){
+    if (m_MainDrain) {
+        // The main loop owns the ingest queue: left for it or the next block
+        m_RTBlockCount = m_RTBlockCount + 1;
+        return;
+    }
+
+    uint32_t Now = DWT->CYCCNT;
+    uint32_t BlockTime = Now - m_LastBlockTime;         // Duration of the previous block period
+
+    for (;;) {
+        // Oldest message (both sources), due before this block
+        const stMidiEvent_t* pEvent = __MidiIngestQueue.Peek();
+        if ((pEvent == nullptr) || (static_cast<int32_t>(pEvent->timeStamp - Now) > 0)) break;
+
+        stMidiEvent_t Event = *pEvent;
+        __MidiIngestQueue.Pop();
+
+        // Sample offset of the message in the block
+        uint32_t SampleOffset = getSampleOffset(Event.timeStamp, m_LastBlockTime, BlockTime, NbSamples);
+        m_RTEventTimeStamp = Event.timeStamp;
+
+#ifdef MONITOR
+        uint32_t Latency = Now - Event.timeStamp;
+        if (Latency > m_MaxEventLatency) m_MaxEventLatency = Latency;
+#endif
+
+        // Audio block callbacks
+        if (((Event.status & 0xF0) == 0xB0) &&
+            (((Event.status & 0x0F) == m_Channel) || (m_Channel == MULTI_CHANNEL))) {
+            m_rtccRouter.Dispatch(Event.status & 0x0F, Event.data1, Event.data2, SampleOffset);
+
+            // High resolution values (parsed only when used on this side)
+            eMidiHighRes Kind;
+            uint16_t Number;
+            uint32_t Value32;
+            if ((m_NbRTHighResCallbacks != 0) &&
+                m_RTHighRes.Parse(Event.status & 0x0F, Event.data1, Event.data2, Kind, Number, Value32)) {
+                for (uint32_t Index = 0; Index < m_NbRTHighResCallbacks; Index++) {
+                    const RTHighRes_CallbackEntry& entry = m_rtHighResCallbacks[Index];
+                    if ((entry.kind == Kind) && (entry.number == Number) &&
+                        ((entry.channel == (Event.status & 0x0F)) || (entry.channel == MULTI_CHANNEL))) {
+                        entry.callback(Number, Value32, SampleOffset, entry.userData);
+                    }
+                }
+            }
         }
 
-        // Get next event with interrupts disabled
-        __disable_irq();
-        IsNotEmpty = __MidiFifo.Pull(&event);
-        __enable_irq();
+        // Main loop callbacks
+        __MidiMainQueue.Push(Event);
+    }
+
+    m_LastBlockTime = Now;
+    m_RTBlockCount = m_RTBlockCount + 1;
+}
+
+// -----------------------------------------------------------------------------
+// Audio stopped: route the received messages to the main loop callbacks
+// (the audio block callbacks are not called outside the audio interrupt)
+// -----------------------------------------------------------------------------
+void cMidi::DrainIngest(){
+    const stMidiEvent_t* pEvent;
+    while ((pEvent = __MidiIngestQueue.Peek()) != nullptr) {
+        stMidiEvent_t Event = *pEvent;
+        __MidiIngestQueue.Pop();
+        uint8_t Data[2] = {Event.data1, Event.data2};
+        m_EventTimeStamp = Event.timeStamp;
+        parseMessage(Event.status, Data);
     }
 }
 
@@ -193,9 +296,13 @@ void cMidi::on_GUI_FastUpdate(){
 // @param control - Control Change number (0-127)
 // @param userData - User-defined data to pass to callback
 // @param pCallback - Function to call when this CC is received
+// @param Channel - MIDI channel (0-15) or MULTI_CHANNEL
 // -----------------------------------------------------------------------------
-void cMidi::addControlChangeCallback(uint8_t control, uint32_t userData, ControlChangeCallback pCallback) {
-    m_ccCallbacks.push_back({control, userData, pCallback});  // Add callback to vector
+bool cMidi::addControlChangeCallback(uint8_t control, uint32_t userData, ControlChangeCallback pCallback,
+                                     uint8_t Channel) {
+    bool Added = m_ccRouter.Add(Channel, control, userData, pCallback);
+    UpdateCC14Pairs();
+    return Added;
 }
 
 // -----------------------------------------------------------------------------
@@ -203,13 +310,93 @@ void cMidi::addControlChangeCallback(uint8_t control, uint32_t userData, Control
 // @param pCallback - The callback function to remove
 // -----------------------------------------------------------------------------
 void cMidi::removeControlChangeCallback(ControlChangeCallback pCallback) {
-    for (auto it = m_ccCallbacks.begin(); it != m_ccCallbacks.end(); ) {
-        if (it->callback == pCallback) {
-            it = m_ccCallbacks.erase(it);
-        } else {
-            ++it;
-        }
-    }
+    m_ccRouter.Remove(pCallback);
+    UpdateCC14Pairs();
+}
+
+// -----------------------------------------------------------------------------
+// Remove one Control Change route
+// @param control - Control Change number (0-127)
+// @param userData - User data given at registration
+// @param pCallback - The callback function to remove
+// @param Channel - MIDI channel (0-15) or MULTI_CHANNEL
+// -----------------------------------------------------------------------------
+void cMidi::removeControlChangeCallback(uint8_t control, uint32_t userData, ControlChangeCallback pCallback,
+                                        uint8_t Channel) {
+    m_ccRouter.Remove(Channel, control, userData, pCallback);
+    UpdateCC14Pairs();
+}
+
+// -----------------------------------------------------------------------------
+// Register a Control Change callback called in the audio block
+// @param control - Control Change number (0-127)
+// @param userData - User-defined data to pass to callback
+// @param pCallback - Function to call when this CC is received
+// @param Channel - MIDI channel (0-15) or MULTI_CHANNEL
+// -----------------------------------------------------------------------------
+bool cMidi::addRTControlChangeCallback(uint8_t control, uint32_t userData, RTControlChangeCallback pCallback,
+                                       uint8_t Channel) {
+    bool Added = m_rtccRouter.Add(Channel, control, userData, pCallback);
+    UpdateCC14Pairs();
+    return Added;
+}
+
+// -----------------------------------------------------------------------------
+// Remove a previously registered audio block Control Change callback
+// @param pCallback - The callback function to remove
+// -----------------------------------------------------------------------------
+void cMidi::removeRTControlChangeCallback(RTControlChangeCallback pCallback) {
+    m_rtccRouter.Remove(pCallback);
+    UpdateCC14Pairs();
+}
+
+// -----------------------------------------------------------------------------
+// Remove one audio block Control Change route
+// @param control - Control Change number (0-127)
+// @param userData - User data given at registration
+// @param pCallback - The callback function to remove
+// @param Channel - MIDI channel (0-15) or MULTI_CHANNEL
+// -----------------------------------------------------------------------------
+void cMidi::removeRTControlChangeCallback(uint8_t control, uint32_t userData, RTControlChangeCallback pCallback,
+                                          uint8_t Channel) {
+    m_rtccRouter.Remove(Channel, control, userData, pCallback);
+    UpdateCC14Pairs();
+}
+
+// -----------------------------------------------------------------------------
+// Number of MIDI events lost because a queue was full
+// -----------------------------------------------------------------------------
+uint32_t cMidi::getOverflows() const {
+    return __MidiIngestQueue.getOverflows() + __MidiMainQueue.getOverflows();
+}
+
+// -----------------------------------------------------------------------------
+// Number of MIDI events received on an interface lost because the ingest
+// queue was full
+// -----------------------------------------------------------------------------
+uint32_t cMidi::getOverflows(eMidiSource Source) const {
+    return __MidiIngestQueue.getOverflows(Source);
+}
+
+// -----------------------------------------------------------------------------
+// Number of MIDI events received on an interface
+// -----------------------------------------------------------------------------
+uint32_t cMidi::getReceived(eMidiSource Source) const {
+    return __MidiIngestQueue.getPushed(Source);
+}
+
+// -----------------------------------------------------------------------------
+// Deepest fill of the ingest queue (sizing check)
+// -----------------------------------------------------------------------------
+uint32_t cMidi::getIngestHighWater() const {
+    return __MidiIngestQueue.getHighWater();
+}
+
+// -----------------------------------------------------------------------------
+// Number of UART reception errors (overrun, framing, noise)
+// -----------------------------------------------------------------------------
+uint32_t cMidi::getUartErrors() const {
+    return __UartErrors;
 }
 
 // -----------------------------------------------------------------------------
@@ -217,8 +404,10 @@ void cMidi::removeControlChangeCallback(ControlChangeCallback pCallback) {
 // @param userData - User-defined data to pass to callback
 // @param pCallback - Function to call when this PC is received
 // -----------------------------------------------------------------------------
-void cMidi::addProgramChangeCallback(uint32_t userData, ProgramChangeCallback pCallback) {
-    m_pcCallbacks.push_back({userData, pCallback});  // Add callback to vector
+bool cMidi::addProgramChangeCallback(uint32_t userData, ProgramChangeCallback pCallback) {
+    if (m_NbPcCallbacks >= MIDI_MAX_PC_CALLBACKS) return false;
+    m_pcCallbacks[m_NbPcCallbacks++] = {userData, pCallback};
+    return true;
 }
 
 // -----------------------------------------------------------------------------
@@ -226,13 +415,13 @@ void cMidi::addProgramChangeCallback(uint32_t userData, ProgramChangeCallback pC
 // @param pCallback - The callback function to remove
 // -----------------------------------------------------------------------------
 void cMidi::removeProgramChangeCallback(ProgramChangeCallback pCallback) {
-    for (auto it = m_pcCallbacks.begin(); it != m_pcCallbacks.end(); ) {
-        if (it->callback == pCallback) {
-            it = m_pcCallbacks.erase(it);
-        } else {
-            ++it;
+    uint32_t Kept = 0;
+    for (uint32_t Index = 0; Index < m_NbPcCallbacks; Index++) {
+        if (m_pcCallbacks[Index].callback != pCallback) {
+            m_pcCallbacks[Kept++] = m_pcCallbacks[Index];
         }
     }
+    m_NbPcCallbacks = Kept;
 }
 
 // -----------------------------------------------------------------------------
@@ -240,8 +429,10 @@ void cMidi::removeProgramChangeCallback(ProgramChangeCallback pCallback) {
 // @param userData - User-defined data to pass to callback
 // @param pCallback - Function to call when Note messages are received
 // -----------------------------------------------------------------------------
-void cMidi::addNoteChangeCallback(uint32_t userData, NoteChangeCallback pCallback) {
-    m_noteCallbacks.push_back({userData, pCallback});  // Add callback to vector
+bool cMidi::addNoteChangeCallback(uint32_t userData, NoteChangeCallback pCallback) {
+    if (m_NbNoteCallbacks >= MIDI_MAX_NOTE_CALLBACKS) return false;
+    m_noteCallbacks[m_NbNoteCallbacks++] = {userData, pCallback};
+    return true;
 }
 
 // -----------------------------------------------------------------------------
@@ -249,13 +440,320 @@ void cMidi::addNoteChangeCallback(uint32_t userData, NoteChangeCallback pCallbac
 // @param pCallback - The callback function to remove
 // -----------------------------------------------------------------------------
 void cMidi::removeNoteChangeCallback(NoteChangeCallback pCallback) {
-    for (auto it = m_noteCallbacks.begin(); it != m_noteCallbacks.end(); ) {
-        if (it->callback == pCallback) {
-            it = m_noteCallbacks.erase(it);
+    uint32_t Kept = 0;
+    for (uint32_t Index = 0; Index < m_NbNoteCallbacks; Index++) {
+        if (m_noteCallbacks[Index].callback != pCallback) {
+            m_noteCallbacks[Kept++] = m_noteCallbacks[Index];
+        }
+    }
+    m_NbNoteCallbacks = Kept;
+}
+
+// -----------------------------------------------------------------------------
+// Register a callback for a high resolution controller (main loop)
+// @param Kind - 14-bit CC (Number 0-31), NRPN or RPN (Number 0-16383)
+// @param userData - User-defined data to pass to callback
+// @param pCallback - Function called with the value scaled to 32 bits
+// @param Channel - MIDI channel (0-15) or MULTI_CHANNEL
+// -----------------------------------------------------------------------------
+bool cMidi::addHighResCallback(eMidiHighRes Kind, uint16_t Number, uint32_t userData,
+                               HighResControlCallback pCallback, uint8_t Channel) {
+    if (m_NbHighResCallbacks >= MIDI_MAX_HIGHRES_CALLBACKS) return false;
+    m_highResCallbacks[m_NbHighResCallbacks++] = {Kind, Channel, Number, userData, pCallback};
+    UpdateCC14Pairs();
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Remove a previously registered high resolution callback
+// @param pCallback - The callback function to remove
+// -----------------------------------------------------------------------------
+void cMidi::removeHighResCallback(HighResControlCallback pCallback) {
+    uint32_t Kept = 0;
+    for (uint32_t Index = 0; Index < m_NbHighResCallbacks; Index++) {
+        if (m_highResCallbacks[Index].callback != pCallback) {
+            m_highResCallbacks[Kept++] = m_highResCallbacks[Index];
+        }
+    }
+    m_NbHighResCallbacks = Kept;
+    UpdateCC14Pairs();
+}
+
+// -----------------------------------------------------------------------------
+// Register a high resolution controller callback called in the audio block
+// The entry is written before the count: the audio block may be running
+// -----------------------------------------------------------------------------
+bool cMidi::addRTHighResCallback(eMidiHighRes Kind, uint16_t Number, uint32_t userData,
+                                 RTHighResControlCallback pCallback, uint8_t Channel) {
+    if (m_NbRTHighResCallbacks >= MIDI_MAX_HIGHRES_CALLBACKS) return false;
+    m_rtHighResCallbacks[m_NbRTHighResCallbacks] = {Kind, Channel, Number, userData, pCallback};
+    __DMB();
+    m_NbRTHighResCallbacks = m_NbRTHighResCallbacks + 1;
+    UpdateCC14Pairs();
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Remove a previously registered audio block high resolution callback
+// @param pCallback - The callback function to remove
+// -----------------------------------------------------------------------------
+void cMidi::removeRTHighResCallback(RTHighResControlCallback pCallback) {
+    uint32_t Primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t Kept = 0;
+    for (uint32_t Index = 0; Index < m_NbRTHighResCallbacks; Index++) {
+        if (m_rtHighResCallbacks[Index].callback != pCallback) {
+            m_rtHighResCallbacks[Kept++] = m_rtHighResCallbacks[Index];
+        }
+    }
+    m_NbRTHighResCallbacks = Kept;
+    __set_PRIMASK(Primask);
+    UpdateCC14Pairs();
+}
+
+// -----------------------------------------------------------------------------
+// Pair the controllers 0-31 with a 14-bit CC callback to their LSB
+// An LSB routed as a Control Change (parameter, learned binding) stays a
+// 7-bit controller: the 14-bit callback then follows the MSB alone
+// -----------------------------------------------------------------------------
+void cMidi::UpdateCC14Pairs() {
+    uint32_t Pairs = 0;
+    uint32_t RTPairs = 0;
+    for (uint32_t Index = 0; Index < m_NbHighResCallbacks; Index++) {
+        const HighRes_CallbackEntry& entry = m_highResCallbacks[Index];
+        if ((entry.kind == eMidiHighRes::CC14) && (entry.number < 32)) Pairs |= (1UL << entry.number);
+    }
+    for (uint32_t Index = 0; Index < m_NbRTHighResCallbacks; Index++) {
+        const RTHighRes_CallbackEntry& entry = m_rtHighResCallbacks[Index];
+        if ((entry.kind == eMidiHighRes::CC14) && (entry.number < 32)) RTPairs |= (1UL << entry.number);
+    }
+    for (uint8_t Msb = 0; Msb < 32; Msb++) {
+        uint8_t Lsb = Msb + 32;
+        if (m_ccRouter.isRouted(Lsb) || m_rtccRouter.isRouted(Lsb)) {
+            Pairs &= ~(1UL << Msb);
+            RTPairs &= ~(1UL << Msb);
+        }
+    }
+    m_HighRes.setPairs(Pairs);
+    m_RTHighRes.setPairs(RTPairs);
+}
+
+// =============================================================================
+// MIDI learn
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+// Declare a parameter that can be bound by MIDI learn
+// @param pParameter - Parameter bound by learn
+// @param SerializeID - Serialize ID of the parameter (first part of the key)
+// -----------------------------------------------------------------------------
+bool cMidi::addLearnableParameter(DadDSP::cParameter* pParameter, uint32_t SerializeID) {
+    if ((pParameter == nullptr) || (m_NbLearnParameters >= MIDI_LEARN_MAX_PARAMETERS)) return false;
+
+    // Rank among the parameters of the same ID (declaration order)
+    uint8_t Rank = 0;
+    for (uint32_t Index = 0; Index < m_NbLearnParameters; Index++) {
+        if (m_LearnParameters[Index].pParameter == pParameter) return true;
+        if (m_LearnParameters[Index].SerializeID == SerializeID) Rank++;
+    }
+    m_LearnParameters[m_NbLearnParameters++] = {pParameter, SerializeID, Rank};
+
+    // Binding already learned (kept if the routing table is full, not routed)
+    bool Routed = true;
+    for (uint32_t Index = 0; Index < m_NbLearnBindings; Index++) {
+        if ((m_LearnBindings[Index].SerializeID == SerializeID) && (m_LearnBindings[Index].Rank == Rank)) {
+            if (!RouteBinding(m_LearnBindings[Index], true)) {
+                m_LearnRouteFailures++;
+                Routed = false;
+            }
+        }
+    }
+    return Routed;
+}
+
+// -----------------------------------------------------------------------------
+// Bind a parameter to the next Control Change received
+// -----------------------------------------------------------------------------
+void cMidi::StartLearn(DadDSP::cParameter* pParameter) {
+    m_pLearnParameter = (findLearnParameter(pParameter) != nullptr) ? pParameter : nullptr;
+    m_LearnResult = eMidiLearn::None;
+}
+
+// -----------------------------------------------------------------------------
+// Remove the learned binding of a parameter (saved)
+// -----------------------------------------------------------------------------
+void cMidi::ForgetLearn(DadDSP::cParameter* pParameter) {
+    const sLearnParameter* pEntry = findLearnParameter(pParameter);
+    if (pEntry == nullptr) return;
+
+    for (uint32_t Index = 0; Index < m_NbLearnBindings; Index++) {
+        sLearnBinding& Binding = m_LearnBindings[Index];
+        if ((Binding.SerializeID == pEntry->SerializeID) && (Binding.Rank == pEntry->Rank)) {
+            RouteBinding(Binding, false);
+            Binding = m_LearnBindings[--m_NbLearnBindings];
+            SaveLearn();
+            return;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Remove all learned bindings (saved)
+// -----------------------------------------------------------------------------
+void cMidi::ClearLearn() {
+    for (uint32_t Index = 0; Index < m_NbLearnBindings; Index++) {
+        RouteBinding(m_LearnBindings[Index], false);
+    }
+    m_NbLearnBindings = 0;
+    m_pLearnParameter = nullptr;
+    SaveLearn();
+}
+
+// -----------------------------------------------------------------------------
+// Bind the parameter in learn mode to a controller and save the bindings
+// A new binding of the parameter replaces the previous one. If the routing
+// table is full, the previous binding is restored and nothing is saved.
+// -----------------------------------------------------------------------------
+void cMidi::Learn(uint8_t channel, uint8_t control) {
+    const sLearnParameter* pEntry = findLearnParameter(m_pLearnParameter);
+    m_pLearnParameter = nullptr;
+    if (pEntry == nullptr) return;
+
+    sLearnBinding* pBinding = nullptr;
+    sLearnBinding Previous = {NO_ID, 0, 0xFF, 0xFF};
+    for (uint32_t Index = 0; Index < m_NbLearnBindings; Index++) {
+        if ((m_LearnBindings[Index].SerializeID == pEntry->SerializeID) &&
+            (m_LearnBindings[Index].Rank == pEntry->Rank)) {
+            pBinding = &m_LearnBindings[Index];
+            Previous = *pBinding;
+            RouteBinding(Previous, false);
+            break;
+        }
+    }
+    bool Replace = (pBinding != nullptr);
+    if (!Replace) {
+        if (m_NbLearnBindings >= MIDI_LEARN_MAX_BINDINGS) {
+            m_LearnResult = eMidiLearn::Failed;
+            return;
+        }
+        pBinding = &m_LearnBindings[m_NbLearnBindings++];
+    }
+
+    *pBinding = {pEntry->SerializeID, pEntry->Rank, channel, control};
+    if (!RouteBinding(*pBinding, true)) {
+        if (Replace) {
+            *pBinding = Previous;
+            RouteBinding(Previous, true);                   // Entry freed above: routed again
         } else {
-            ++it;
+            m_NbLearnBindings--;
+        }
+        m_LearnResult = eMidiLearn::Failed;
+        return;
+    }
+    SaveLearn();
+    m_LearnResult = eMidiLearn::Learned;
+}
+
+// -----------------------------------------------------------------------------
+// Route / unroute a learned binding to its parameter (if declared)
+// The binding is applied by the main loop (parameter smoothing follows)
+// @return false if the controller router is full (nothing routed)
+// -----------------------------------------------------------------------------
+bool cMidi::RouteBinding(const sLearnBinding& Binding, bool Add) {
+    const sLearnParameter* pEntry = findLearnParameter(Binding.SerializeID, Binding.Rank);
+    if (pEntry == nullptr) return true;                     // Routed once the parameter is declared
+
+    uint32_t userData = reinterpret_cast<uint32_t>(pEntry->pParameter);
+    bool Routed = true;
+    if (Add) {
+        Routed = m_ccRouter.Add(Binding.Channel, Binding.Control, userData,
+                                DadDSP::cParameter::MIDIControlChangeCallBack);
+    } else {
+        m_ccRouter.Remove(Binding.Channel, Binding.Control, userData, DadDSP::cParameter::MIDIControlChangeCallBack);
+    }
+    UpdateCC14Pairs();
+    return Routed;
+}
+
+// -----------------------------------------------------------------------------
+// Learnable parameter entry of a parameter, nullptr if unknown
+// -----------------------------------------------------------------------------
+const cMidi::sLearnParameter* cMidi::findLearnParameter(DadDSP::cParameter* pParameter) const {
+    if (pParameter == nullptr) return nullptr;
+    for (uint32_t Index = 0; Index < m_NbLearnParameters; Index++) {
+        if (m_LearnParameters[Index].pParameter == pParameter) return &m_LearnParameters[Index];
+    }
+    return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+// Learnable parameter entry of a key, nullptr if unknown
+// -----------------------------------------------------------------------------
+const cMidi::sLearnParameter* cMidi::findLearnParameter(uint32_t SerializeID, uint8_t Rank) const {
+    for (uint32_t Index = 0; Index < m_NbLearnParameters; Index++) {
+        if ((m_LearnParameters[Index].SerializeID == SerializeID) && (m_LearnParameters[Index].Rank == Rank)) {
+            return &m_LearnParameters[Index];
         }
     }
+    return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+// Read the learned bindings and route those of the declared parameters
+// The bindings are a global block, outside the presets: a preset keeps its
+// layout and a binding follows the parameter whatever the preset.
+// -----------------------------------------------------------------------------
+void cMidi::LoadLearn() {
+    m_LearnLoaded = true;
+    m_NbLearnBindings = 0;
+
+    uint8_t Buffer[2 + (MIDI_LEARN_MAX_BINDINGS * sizeof(sLearnBinding))];
+    uint32_t Size = __BlockStorageManager.getSize(MIDI_LEARN_ID);
+    if ((Size == 0) || (Size > sizeof(Buffer))) return;
+
+    uint32_t LoadSize = 0;
+    __BlockStorageManager.Load(MIDI_LEARN_ID, Buffer, Size, LoadSize);
+    DadPersistentStorage::cSerialize Serializer;
+    Serializer.setBuffer(Buffer, LoadSize);
+
+    uint8_t Version = 0;
+    uint8_t NbBindings = 0;
+    Serializer.Pull(Version);
+    Serializer.Pull(NbBindings);
+    if ((Version != MIDI_LEARN_VERSION) || (NbBindings > MIDI_LEARN_MAX_BINDINGS)) return;
+
+    for (uint32_t Index = 0; Index < NbBindings; Index++) {
+        sLearnBinding Binding = {NO_ID, 0, 0xFF, 0xFF};
+        Serializer.Pull(Binding.SerializeID);
+        Serializer.Pull(Binding.Rank);
+        Serializer.Pull(Binding.Channel);
+        Serializer.Pull(Binding.Control);
+        if ((Binding.Channel >= MIDI_NB_CHANNELS) || (Binding.Control >= MIDI_NB_CONTROLS)) return;
+        m_LearnBindings[m_NbLearnBindings++] = Binding;
+        if (!RouteBinding(Binding, true)) {
+            m_LearnRouteFailures++;                         // Kept (saved back), not routed
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Save the learned bindings
+// -----------------------------------------------------------------------------
+void cMidi::SaveLearn() {
+    DadPersistentStorage::cSerialize Serializer;
+    Serializer.Push(MIDI_LEARN_VERSION);
+    Serializer.Push(static_cast<uint8_t>(m_NbLearnBindings));
+    for (uint32_t Index = 0; Index < m_NbLearnBindings; Index++) {
+        const sLearnBinding& Binding = m_LearnBindings[Index];
+        Serializer.Push(Binding.SerializeID);
+        Serializer.Push(Binding.Rank);
+        Serializer.Push(Binding.Channel);
+        Serializer.Push(Binding.Control);
+    }
+
+    const uint8_t* pBuffer;
+    uint32_t Size = Serializer.getBuffer(&pBuffer);
+    __BlockStorageManager.Save(MIDI_LEARN_ID, pBuffer, Size);
 }
 
 // =============================================================================
@@ -271,7 +769,8 @@ void cMidi::removeNoteChangeCallback(NoteChangeCallback pCallback) {
 void cMidi::OnNoteOn(uint8_t channel, uint8_t note, uint8_t velocity) const {
     // Call all registered callbacks if channel matches
     if((channel == m_Channel) || (m_Channel == MULTI_CHANNEL)){
-        for (auto& entry : m_noteCallbacks) {
+        for (uint32_t Index = 0; Index < m_NbNoteCallbacks; Index++) {
+            const Note_CallbackEntry& entry = m_noteCallbacks[Index];
             entry.callback(1, note, velocity, entry.userData);  // 1 = Note On
         }
     }
@@ -286,7 +785,8 @@ void cMidi::OnNoteOn(uint8_t channel, uint8_t note, uint8_t velocity) const {
 void cMidi::OnNoteOff(uint8_t channel, uint8_t note, uint8_t velocity) const {
     // Call all registered callbacks if channel matches
     if((channel == m_Channel) || (m_Channel == MULTI_CHANNEL)){
-        for (auto& entry : m_noteCallbacks) {
+        for (uint32_t Index = 0; Index < m_NbNoteCallbacks; Index++) {
+            const Note_CallbackEntry& entry = m_noteCallbacks[Index];
             entry.callback(0, note, velocity, entry.userData);  // 0 = Note Off
         }
     }
@@ -298,12 +798,25 @@ void cMidi::OnNoteOff(uint8_t channel, uint8_t note, uint8_t velocity) const {
 // @param control - Control Change number (0-127)
 // @param value - Control value (0-127)
 // -----------------------------------------------------------------------------
-void cMidi::OnControlChange(uint8_t channel, uint8_t control, uint8_t value) const {
-    // Call all registered callbacks for this CC number if channel matches
+void cMidi::OnControlChange(uint8_t channel, uint8_t control, uint8_t value) {
+    // Call the callbacks routed to this channel and CC number if channel matches
     if((channel == m_Channel) || (m_Channel == MULTI_CHANNEL)){
-        for (auto& entry : m_ccCallbacks) {
-            if (entry.control == control) {
-                entry.callback(control, value, entry.userData);  // Pass value and user data
+        if (m_pLearnParameter != nullptr) {
+            Learn(channel, control);                         // The value below moves the parameter
+        }
+        m_ccRouter.Dispatch(channel, control, value);        // Pass value and user data
+
+        // High resolution values (parsed only when used on this side)
+        eMidiHighRes Kind;
+        uint16_t Number;
+        uint32_t Value32;
+        if ((m_NbHighResCallbacks != 0) && m_HighRes.Parse(channel, control, value, Kind, Number, Value32)) {
+            for (uint32_t Index = 0; Index < m_NbHighResCallbacks; Index++) {
+                const HighRes_CallbackEntry& entry = m_highResCallbacks[Index];
+                if ((entry.kind == Kind) && (entry.number == Number) &&
+                    ((entry.channel == channel) || (entry.channel == MULTI_CHANNEL))) {
+                    entry.callback(Number, Value32, entry.userData);
+                }
             }
         }
     }
@@ -317,7 +830,8 @@ void cMidi::OnControlChange(uint8_t channel, uint8_t control, uint8_t value) con
 void cMidi::OnProgramChange(uint8_t channel, uint8_t program) const {
     // Call all registered callbacks if channel matches
     if((channel == m_Channel) || (m_Channel == MULTI_CHANNEL)){
-        for (auto& entry : m_pcCallbacks) {
+        for (uint32_t Index = 0; Index < m_NbPcCallbacks; Index++) {
+            const PC_CallbackEntry& entry = m_pcCallbacks[Index];
             entry.callback(program, entry.userData);  // Pass program and user data
         }
     }
@@ -333,13 +847,7 @@ void cMidi::OnProgramChange(uint8_t channel, uint8_t program) const {
 // @return Number of data bytes (1 or 2)
 // -----------------------------------------------------------------------------
 uint8_t cMidi::getDataLength(uint8_t status) const {
-    switch (status & 0xF0) {
-        case 0xC0:  // Program Change
-        case 0xD0:  // Channel Pressure (Aftertouch)
-            return 1;  // Single data byte messages
-        default:      // All other message types (Note On/Off, CC, etc.)
-            return 2;  // Two data byte messages
-    }
+    return cMidiParser::getDataLength(status);
 }
 
 // -----------------------------------------------------------------------------
@@ -347,7 +855,7 @@ uint8_t cMidi::getDataLength(uint8_t status) const {
 // @param status - MIDI status byte
 // @param data - Array of data bytes
 // -----------------------------------------------------------------------------
-void cMidi::parseMessage(uint8_t status, uint8_t* data) const {
+void cMidi::parseMessage(uint8_t status, uint8_t* data) {
     uint8_t type = (status >> 4 ) & 0x0F; // Extract message type (Note On, CC, etc.)
     uint8_t channel = status & 0x0F;     // Extract MIDI channel (0-15)
 
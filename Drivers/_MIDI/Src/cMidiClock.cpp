@@ -0,0 +1,232 @@
+//==================================================================================
+//==================================================================================
+// File: cMidiClock.cpp
+// Description: MIDI clock tempo engine
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "cMidiClock.h"
+#include "cMonitor.h"
+#include <cmath>
+
+namespace DadDrivers {
+
+// =============================================================================
+// Global Variables
+// =============================================================================
+
+cMidiClock __MidiClock;
+
+//**********************************************************************************
+// class cMidiClock
+// MIDI clock follower
+//**********************************************************************************
+
+// =============================================================================
+// Public Methods
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+// Initialize the clock follower (enables the DWT cycle counter)
+// -----------------------------------------------------------------------------
+void cMidiClock::Initialize(){
+    DadUtilities::cMonitor::initDWT();                      // Time stamps use DWT->CYCCNT
+
+    m_CyclesPerSecond = (float) SystemCoreClock;
+    m_MinPeriod = (m_CyclesPerSecond * 60.0f) / (MIDI_CLOCK_MAX_BPM * MIDI_CLOCK_PPQN);
+    m_MaxPeriod = (m_CyclesPerSecond * 60.0f) / (MIDI_CLOCK_MIN_BPM * MIDI_CLOCK_PPQN);
+    m_TimeOut = (SystemCoreClock / 1000) * MIDI_CLOCK_TIMEOUT_MS;
+
+    // DLL coefficients (critically damped second order loop)
+    float w = 2.0f * M_PI * MIDI_CLOCK_DLL_BANDWIDTH;
+    m_b = 1.41421356f * w;
+    m_c = w * w;
+
+    Reset();
+}
+
+// -----------------------------------------------------------------------------
+// Reset the DLL and drop the lock
+// -----------------------------------------------------------------------------
+void cMidiClock::Reset(){
+    m_HasTimeStamp = false;
+    m_DllActive = false;
+    m_StartPending = false;
+    m_Locked = false;
+    m_Running = false;
+    m_LockCount = 0;
+    m_TickCount = 0;
+    m_Period = 0.0f;
+    Publish();
+}
+
+// -----------------------------------------------------------------------------
+// Handle a MIDI real-time byte (interrupt context)
+// @param byte - Real-time status byte (0xF8..0xFF)
+// @param TimeStamp - DWT cycle count at reception
+// -----------------------------------------------------------------------------
+void cMidiClock::OnRealTime(uint8_t byte, uint32_t TimeStamp){
+    switch (byte) {
+        case MIDI_RT_CLOCK:
+            OnTick(TimeStamp);
+            break;
+        case MIDI_RT_START:
+            m_TickCount = 0;                    // Song position back to the downbeat
+            m_StartPending = true;              // The next tick is the downbeat
+            m_Running = true;
+            break;
+        case MIDI_RT_CONTINUE:
+            m_Running = true;
+            break;
+        case MIDI_RT_STOP:
+            m_Running = false;
+            break;
+        default:                                // Active sensing, reset: ignored
+            return;
+    }
+    Publish();
+}
+
+// -----------------------------------------------------------------------------
+// Check for clock loss
+// Should be called regularly from the main loop
+// -----------------------------------------------------------------------------
+void cMidiClock::Update(){
+    __disable_irq();
+    if (m_HasTimeStamp && ((DWT->CYCCNT - m_LastTimeStamp) > m_TimeOut)) {
+        Reset();                                // No tick for too long: unlock
+    }
+    __enable_irq();
+}
+
+// -----------------------------------------------------------------------------
+// Tempo in beats per minute (0 if not locked)
+// -----------------------------------------------------------------------------
+float cMidiClock::getBPM() const {
+    const sSnapshot* pSnap = m_pSnapshot;
+    if (!pSnap->m_Locked) return 0.0f;
+    return (60.0f * m_CyclesPerSecond) / (pSnap->m_TickPeriod * MIDI_CLOCK_PPQN);
+}
+
+// -----------------------------------------------------------------------------
+// Quarter note period in seconds (0 if not locked)
+// -----------------------------------------------------------------------------
+float cMidiClock::getBeatPeriod() const {
+    const sSnapshot* pSnap = m_pSnapshot;
+    if (!pSnap->m_Locked) return 0.0f;
+    return (pSnap->m_TickPeriod * MIDI_CLOCK_PPQN) / m_CyclesPerSecond;
+}
+
+// -----------------------------------------------------------------------------
+// Phase [0, 1) inside a cycle of NbBeats quarter notes
+// @param NbBeats - Cycle length in quarter notes (1 = beat, 0.5 = 1/8, 4 = bar)
+// @return 0 if not locked
+// -----------------------------------------------------------------------------
+float cMidiClock::getPhase(float NbBeats) const {
+    const sSnapshot* pSnap = m_pSnapshot;
+    if (!pSnap->m_Locked || (NbBeats <= 0.0f)) return 0.0f;
+
+    // Whole ticks are reduced modulo the cycle length to keep float precision
+    float CycleTicks = NbBeats * MIDI_CLOCK_PPQN;
+    uint32_t Cycle = static_cast<uint32_t>(CycleTicks + 0.5f);
+    if (Cycle == 0) Cycle = 1;
+
+    float Ticks = static_cast<float>(pSnap->m_TickCount % Cycle) + getTickFraction(pSnap);
+    float Phase = Ticks / CycleTicks;
+    return Phase - floorf(Phase);
+}
+
+// -----------------------------------------------------------------------------
+// Per-sample phase increment of a cycle of NbBeats quarter notes
+// @param NbBeats - Cycle length in quarter notes
+// @param SampleRate - Audio sample rate in Hz
+// -----------------------------------------------------------------------------
+float cMidiClock::getPhaseIncrement(float NbBeats, float SampleRate) const {
+    const sSnapshot* pSnap = m_pSnapshot;
+    if (!pSnap->m_Locked || (NbBeats <= 0.0f)) return 0.0f;
+    return m_CyclesPerSecond / (pSnap->m_TickPeriod * MIDI_CLOCK_PPQN * NbBeats * SampleRate);
+}
+
+// =============================================================================
+// Protected Methods
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+// Process a timing clock tick
+// -----------------------------------------------------------------------------
+void cMidiClock::OnTick(uint32_t TimeStamp){
+    uint32_t Interval = TimeStamp - m_LastTimeStamp;    // Raw tick interval
+    bool HadTimeStamp = m_HasTimeStamp;
+    m_LastTimeStamp = TimeStamp;
+    m_HasTimeStamp = true;
+
+    // Song position
+    if (m_StartPending) {
+        m_StartPending = false;
+    } else {
+        m_TickCount++;
+    }
+
+    if (!HadTimeStamp) return;                          // Need two ticks to measure a period
+
+    if (m_DllActive) {
+        float e = static_cast<float>(static_cast<int32_t>(TimeStamp - m_T1));   // Phase error
+        if (fabsf(e) < (0.5f * m_Period)) {
+            // Track: filter the jitter
+            m_T0 = m_T1;
+            m_T1 += static_cast<uint32_t>(static_cast<int32_t>(lrintf((m_b * e) + m_Period)));
+            m_Period += m_c * e;
+            if (!m_Locked && (++m_LockCount >= MIDI_CLOCK_LOCK_TICKS)) {
+                m_Locked = true;
+            }
+            return;
+        }
+        // Tempo jump or lost ticks: restart the loop from the raw interval
+        m_DllActive = false;
+        m_Locked = false;
+    }
+
+    // (Re)start the loop on the measured interval
+    float Period = static_cast<float>(Interval);
+    if ((Period >= m_MinPeriod) && (Period <= m_MaxPeriod)) {
+        m_Period = Period;
+        m_T0 = TimeStamp;
+        m_T1 = TimeStamp + Interval;
+        m_LockCount = 0;
+        m_DllActive = true;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Publish the current state to the readers
+// -----------------------------------------------------------------------------
+void cMidiClock::Publish(){
+    sSnapshot* pBack = (m_pSnapshot == &m_Snapshot[0]) ? &m_Snapshot[1] : &m_Snapshot[0];
+
+    pBack->m_TickTime = m_T0;
+    pBack->m_TickPeriod = m_Period;
+    pBack->m_TickCount = m_TickCount;
+    pBack->m_Locked = m_Locked;
+    pBack->m_Running = m_Running;
+
+    __DMB();                    // Snapshot visible before it is published
+    m_pSnapshot = pBack;
+}
+
+// -----------------------------------------------------------------------------
+// Elapsed fraction [0, 1) of the current tick
+// -----------------------------------------------------------------------------
+float cMidiClock::getTickFraction(const sSnapshot* pSnap) const {
+    int32_t Elapsed = static_cast<int32_t>(DWT->CYCCNT - pSnap->m_TickTime);
+    if (Elapsed <= 0) return 0.0f;
+
+    // Hold at the end of the tick until the next one is received
+    float Fraction = static_cast<float>(Elapsed) / pSnap->m_TickPeriod;
+    return (Fraction < 0.999f) ? Fraction : 0.999f;
+}
+
+} // namespace DadDrivers
+
+//***End of file**************************************************************
@@ -0,0 +1,200 @@
+//==================================================================================
+//==================================================================================
+// File: cMidiParser.cpp
+// Description: Target independent MIDI decoding: running status byte stream,
+//              14-bit CC / NRPN / RPN assembly and audio block sample offsets
+//              (no HAL access, also built by the host tests)
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "cMidi.h"
+
+namespace DadDrivers {
+
+//**********************************************************************************
+// class cMidiParser
+// Running status MIDI byte stream parser (runs in the UART interrupt)
+//**********************************************************************************
+
+//**********************************************************************************
+// Parse
+// Feed one byte (real-time bytes excluded)
+// Returns true when Event holds a complete channel message
+//**********************************************************************************
+bool cMidiParser::Parse(uint8_t byte, uint32_t TimeStamp, stMidiEvent_t& Event) {
+	if (byte & 0x80) {
+		// Status byte: system common and SysEx cancel the running status
+		m_status = (byte < 0xF0) ? byte : 0;
+		m_dataIndex = 0;
+		m_timeStamp = TimeStamp;				// The message starts with its status byte
+		m_statusReceived = true;
+		return false;
+	}
+
+	if (m_status == 0) return false;  			// Skip if no valid status yet
+
+	// Running status: the message starts with its first data byte
+	if ((m_dataIndex == 0) && !m_statusReceived) {
+		m_timeStamp = TimeStamp;
+	}
+	m_statusReceived = false;
+
+	// Store the data byte
+	m_data[m_dataIndex++] = byte;
+
+	// Check if we have received all expected data bytes for this message
+	if (m_dataIndex >= getDataLength(m_status)) {
+		Event.timeStamp = m_timeStamp;
+		Event.status = m_status;
+		Event.data1 = m_data[0];
+		Event.data2 = (m_dataIndex > 1) ? m_data[1] : 0;
+		m_dataIndex = 0;                 		// Reset for next message
+		return true;
+	}
+	return false;
+}
+
+//**********************************************************************************
+// class cMidiHighResParser
+// Assembles 14-bit Control Change pairs and NRPN / RPN data entries
+//**********************************************************************************
+
+constexpr uint8_t MIDI_CC_DATA_ENTRY_MSB = 6;
+constexpr uint8_t MIDI_CC_DATA_ENTRY_LSB = 38;
+constexpr uint8_t MIDI_CC_NRPN_LSB       = 98;
+constexpr uint8_t MIDI_CC_NRPN_MSB       = 99;
+constexpr uint8_t MIDI_CC_RPN_LSB        = 100;
+constexpr uint8_t MIDI_CC_RPN_MSB        = 101;
+
+//**********************************************************************************
+// Reset
+// Forget the MSBs, the selected parameters and the LSB detection
+//**********************************************************************************
+void cMidiHighResParser::Reset() {
+	for (uint32_t Channel = 0; Channel < MIDI_NB_CHANNELS; Channel++) {
+		sChannel& State = m_Channels[Channel];
+		for (uint32_t Control = 0; Control < 32; Control++) State.MSB[Control] = 0;
+		State.LSBSeen = 0;
+		State.ParamMSB = 0;
+		State.ParamLSB = 0;
+		State.DataMSB = 0;
+		State.DataLSBSeen = false;
+		State.ParamSelected = false;
+		State.ParamKind = eMidiHighRes::NRPN;
+	}
+}
+
+//**********************************************************************************
+// Parse
+// Feed a Control Change, returns true when a high resolution value is complete
+//**********************************************************************************
+bool cMidiHighResParser::Parse(uint8_t Channel, uint8_t Control, uint8_t Value,
+                               eMidiHighRes& Kind, uint16_t& Number, uint32_t& Value32) {
+	sChannel& State = m_Channels[Channel & 0x0F];
+
+	switch (Control) {
+	case MIDI_CC_NRPN_MSB:
+	case MIDI_CC_NRPN_LSB:
+	case MIDI_CC_RPN_MSB:
+	case MIDI_CC_RPN_LSB: {
+		// Parameter number selection
+		eMidiHighRes NewKind = (Control >= MIDI_CC_RPN_LSB) ? eMidiHighRes::RPN : eMidiHighRes::NRPN;
+		if (NewKind != State.ParamKind) {
+			State.ParamMSB = 0;
+			State.ParamLSB = 0;
+			State.ParamKind = NewKind;
+		}
+		if ((Control == MIDI_CC_NRPN_MSB) || (Control == MIDI_CC_RPN_MSB)) State.ParamMSB = Value;
+		else State.ParamLSB = Value;
+		// 127/127 is the null parameter: data entry ignored
+		State.ParamSelected = !((State.ParamMSB == 0x7F) && (State.ParamLSB == 0x7F));
+		return false;
+	}
+
+	case MIDI_CC_DATA_ENTRY_MSB:
+		State.DataMSB = Value;
+		if (!State.ParamSelected || State.DataLSBSeen) return false;	// Complete with the LSB
+		Kind = State.ParamKind;
+		Number = (static_cast<uint16_t>(State.ParamMSB) << 7) | State.ParamLSB;
+		Value32 = Upscale(Value, 7);
+		return true;
+
+	case MIDI_CC_DATA_ENTRY_LSB:
+		State.DataLSBSeen = true;
+		if (!State.ParamSelected) return false;
+		Kind = State.ParamKind;
+		Number = (static_cast<uint16_t>(State.ParamMSB) << 7) | State.ParamLSB;
+		Value32 = Upscale((static_cast<uint32_t>(State.DataMSB) << 7) | Value, 14);
+		return true;
+
+	default:
+		break;
+	}
+
+	uint32_t Pairs = m_PairMask;
+	if (Control < 32) {
+		// Controller MSB
+		State.MSB[Control] = Value;
+		if (State.LSBSeen & Pairs & (1UL << Control)) return false;	// Complete with the LSB
+		Kind = eMidiHighRes::CC14;
+		Number = Control;
+		Value32 = Upscale(Value, 7);
+		return true;
+	}
+	if (Control < 64) {
+		// Controller LSB, only if paired (plain 7-bit controller otherwise)
+		uint8_t MSBControl = Control - 32;
+		if ((Pairs & (1UL << MSBControl)) == 0) return false;
+		State.LSBSeen |= (1UL << MSBControl);
+		Kind = eMidiHighRes::CC14;
+		Number = MSBControl;
+		Value32 = Upscale((static_cast<uint32_t>(State.MSB[MSBControl]) << 7) | Value, 14);
+		return true;
+	}
+	return false;
+}
+
+//**********************************************************************************
+// Upscale
+// Scale a 7 or 14-bit value to 32 bits (MIDI 2.0 min-center-max scaling)
+// The lower half is a plain shift, the upper half repeats the value bits
+// below the MSB so that the maximum maps to 0xFFFFFFFF.
+//**********************************************************************************
+uint32_t cMidiHighResParser::Upscale(uint32_t Value, uint8_t Bits) {
+	uint32_t ScaleBits = 32 - Bits;
+	uint32_t Shifted = Value << ScaleBits;
+	if (Value <= (1UL << (Bits - 1))) return Shifted;
+
+	uint32_t RepeatBits = Bits - 1;
+	uint32_t Repeat = Value & ((1UL << RepeatBits) - 1);
+	if (ScaleBits > RepeatBits) Repeat <<= (ScaleBits - RepeatBits);
+	else Repeat >>= (RepeatBits - ScaleBits);
+	while (Repeat != 0) {
+		Shifted |= Repeat;
+		Repeat >>= RepeatBits;
+	}
+	return Shifted;
+}
+
+//**********************************************************************************
+// class cMidi
+// Audio block timing
+//**********************************************************************************
+
+// -----------------------------------------------------------------------------
+// Sample offset in the current block of a message received during the
+// previous block period
+// -----------------------------------------------------------------------------
+uint32_t cMidi::getSampleOffset(uint32_t TimeStamp, uint32_t BlockStart, uint32_t BlockTime,
+                                uint32_t NbSamples){
+    int32_t Age = static_cast<int32_t>(TimeStamp - BlockStart);
+    if ((Age <= 0) || (BlockTime == 0)) return 0;
+    uint32_t SampleOffset = static_cast<uint32_t>((static_cast<float>(Age) * NbSamples) / static_cast<float>(BlockTime));
+    return (SampleOffset < NbSamples) ? SampleOffset : NbSamples - 1;
+}
+
+} // namespace DadDrivers
+
+//***End of file**************************************************************
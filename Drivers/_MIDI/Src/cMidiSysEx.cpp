@@ -0,0 +1,491 @@
+//==================================================================================
+//==================================================================================
+// File: cMidiSysEx.cpp
+// Description: USB-MIDI SysEx dump / restore of the block storage
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "cMidiSysEx.h"
+#include "usbd_midi_if.h"
+#include "cBlockStorageManager.h"
+#include "cBootProfiler.h"
+#include <cstring>
+#ifdef MONITOR
+#include "cParameterScheduler.h"
+#include "cSaturator.h"
+#include "cConvolver.h"
+#include "HardwareDefines.h"
+#include "MainGUI.h"
+#include "AudioManager.h"
+#include "cMidi.h"
+#endif
+
+extern DadPersistentStorage::cBlockStorageManager __BlockStorageManager; // Read and write data on persistent block storage
+
+// =============================================================================
+// HAL Callback Functions
+// =============================================================================
+
+//**********************************************************************************
+// UsbMidiSysExCallback
+// SysEx USB-MIDI event received on the USB bus
+//**********************************************************************************
+void UsbMidiSysExCallback(uint8_t code, uint8_t byte0, uint8_t byte1, uint8_t byte2){
+    DadDrivers::__MidiSysEx.OnUsbPacket(code, byte0, byte1, byte2);
+}
+
+namespace DadDrivers {
+
+// =============================================================================
+// Global Variables
+// =============================================================================
+
+cMidiSysEx __MidiSysEx;
+
+// Messages the host may send without waiting for the replies
+constexpr uint8_t MIDI_SYSEX_WINDOW = MIDI_SYSEX_QUEUE_SIZE - 1;
+
+static_assert((MIDI_SYSEX_QUEUE_SIZE & (MIDI_SYSEX_QUEUE_SIZE - 1)) == 0, "MIDI_SYSEX_QUEUE_SIZE must be a power of 2");
+static_assert(MIDI_SYSEX_MAX_BODY >= (5 + MIDI_SYSEX_LIST_MAX * 8 + 2), "LIST reply larger than a body");
+
+// -----------------------------------------------------------------------------
+// USB reply transport
+// -----------------------------------------------------------------------------
+static bool UsbSend(const uint8_t* pData, uint32_t Length){
+    return MIDI_SendSysEx(pData, Length) == USBD_OK;
+}
+
+//**********************************************************************************
+// class cMidiSysEx
+//**********************************************************************************
+
+// =============================================================================
+// Public Methods
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+// Initialize the service
+// -----------------------------------------------------------------------------
+void cMidiSysEx::Initialize(){
+    m_pSend = UsbSend;
+    m_Errors = 0;
+    m_RestartPending = false;
+}
+
+// -----------------------------------------------------------------------------
+// USB interrupt: one SysEx USB-MIDI event (CIN 4: 3 bytes, 5/6/7: last 1/2/3)
+// -----------------------------------------------------------------------------
+void cMidiSysEx::OnUsbPacket(uint8_t Code, uint8_t Byte0, uint8_t Byte1, uint8_t Byte2){
+    uint32_t Count = (Code == MIDI_CIN_SYSEX_START) ? 3 : (Code - MIDI_CIN_SYSEX_END_1BYTE + 1);
+    m_Queue.PushByte(Byte0);
+    if (Count > 1) m_Queue.PushByte(Byte1);
+    if (Count > 2) m_Queue.PushByte(Byte2);
+}
+
+// -----------------------------------------------------------------------------
+// Main loop: process the received messages
+// -----------------------------------------------------------------------------
+void cMidiSysEx::Process(){
+    uint32_t Length;
+    const uint8_t* pMessage;
+    while ((pMessage = m_Queue.Peek(Length)) != nullptr) {
+        Handle(pMessage, Length);
+        m_Queue.Pop();
+    }
+
+    if (m_RestartPending) {
+        HAL_Delay(20);                                  // Let the ACK leave
+        NVIC_SystemReset();
+    }
+}
+
+// =============================================================================
+// Protected Methods
+// =============================================================================
+
+// -----------------------------------------------------------------------------
+// Handle one message
+// -----------------------------------------------------------------------------
+void cMidiSysEx::Handle(const uint8_t* pMessage, uint32_t Length){
+    uint8_t Cmd = 0;
+    uint32_t BodySize = 0;
+    if (!cSysExCodec::Parse(pMessage, Length, Cmd, m_Body, BodySize)) {
+        if ((Length >= MIDI_SYSEX_HEADER_SIZE) && (pMessage[0] == MIDI_SYSEX_ID) &&
+            (pMessage[1] == MIDI_SYSEX_ID1) && (pMessage[2] == MIDI_SYSEX_ID2)) {
+            // Ours but corrupted: the expected offset lets the host resume
+            m_Errors++;
+            Nak(Cmd, MIDI_SYSEX_ERR_CRC, __BlockStorageManager.getStreamNumber(),
+                __BlockStorageManager.getStreamOffset());
+        }
+        return;
+    }
+
+    uint32_t ID = (BodySize >= 4) ? cSysExCodec::Get32(&m_Body[0]) : NO_ID;
+    uint8_t Reply[MIDI_SYSEX_MAX_BODY];
+    m_TxFailed = false;
+
+    switch (Cmd) {
+    case MIDI_SYSEX_HELLO: {
+        Reply[0] = MIDI_SYSEX_VERSION;
+        cSysExCodec::Put16(&Reply[1], MIDI_SYSEX_CHUNK_SIZE);
+        Reply[3] = MIDI_SYSEX_WINDOW;
+        cSysExCodec::Put32(&Reply[4], DadPersistentStorage::NUM_BLOCKS);
+        cSysExCodec::Put32(&Reply[8], DadPersistentStorage::DATA_SIZE);
+        this->Reply(MIDI_SYSEX_INFO, Reply, 12);
+        break;
+    }
+
+    case MIDI_SYSEX_LIST: {
+        uint32_t Index = (BodySize >= 4) ? cSysExCodec::Get32(&m_Body[0]) : 0;
+        uint32_t Size = 5;
+        uint8_t Count = 0;
+        uint32_t saveNumber, saveSize;
+        while ((Count < MIDI_SYSEX_LIST_MAX) && __BlockStorageManager.getNextSave(Index, saveNumber, saveSize)) {
+            cSysExCodec::Put32(&Reply[Size], saveNumber);
+            cSysExCodec::Put32(&Reply[Size + 4], saveSize);
+            Size += 8;
+            Count++;
+        }
+        bool End = (Count < MIDI_SYSEX_LIST_MAX) || (Index >= DadPersistentStorage::NUM_BLOCKS);
+        cSysExCodec::Put32(&Reply[0], End ? 0xFFFFFFFF : Index);
+        Reply[4] = Count;
+        this->Reply(MIDI_SYSEX_LIST_REPLY, Reply, Size);
+        break;
+    }
+
+    case MIDI_SYSEX_READ: {
+        if (BodySize < 10) {
+            Nak(Cmd, MIDI_SYSEX_ERR_COMMAND, ID, 0);
+            break;
+        }
+        uint32_t Offset = cSysExCodec::Get32(&m_Body[4]);
+        uint32_t ReadSize = cSysExCodec::Get16(&m_Body[8]);
+        if (ReadSize > MIDI_SYSEX_CHUNK_SIZE) ReadSize = MIDI_SYSEX_CHUNK_SIZE;
+        cSysExCodec::Put32(&Reply[0], ID);
+        cSysExCodec::Put32(&Reply[4], Offset);
+        ReadSize = __BlockStorageManager.Read(ID, Offset, &Reply[8], ReadSize);
+        this->Reply(MIDI_SYSEX_DATA, Reply, 8 + ReadSize);      // Empty: end of the save
+        break;
+    }
+
+    case MIDI_SYSEX_WRITE_BEGIN: {
+        if ((BodySize < 8) || !__BlockStorageManager.BeginSave(ID, cSysExCodec::Get32(&m_Body[4]))) {
+            m_Errors++;
+            Nak(Cmd, MIDI_SYSEX_ERR_STORAGE, ID, 0);
+        } else {
+            Ack(Cmd, ID, 0);
+        }
+        break;
+    }
+
+    case MIDI_SYSEX_WRITE_DATA: {
+        uint32_t Expected = __BlockStorageManager.getStreamOffset();
+        if ((BodySize < 8) || !__BlockStorageManager.isSaving() || (ID != __BlockStorageManager.getStreamNumber())) {
+            m_Errors++;
+            Nak(Cmd, MIDI_SYSEX_ERR_STATE, ID, Expected);
+            break;
+        }
+        uint32_t Offset = cSysExCodec::Get32(&m_Body[4]);
+        if (Offset != Expected) {
+            // Lost or repeated chunk: the host resumes at the expected offset
+            // (chunks already in its window arrive NAKed as well)
+            m_Errors++;
+            Nak(Cmd, MIDI_SYSEX_ERR_OFFSET, ID, Expected);
+            break;
+        }
+        if (!__BlockStorageManager.WriteSave(&m_Body[8], BodySize - 8)) {
+            m_Errors++;
+            Nak(Cmd, MIDI_SYSEX_ERR_STORAGE, ID, Expected);
+            break;
+        }
+        Ack(Cmd, ID, __BlockStorageManager.getStreamOffset());
+        break;
+    }
+
+    case MIDI_SYSEX_WRITE_END: {
+        uint32_t Offset = __BlockStorageManager.getStreamOffset();
+        if (!__BlockStorageManager.isSaving() || (ID != __BlockStorageManager.getStreamNumber())) {
+            m_Errors++;
+            Nak(Cmd, MIDI_SYSEX_ERR_STATE, ID, Offset);
+        } else if (!__BlockStorageManager.EndSave()) {
+            m_Errors++;
+            Nak(Cmd, MIDI_SYSEX_ERR_STORAGE, ID, Offset);
+        } else {
+            Ack(Cmd, ID, Offset);
+        }
+        break;
+    }
+
+    case MIDI_SYSEX_STATUS: {
+        Reply[0] = __BlockStorageManager.isSaving() ? 1 : 0;
+        cSysExCodec::Put32(&Reply[1], __BlockStorageManager.getStreamNumber());
+        cSysExCodec::Put32(&Reply[5], __BlockStorageManager.getStreamOffset());
+        cSysExCodec::Put32(&Reply[9], __BlockStorageManager.isSaving() ? __BlockStorageManager.getStreamSize() : 0);
+        this->Reply(MIDI_SYSEX_STATUS_REPLY, Reply, 13);
+        break;
+    }
+
+    case MIDI_SYSEX_DELETE: {
+        if (__BlockStorageManager.isSaving() && (ID == __BlockStorageManager.getStreamNumber())) {
+            __BlockStorageManager.AbortSave();
+        }
+        __BlockStorageManager.Delete(ID);
+        Ack(Cmd, ID, 0);
+        break;
+    }
+
+    case MIDI_SYSEX_RESTART: {
+        __BlockStorageManager.AbortSave();
+        Ack(Cmd, NO_ID, 0);
+        m_RestartPending = true;                        // After the queue is processed
+        break;
+    }
+
+    case MIDI_SYSEX_BOOT: {
+        constexpr uint32_t PhaseSize = BOOT_PROFILER_NAME_SIZE + 4;
+        constexpr uint32_t MaxPhases = (MIDI_SYSEX_MAX_BODY - 9) / PhaseSize;
+        uint32_t Size = 9;
+        uint8_t Count = 0;
+        while ((Count < __BootProfiler.getNbPhases()) && (Count < MaxPhases)) {
+            const DadUtilities::sBootPhase& Phase = __BootProfiler.getPhase(Count);
+            memset(&Reply[Size], 0, BOOT_PROFILER_NAME_SIZE);
+            strncpy(reinterpret_cast<char*>(&Reply[Size]), Phase.pName, BOOT_PROFILER_NAME_SIZE);
+            cSysExCodec::Put32(&Reply[Size + BOOT_PROFILER_NAME_SIZE], Phase.Cycles);
+            Size += PhaseSize;
+            Count++;
+        }
+        cSysExCodec::Put32(&Reply[0], __BootProfiler.getCoreClock());
+        cSysExCodec::Put32(&Reply[4], __BootProfiler.getTotalCycles());
+        Reply[8] = Count;
+        this->Reply(MIDI_SYSEX_BOOT_REPLY, Reply, Size);
+        break;
+    }
+
+#ifdef MONITOR
+    case MIDI_SYSEX_BENCH: {
+        uint32_t Index = (BodySize >= 4) ? cSysExCodec::Get32(&m_Body[0]) : 0;
+        if (Index == 0) RunBenchmarks();                // Following pages: same run
+        uint32_t Size = BenchPage(Index, Reply);
+        this->Reply(MIDI_SYSEX_BENCH_REPLY, Reply, Size);
+        break;
+    }
+#endif
+
+    default:
+        m_Errors++;
+        Nak(Cmd, MIDI_SYSEX_ERR_COMMAND, ID, 0);
+        break;
+    }
+
+    // Reply cut partway (host slow to read the endpoint): a complete NAK
+    // tells the requester to ask again instead of waiting for its time out
+    if (m_TxFailed) {
+        Nak(Cmd, MIDI_SYSEX_ERR_TRANSFER, ID, (BodySize >= 8) ? cSysExCodec::Get32(&m_Body[4]) : 0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Send a reply
+// -----------------------------------------------------------------------------
+void cMidiSysEx::Reply(uint8_t Cmd, const uint8_t* pBody, uint32_t BodySize){
+    uint32_t Size = cSysExCodec::Build(Cmd, pBody, BodySize, m_TxMessage);
+    if ((m_pSend == nullptr) || !m_pSend(m_TxMessage, Size)) {
+        m_Errors++;
+        m_TxFailed = true;                              // Reported once the command is handled
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Acknowledge a command
+// -----------------------------------------------------------------------------
+void cMidiSysEx::Ack(uint8_t Cmd, uint32_t ID, uint32_t Offset){
+    uint8_t Body[9];
+    Body[0] = Cmd;
+    cSysExCodec::Put32(&Body[1], ID);
+    cSysExCodec::Put32(&Body[5], Offset);
+    Reply(MIDI_SYSEX_ACK, Body, sizeof(Body));
+}
+
+// -----------------------------------------------------------------------------
+// Refuse a command
+// -----------------------------------------------------------------------------
+void cMidiSysEx::Nak(uint8_t Cmd, uint8_t Error, uint32_t ID, uint32_t Offset){
+    uint8_t Body[10];
+    Body[0] = Cmd;
+    Body[1] = Error;
+    cSysExCodec::Put32(&Body[2], ID);
+    cSysExCodec::Put32(&Body[6], Offset);
+    Reply(MIDI_SYSEX_NAK, Body, sizeof(Body));
+}
+
+#ifdef MONITOR
+// -----------------------------------------------------------------------------
+// Benchmarks
+// -----------------------------------------------------------------------------
+constexpr uint32_t SYSEX_BENCH_NAME_SIZE = 12;
+constexpr uint32_t SYSEX_BENCH_ENTRY_SIZE = SYSEX_BENCH_NAME_SIZE + 4;
+constexpr uint32_t SYSEX_BENCH_PAGE = (MIDI_SYSEX_MAX_BODY - 5) / SYSEX_BENCH_ENTRY_SIZE;   // Entries per reply
+constexpr uint32_t SYSEX_BENCH_MAX_RESULTS = 48;
+constexpr uint32_t SYSEX_BENCH_MAX_PROBES = 16;
+
+// Results of the last run, read page by page
+struct sBenchResult {
+    const char*     pName;
+    float           Value;
+};
+static sBenchResult __BenchResults[SYSEX_BENCH_MAX_RESULTS];
+static uint32_t     __NbBenchResults = 0;
+
+// Probes registered by the modules (effects...)
+struct sBenchProbe {
+    const char*         pName;
+    BenchProbeFunction  pProbe;
+    uint32_t            CallbackUserData;
+};
+static sBenchProbe  __BenchProbes[SYSEX_BENCH_MAX_PROBES];
+static uint32_t     __NbBenchProbes = 0;
+
+// AudioCallback: blocks timed (1 s of audio)
+constexpr uint32_t SYSEX_BENCH_AUDIO_BLOCKS = static_cast<uint32_t>(SAMPLING_RATE) / AUDIO_BUFFER_SIZE;
+
+// Convolver: IR lengths measured, the longest one sizes the buffers
+constexpr uint32_t SYSEX_BENCH_CONV_PART = 128;
+constexpr uint32_t SYSEX_BENCH_CONV_MAX_IR = 16384;
+constexpr uint32_t SYSEX_BENCH_CONV_PARTS = SYSEX_BENCH_CONV_MAX_IR / SYSEX_BENCH_CONV_PART;
+constexpr uint32_t SYSEX_BENCH_CONV_BLOCKS = 1024;
+using cBenchConvolver = DadDSP::cConvolver<SYSEX_BENCH_CONV_PART>;
+
+SDRAM_SECTION static float __BenchIR[SYSEX_BENCH_CONV_MAX_IR];
+SDRAM_SECTION static float __BenchIRSpectra[cBenchConvolver::getBufferSize(SYSEX_BENCH_CONV_PARTS)];
+SDRAM_SECTION static float __BenchFDL[cBenchConvolver::getBufferSize(SYSEX_BENCH_CONV_PARTS)];
+static cBenchConvolver __BenchConvolver;
+
+// MIDI ingest queue: private, the running interfaces are not touched
+static cMidiIngestQueue __BenchIngest;
+
+// Appends one result of the run
+static void AddBench(const char* pName, float Value){
+    if (__NbBenchResults >= SYSEX_BENCH_MAX_RESULTS) return;
+    __BenchResults[__NbBenchResults].pName = pName;
+    __BenchResults[__NbBenchResults].Value = Value;
+    __NbBenchResults++;
+}
+
+// -----------------------------------------------------------------------------
+// Register a module probe
+// -----------------------------------------------------------------------------
+bool cMidiSysEx::addBenchProbe(const char* pName, BenchProbeFunction pProbe, uint32_t CallbackUserData){
+    if ((pProbe == nullptr) || (__NbBenchProbes >= SYSEX_BENCH_MAX_PROBES)) return false;
+    __BenchProbes[__NbBenchProbes].pName = pName;
+    __BenchProbes[__NbBenchProbes].pProbe = pProbe;
+    __BenchProbes[__NbBenchProbes].CallbackUserData = CallbackUserData;
+    __NbBenchProbes++;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// One page of results (hundredths), from Index
+// -----------------------------------------------------------------------------
+uint32_t cMidiSysEx::BenchPage(uint32_t Index, uint8_t* pReply){
+    uint32_t Size = 5;
+    uint8_t Count = 0;
+    for (; (Count < SYSEX_BENCH_PAGE) && (Index < __NbBenchResults); Index++, Count++) {
+        const sBenchResult& Result = __BenchResults[Index];
+        memset(&pReply[Size], 0, SYSEX_BENCH_NAME_SIZE);
+        strncpy(reinterpret_cast<char*>(&pReply[Size]), Result.pName, SYSEX_BENCH_NAME_SIZE);
+        int32_t Fixed = static_cast<int32_t>(Result.Value * 100.0f + ((Result.Value < 0.0f) ? -0.5f : 0.5f));
+        cSysExCodec::Put32(&pReply[Size + SYSEX_BENCH_NAME_SIZE], static_cast<uint32_t>(Fixed));
+        Size += SYSEX_BENCH_ENTRY_SIZE;
+    }
+    cSysExCodec::Put32(&pReply[0], (Index < __NbBenchResults) ? Index : 0xFFFFFFFF);
+    pReply[4] = Count;
+    return Size;
+}
+
+// -----------------------------------------------------------------------------
+// Runs the probes of the framework then the registered ones. The audio is
+// suspended meanwhile: no interrupt block counted in the probes.
+// -----------------------------------------------------------------------------
+void cMidiSysEx::RunBenchmarks(){
+    __NbBenchResults = 0;
+    SuspendAudio();
+
+    // AudioCallback on silence with the real effect and subscribers, RT event
+    // sends part of it (cycles per audio block)
+    uint32_t Average = 0;
+    uint32_t Max = 0;
+    uint32_t DispatchCycles, DispatchBlocks;
+    DadGUI::__GUI_EventManager.takeRTDispatchStats(DispatchCycles, DispatchBlocks);
+    ProbeAudioCallback(SYSEX_BENCH_AUDIO_BLOCKS, Average, Max);
+    DadGUI::__GUI_EventManager.takeRTDispatchStats(DispatchCycles, DispatchBlocks);
+    AddBench("Audio cb/blk", static_cast<float>(Average));
+    AddBench("RT disp/blk",  (DispatchBlocks != 0) ? static_cast<float>(DispatchCycles) / DispatchBlocks : 0.0f);
+
+    // MIDI ingest queue filled then drained (cycles per event)
+    stMidiEvent_t Event = {0, 0xB0, 1, 0, MIDI_SOURCE_USB};
+    __BenchIngest.Clear();
+    uint32_t Start = DWT->CYCCNT;
+    for (uint32_t Index = 0; Index < MIDI_INGEST_QUEUE_SIZE; Index++) {
+        __BenchIngest.Push(Event);
+    }
+    uint32_t PushCycles = DWT->CYCCNT - Start;
+    Start = DWT->CYCCNT;
+    while (__BenchIngest.Peek() != nullptr) {
+        __BenchIngest.Pop();
+    }
+    uint32_t PopCycles = DWT->CYCCNT - Start;
+    AddBench("Ingest push", static_cast<float>(PushCycles) / MIDI_INGEST_QUEUE_SIZE);
+    AddBench("Ingest pop",  static_cast<float>(PopCycles) / MIDI_INGEST_QUEUE_SIZE);
+
+    // Parameter scheduler against the per-sample fan-out (cycles per dispatch)
+    DadDSP::sParamSchedBenchmark Sched = DadDSP::cParameterScheduler::Benchmark(32);
+    AddBench("Param fanout", Sched.FanOutCycles);
+    AddBench("Sched idle",   Sched.IdleCycles);
+    AddBench("Sched 1 ramp", Sched.OneRampingCycles);
+
+    // Saturator per oversampling factor, heavy drive (cycles per sample)
+    static constexpr struct { DadDSP::eSatOversampling Factor; const char* pName; } SatCases[] = {
+        { DadDSP::eSatOversampling::x1, "Sat x1 c/s" },
+        { DadDSP::eSatOversampling::x2, "Sat x2 c/s" },
+        { DadDSP::eSatOversampling::x4, "Sat x4 c/s" },
+    };
+    for (const auto& Case : SatCases) {
+        AddBench(Case.pName, DadDSP::cSaturator::Benchmark(DadDSP::eSatCurve::Tanh, Case.Factor, 8.0f));
+    }
+
+    // Convolver against IR length (cycles per audio block), decaying noise IR
+    uint32_t Seed = 12345;
+    for (uint32_t i = 0; i < SYSEX_BENCH_CONV_MAX_IR; i++) {
+        Seed = Seed * 1664525UL + 1013904223UL;
+        float Decay = 1.0f - static_cast<float>(i) / SYSEX_BENCH_CONV_MAX_IR;
+        __BenchIR[i] = static_cast<float>(static_cast<int32_t>(Seed)) * (1.0f / 2147483648.0f) * Decay * Decay;
+    }
+    __BenchConvolver.Initialize(__BenchIRSpectra, __BenchFDL, SYSEX_BENCH_CONV_PARTS);
+    static constexpr struct { uint32_t Length; const char* pName; } ConvCases[] = {
+        { 1024,  "Conv 1k avg" },
+        { 4096,  "Conv 4k avg" },
+        { 16384, "Conv 16k avg" },
+    };
+    for (const auto& Case : ConvCases) {
+        __BenchConvolver.LoadIR(__BenchIR, Case.Length);
+        __BenchConvolver.Benchmark(SYSEX_BENCH_CONV_BLOCKS, Average, Max);
+        AddBench(Case.pName, static_cast<float>(Average));
+    }
+    AddBench("Conv 16k max", static_cast<float>(Max));     // Partition block
+    __BenchConvolver.UnloadIR();
+
+    // Module probes
+    for (uint32_t Index = 0; Index < __NbBenchProbes; Index++) {
+        const sBenchProbe& Probe = __BenchProbes[Index];
+        AddBench(Probe.pName, Probe.pProbe(Probe.CallbackUserData));
+    }
+
+    ResumeAudio();
+}
+#endif
+
+} // namespace DadDrivers
+
+//***End of file**************************************************************
@@ -0,0 +1,167 @@
+//==================================================================================
+//==================================================================================
+// File: cSysExCodec.cpp
+// Description: SysEx message codec (7-bit packing, CRC) and receive queue
+//              (no HAL access, also built by the host tests)
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "cMidiSysEx.h"
+#include <cstring>
+
+namespace DadDrivers {
+
+//**********************************************************************************
+// class cSysExCodec
+//**********************************************************************************
+
+// -----------------------------------------------------------------------------
+// Pack Length bytes, returns the packed size
+// -----------------------------------------------------------------------------
+uint32_t cSysExCodec::Pack(const uint8_t* pIn, uint32_t Length, uint8_t* pOut){
+    uint32_t OutSize = 0;
+    for (uint32_t Group = 0; Group < Length; Group += 7) {
+        uint32_t Count = Length - Group;
+        if (Count > 7) Count = 7;
+        uint8_t Msb = 0;
+        for (uint32_t n = 0; n < Count; n++) {
+            Msb |= ((pIn[Group + n] >> 7) & 1) << n;
+        }
+        pOut[OutSize++] = Msb;
+        for (uint32_t n = 0; n < Count; n++) {
+            pOut[OutSize++] = pIn[Group + n] & 0x7F;
+        }
+    }
+    return OutSize;
+}
+
+// -----------------------------------------------------------------------------
+// Unpack Length packed bytes, returns the unpacked size
+// -----------------------------------------------------------------------------
+uint32_t cSysExCodec::Unpack(const uint8_t* pIn, uint32_t Length, uint8_t* pOut){
+    uint32_t OutSize = 0;
+    for (uint32_t Group = 0; Group < Length; Group += 8) {
+        uint8_t Msb = pIn[Group];
+        uint32_t Count = Length - Group - 1;
+        if (Count > 7) Count = 7;
+        for (uint32_t n = 0; n < Count; n++) {
+            pOut[OutSize++] = pIn[Group + 1 + n] | (((Msb >> n) & 1) << 7);
+        }
+    }
+    return OutSize;
+}
+
+// -----------------------------------------------------------------------------
+// CRC-16/CCITT
+// -----------------------------------------------------------------------------
+uint16_t cSysExCodec::Crc16(const uint8_t* pData, uint32_t Length, uint16_t Crc){
+    for (uint32_t i = 0; i < Length; i++) {
+        Crc ^= static_cast<uint16_t>(pData[i]) << 8;
+        for (uint32_t Bit = 0; Bit < 8; Bit++) {
+            Crc = (Crc & 0x8000) ? static_cast<uint16_t>((Crc << 1) ^ 0x1021) : static_cast<uint16_t>(Crc << 1);
+        }
+    }
+    return Crc;
+}
+
+// -----------------------------------------------------------------------------
+// Build F0 <header> <Cmd> <packed body + CRC> F7
+// The CRC covers Cmd and body, it is packed with the body.
+// -----------------------------------------------------------------------------
+uint32_t cSysExCodec::Build(uint8_t Cmd, const uint8_t* pBody, uint32_t BodySize, uint8_t* pOut){
+    uint8_t Crc[2];
+    uint16_t Value = Crc16(&Cmd, 1);
+    Value = Crc16(pBody, BodySize, Value);
+    Put16(Crc, Value);
+
+    uint32_t Size = 0;
+    pOut[Size++] = 0xF0;
+    pOut[Size++] = MIDI_SYSEX_ID;
+    pOut[Size++] = MIDI_SYSEX_ID1;
+    pOut[Size++] = MIDI_SYSEX_ID2;
+    pOut[Size++] = Cmd;
+
+    // Body and CRC packed as one stream: the CRC joins the last group
+    uint32_t Full = (BodySize / 7) * 7;
+    Size += Pack(pBody, Full, &pOut[Size]);
+    uint8_t Tail[9];
+    uint32_t TailSize = BodySize - Full;
+    memcpy(Tail, &pBody[Full], TailSize);
+    Tail[TailSize++] = Crc[0];
+    Tail[TailSize++] = Crc[1];
+    Size += Pack(Tail, TailSize, &pOut[Size]);
+
+    pOut[Size++] = 0xF7;
+    return Size;
+}
+
+// -----------------------------------------------------------------------------
+// Check the header and CRC of a message (bytes between F0 and F7)
+// -----------------------------------------------------------------------------
+bool cSysExCodec::Parse(const uint8_t* pMessage, uint32_t Length, uint8_t& Cmd,
+                        uint8_t* pBody, uint32_t& BodySize){
+    if ((Length < MIDI_SYSEX_HEADER_SIZE) || (pMessage[0] != MIDI_SYSEX_ID) ||
+        (pMessage[1] != MIDI_SYSEX_ID1) || (pMessage[2] != MIDI_SYSEX_ID2)) {
+        return false;                                   // Not ours
+    }
+    Cmd = pMessage[3];
+
+    uint32_t Packed = Length - MIDI_SYSEX_HEADER_SIZE;
+    if (Packed > MIDI_SYSEX_PACKED_SIZE(MIDI_SYSEX_MAX_BODY)) return false;
+    uint32_t Size = Unpack(&pMessage[MIDI_SYSEX_HEADER_SIZE], Packed, pBody);
+    if (Size < 2) return false;
+
+    BodySize = Size - 2;
+    uint16_t Crc = Crc16(&Cmd, 1);
+    Crc = Crc16(pBody, BodySize, Crc);
+    return Crc == Get16(&pBody[BodySize]);
+}
+
+//**********************************************************************************
+// class cSysExQueue
+//**********************************************************************************
+
+// -----------------------------------------------------------------------------
+// Producer: one SysEx byte
+// -----------------------------------------------------------------------------
+void cSysExQueue::PushByte(uint8_t Byte){
+    if (Byte == 0xF0) {
+        // Start: the head slot must be free
+        m_Receiving = true;
+        m_Length = 0;
+        m_Drop = ((m_Head - m_Tail) >= MIDI_SYSEX_QUEUE_SIZE);
+        return;
+    }
+    if (!m_Receiving) return;                           // Continuation of a lost start
+
+    sSlot& Slot = m_Slots[m_Head & (MIDI_SYSEX_QUEUE_SIZE - 1)];
+    if (Byte == 0xF7) {
+        // End: commit
+        m_Receiving = false;
+        if (m_Drop) {
+            m_Overflows = m_Overflows + 1;
+            return;
+        }
+        Slot.Length = static_cast<uint16_t>(m_Length);
+        __DMB();                                        // Message visible before the head
+        m_Head = m_Head + 1;
+        return;
+    }
+    if (Byte & 0x80) {
+        // Any other status byte aborts the message
+        m_Receiving = false;
+        return;
+    }
+    if (m_Drop) return;
+    if (m_Length >= MIDI_SYSEX_MAX_MESSAGE) {
+        m_Drop = true;                                  // Too long
+        return;
+    }
+    Slot.Data[m_Length++] = Byte;
+}
+
+} // namespace DadDrivers
+
+//***End of file**************************************************************
@@ -83,18 +83,13 @@ static int8_t MIDI_DeInit_FS(void)
 // Len: Number of data received (in bytes)
 // Returns: Result of the operation: USBD_OK if all operations are OK else USBD_FAIL
 
-// External callback function wrappers for cMidi class
-extern void OnNoteOn(uint8_t channel, uint8_t note, uint8_t velocity);
-extern void OnNoteOff(uint8_t channel, uint8_t note, uint8_t velocity);
-extern void OnControlChange(uint8_t channel, uint8_t control, uint8_t value);
-extern void OnProgramChange(uint8_t channel, uint8_t program);
-
 extern void UsbMidiCallback(uint8_t code, uint8_t channel, uint8_t data1, uint8_t data2);
+extern void UsbMidiSysExCallback(uint8_t code, uint8_t byte0, uint8_t byte1, uint8_t byte2);
 
 static int8_t MIDI_Receive_FS(uint8_t *Buf, uint32_t Len)
 {
-    // Process received MIDI packets (in blocks of 4 bytes)
-    for (uint32_t i = 0; i < Len; i += 4)
+    // Process every received MIDI packet (in blocks of 4 bytes)
+    for (uint32_t i = 0; i + 3 < Len; i += 4)
     {
         //uint8_t cable = (Buf[i] >> 4) & 0x0F;  // Cable number (unused)
         uint8_t cin = Buf[i] & 0x0F;            // Code Index Number
@@ -103,42 +98,14 @@ static int8_t MIDI_Receive_FS(uint8_t *Buf, uint32_t Len)
         uint8_t Data1 = Buf[i + 2];             // First data byte
         uint8_t Data2 = Buf[i + 3];             // Second data byte
 
-        UsbMidiCallback(cin, channel, Data1, Data2);
-	    // Prepare for next packet reception
-	    USBD_MIDI_SetRxBuffer(&hUsbMidiDeviceFS, UserRxBuffer);
-	    USBD_MIDI_ReceivePacket(&hUsbMidiDeviceFS);
-
-	    return (USBD_OK);
-
-
-        // Process according to message type
-        switch (cin)
+        if ((cin >= MIDI_CIN_SYSEX_START) && (cin <= MIDI_CIN_SYSEX_END_3BYTE))
         {
-            case MIDI_CIN_NOTE_OFF:
-                OnNoteOff(channel, Data1, Data2);
-                break;
-
-            case MIDI_CIN_NOTE_ON:
-                OnNoteOn(channel, Data1, Data2);
-                break;
-
-            case MIDI_CIN_CONTROL_CHANGE:
-                OnControlChange(channel, Data1, Data2);
-                break;
-
-            case MIDI_CIN_PROGRAM_CHANGE:
-                OnProgramChange(channel, Data1);
-                break;
-
-            case MIDI_CIN_PITCH_BEND:
-                // Process Pitch Bend
-                // uint16_t bend = data1 | (data2 << 7);
-                break;
-
-            default:
-                // Other message types
-                break;
+            // SysEx bytes go to the SysEx service (raw bytes, no status)
+            UsbMidiSysExCallback(cin, status, Data1, Data2);
+            continue;
         }
+
+        UsbMidiCallback(cin, channel, Data1, Data2);
     }
 
     // Prepare for next packet reception
@@ -190,6 +157,77 @@ uint8_t MIDI_Transmit(uint8_t *buffer, uint16_t length)
     return result;
 }
 
+// -----------------------------------------------------------------------------
+// MIDI_SendSysEx: Send a SysEx message over USB
+// -----------------------------------------------------------------------------
+
+// Send a complete SysEx message (F0 ... F7) as USB-MIDI events
+// CIN 4 for every 3 bytes, CIN 5/6/7 for the last 1/2/3 bytes, up to
+// 16 events per packet. UserTxBuffer is filled only once the previous
+// packet is sent (the endpoint reads it until DataIn clears txState).
+// pData: Message including F0 and F7
+// Length: Number of bytes
+// Returns: USBD_OK, USBD_FAIL if the host does not read the endpoint
+//          (the message may be cut: the caller reports the failure)
+uint8_t MIDI_SendSysEx(const uint8_t *pData, uint32_t Length)
+{
+    USBD_MIDI_HandleTypeDef *hmidi = (USBD_MIDI_HandleTypeDef *)hUsbMidiDeviceFS.pClassData;
+
+    // Check if MIDI handle is valid
+    if (hmidi == NULL)
+    {
+        return USBD_FAIL;
+    }
+
+    uint32_t Index = 0;
+    while (Index < Length)
+    {
+        // Wait for the previous packet (still read from UserTxBuffer)
+        uint32_t Start = HAL_GetTick();
+        while (hmidi->txState != 0)
+        {
+            if ((HAL_GetTick() - Start) > MIDI_SYSEX_TX_TIMEOUT_MS)
+            {
+                return USBD_FAIL;
+            }
+        }
+
+        // Fill one packet
+        uint16_t PacketLength = 0;
+        while ((Index < Length) && (PacketLength < MIDI_DATA_FS_MAX_PACKET_SIZE))
+        {
+            uint32_t Remaining = Length - Index;
+            uint8_t cin;
+            uint32_t Count;
+            if (Remaining > 3)
+            {
+                cin = MIDI_CIN_SYSEX_START;
+                Count = 3;
+            }
+            else
+            {
+                cin = MIDI_CIN_SYSEX_END_1BYTE + (uint8_t)(Remaining - 1);
+                Count = Remaining;
+            }
+            UserTxBuffer[PacketLength++] = (0 << 4) | cin;   // Cable 0 + CIN
+            for (uint32_t n = 0; n < 3; n++)
+            {
+                UserTxBuffer[PacketLength++] = (n < Count) ? pData[Index + n] : 0;
+            }
+            Index += Count;
+        }
+
+        USBD_MIDI_SetTxBuffer(&hUsbMidiDeviceFS, UserTxBuffer, PacketLength);
+        if (USBD_LL_Transmit(&hUsbMidiDeviceFS, MIDI_IN_EP, UserTxBuffer, PacketLength) != USBD_OK)
+        {
+            hmidi->txState = 0;
+            return USBD_FAIL;
+        }
+    }
+
+    return USBD_OK;
+}
+
 // -----------------------------------------------------------------------------
 // MIDI_SendNoteOn: Send MIDI Note On message
 // -----------------------------------------------------------------------------
@@ -0,0 +1,59 @@
+//==================================================================================
+//==================================================================================
+// File: cChain.h
+// Description: Chorus -> Delay -> Reverb effect chain
+//
+// Build configuration (@EffectsConfig.h):
+//     #define ACTIVE_EFFECT EFFECT_CHAIN
+//     #define HARD_DRYWET
+//     #define CHAIN_SLOT_CHORUS      // Compiles the slot sources
+//     #define CHAIN_SLOT_DELAY
+//     #define CHAIN_SLOT_REVERB
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#pragma once
+
+#define EFFECT_CHAIN_SLOT          // The slot headers must not declare the effect
+#include "cEffectChain.h"
+#include "cChorus.h"
+#include "Delay.h"
+#include "Reverb.h"
+
+#define DECLARE_EFFECT DadEffect::cMainChain __Effect
+#define EFFECT_NAME "Chain"
+#define EFFECT_VERSION "Version 1.0"
+#define EFFECT_SPLATCH_SCREEN "Chain.png"
+constexpr uint32_t EFFECT_BUILD = BUILD_ID('C', 'H', 'N', '4');   // 2: reverb engine parameter, 3: reverb freeze, 4: freeze not saved
+
+namespace DadEffect {
+
+constexpr uint32_t CHAIN_ID BUILD_ID('C', 'H', 'A', 'I');
+constexpr uint8_t  CHAIN_NB_SLOTS = 3;
+
+//**********************************************************************************
+// Class: cMainChain
+// Description: Chorus, delay and reverb in series, each slot can be bypassed,
+//              mixed and moved in the chain
+//**********************************************************************************
+class cMainChain : public cEffectChain {
+public:
+    // -----------------------------------------------------------------------------
+    // Initializes the slots and the chain
+    void Initialize();
+
+protected:
+    // =============================================================================
+    // Slots
+    // =============================================================================
+    cChorus             m_Chorus;           // Modulations mode
+    cMultiModeSlot      m_ChorusSlot;       // Adapter hosting m_Chorus
+    cDelay              m_Delay;
+    cReverb             m_Reverb;
+};
+
+} // namespace DadEffect
+
+//***End of file**************************************************************
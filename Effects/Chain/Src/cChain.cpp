@@ -0,0 +1,38 @@
+//==================================================================================
+//==================================================================================
+// File: cChain.cpp
+// Description: Chorus -> Delay -> Reverb effect chain
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+#include "@EffectsConfig.h"
+#if ACTIVE_EFFECT == EFFECT_CHAIN
+#include "cChain.h"
+
+namespace DadEffect {
+
+//**********************************************************************************
+// Class: cMainChain
+//**********************************************************************************
+
+// ---------------------------------------------------------------------------------
+// Initialize
+// Initializes the slots and the chain
+// ---------------------------------------------------------------------------------
+void cMainChain::Initialize() {
+    m_ChorusSlot.Bind(&m_Chorus);
+
+    const sChainSlot Slots[CHAIN_NB_SLOTS] = {
+        { &m_ChorusSlot, "Chorus", "Chorus" },
+        { &m_Delay,      "Delay",  "Delay"  },
+        { &m_Reverb,     "Reverb", "Reverb" },
+    };
+
+    cEffectChain::Initialize(CHAIN_ID, Slots, CHAIN_NB_SLOTS);
+}
+
+} // namespace DadEffect
+
+#endif
+//***End of file**************************************************************
@@ -7,11 +7,14 @@
 //==================================================================================
 //==================================================================================
 #include "@EffectsConfig.h"
-#if ACTIVE_EFFECT == EFFECT_DELAY
+#if (ACTIVE_EFFECT == EFFECT_DELAY) || defined(CHAIN_SLOT_DELAY)
 #include "Delay.h"
+#include "TCMPlacement.h"
+#include "cMemoryPlan.h"
 
 constexpr float DELAY_MAX_TIME = 1.5f;  // Maximum delay time in seconds
 constexpr float DELAY_MIN_TIME = 0.1f;  // Minimum delay time in seconds
+constexpr float DELAY_IDLE_HOLD = DELAY_MAX_TIME + 0.1f;  // Longest silent gap between two echoes
 
 // Utility to round up to the next uint
 constexpr uint32_t ceil_to_uint(float value) {
@@ -24,11 +27,28 @@ constexpr float SMOOTH_COEFF = 0.00008f;
 // Calculate buffer size based on sampling rate and max delay time
 constexpr uint32_t DELAY_BUFFER_SIZE = ceil_to_uint(SAMPLING_RATE * DELAY_MAX_TIME);
 
-// Allocate delay buffers in SDRAM (extra 100 samples for interpolation safety)
-SDRAM_SECTION float __DelayBufferLeft[DELAY_BUFFER_SIZE + 100];   // Left channel delay buffer 1
-SDRAM_SECTION float __DelayBufferRight[DELAY_BUFFER_SIZE + 100];  // Right channel delay buffer 1
-SDRAM_SECTION float __Delay2BufferLeft[DELAY_BUFFER_SIZE + 100];  // Left channel delay buffer 2
-SDRAM_SECTION float __Delay2BufferRight[DELAY_BUFFER_SIZE + 100]; // Right channel delay buffer 2
+// Delay buffers in SDRAM (extra 100 samples for interpolation safety)
+constexpr uint32_t DELAY_LINE_SIZE = DELAY_BUFFER_SIZE + 100;
+
+enum eDelayRegion : uint32_t {
+    DELAY_REGION_1_LEFT = 0,
+    DELAY_REGION_1_RIGHT,
+    DELAY_REGION_2_LEFT,
+    DELAY_REGION_2_RIGHT,
+    DELAY_NB_REGIONS
+};
+
+constexpr DadUtilities::sMemRegion DELAY_REGIONS[DELAY_NB_REGIONS] = {
+    DadUtilities::FloatRegion("Delay1Left",  DELAY_LINE_SIZE),
+    DadUtilities::FloatRegion("Delay1Right", DELAY_LINE_SIZE),
+    DadUtilities::FloatRegion("Delay2Left",  DELAY_LINE_SIZE),
+    DadUtilities::FloatRegion("Delay2Right", DELAY_LINE_SIZE)
+};
+
+constexpr DadUtilities::cMemoryPlan<DELAY_NB_REGIONS> DELAY_MEMORY_PLAN(DELAY_REGIONS);
+static_assert(DELAY_MEMORY_PLAN.fits(), "Delay buffers exceed the memory budgets (see cMemoryPlan.h)");
+
+DECLARE_MEMORY_ARENAS(__DelayArena, DELAY_MEMORY_PLAN)
 
 namespace DadEffect {
 
@@ -57,17 +77,22 @@ void cDelay::onInitialize() {
     m_TrebleFilter2.Initialize(SAMPLING_RATE, 1000.0f, 0.0f, 1.0f, DadDSP::FilterType::HSH);
 
     // Initialize delay lines
-    m_Delay1LineRight.Initialize(__DelayBufferRight, DELAY_BUFFER_SIZE);  // Right channel delay line 1
+    m_Delay1LineRight.Initialize(DELAY_MEMORY_PLAN.getBuffer<float>(__DelayArena, DELAY_REGION_1_RIGHT), DELAY_BUFFER_SIZE);  // Right channel delay line 1
     m_Delay1LineRight.Clear();  // Clear buffer
-    m_Delay1LineLeft.Initialize(__DelayBufferLeft, DELAY_BUFFER_SIZE);    // Left channel delay line 1
+    m_Delay1LineLeft.Initialize(DELAY_MEMORY_PLAN.getBuffer<float>(__DelayArena, DELAY_REGION_1_LEFT), DELAY_BUFFER_SIZE);    // Left channel delay line 1
     m_Delay1LineLeft.Clear();   // Clear buffer
 
-    m_Delay2LineRight.Initialize(__Delay2BufferRight, DELAY_BUFFER_SIZE); // Right channel delay line 2
+    m_Delay2LineRight.Initialize(DELAY_MEMORY_PLAN.getBuffer<float>(__DelayArena, DELAY_REGION_2_RIGHT), DELAY_BUFFER_SIZE); // Right channel delay line 2
     m_Delay2LineRight.Clear();  // Clear buffer
-    m_Delay2LineLeft.Initialize(__Delay2BufferLeft, DELAY_BUFFER_SIZE);   // Left channel delay line 2
+    m_Delay2LineLeft.Initialize(DELAY_MEMORY_PLAN.getBuffer<float>(__DelayArena, DELAY_REGION_2_LEFT), DELAY_BUFFER_SIZE);   // Left channel delay line 2
     m_Delay2LineLeft.Clear();   // Clear buffer
 
-    m_SatDrive = 1.0f;
+    // Feedback saturation
+    m_Sat1Right.Initialize(DELAY_SAT_CURVE, DELAY_SAT_OVERSAMPLING);
+    m_Sat1Left.Initialize(DELAY_SAT_CURVE, DELAY_SAT_OVERSAMPLING);
+    m_Sat2Right.Initialize(DELAY_SAT_CURVE, DELAY_SAT_OVERSAMPLING);
+    m_Sat2Left.Initialize(DELAY_SAT_CURVE, DELAY_SAT_OVERSAMPLING);
+    m_SatLatency = static_cast<float>(m_Sat1Left.getLatency());
     m_PrevTime = 0.0f;
     m_PrevSubDelayR = 0.0f;
     m_PrevSubDelayL = 0.0f;
@@ -75,6 +100,9 @@ void cDelay::onInitialize() {
     // LFO and Filters Initialization
     m_LFO.Initialize(SAMPLING_RATE, 0.5, 1, 10, 0.5f);  // Reinitialize LFO
 
+    // Idle detection must not stop between two echoes
+    m_Idle.setHoldTime(DELAY_IDLE_HOLD);
+
     // =============================================================================
     // Initialize UI Parameters
     // Delay 1 parameters
@@ -95,6 +123,7 @@ void cDelay::onInitialize() {
     // Modulation parameters
     m_ModulationDeep.Init(DELAY_ID, 10.0f, 0.0f, 100.0f, 5.0f, 1.0f, nullptr, 0, 1.0f, 29);  					// Modulation depth
     m_ModulationSpeed.Init(DELAY_ID, 1.5f, 0.25f, 8.0f, 0.5f, 0.05f, SpeedChange, (uint32_t)this, 0.5f, 30);  	// Modulation speed
+    m_ModulationSpeed.setSmoothing(DadDSP::eSmoothCurve::Exponential);  										// Constant ratio sweep in Hz
 
     // Parameter Views Setup
     m_TimeView.Init(&m_Time, "Time", "Time", "s", "second");  		// Time parameter view
@@ -152,7 +181,7 @@ void cDelay::onInitialize() {
 // Function: Process
 // Description: Main audio processing function
 // -----------------------------------------------------------------------------
-void cDelay::onProcess(AudioBuffer *pIn, AudioBuffer *pOut, DadGUI::eEffectState_t State, bool Silence) {
+ITCM_CODE void cDelay::onProcess(AudioBuffer *pIn, AudioBuffer *pOut, DadGUI::eEffectState_t State, bool Silence) {
 
 	// Update LFO and dry/wet processing
     m_LFO.Step();  // Advance LFO
@@ -221,12 +250,13 @@ void cDelay::onProcess(AudioBuffer *pIn, AudioBuffer *pOut, DadGUI::eEffectState
 
     // --- Delay Processing 1 ---
     // Read from delay line 1
-    float OutRight = m_Delay1LineRight.Pull(DelayR);  // Get delayed right signal
-    float OutLeft = m_Delay1LineLeft.Pull(DelayL);    // Get delayed left signal
+    // (the saturation latency is taken from the read position)
+    float OutRight = m_Delay1LineRight.Pull(DelayR - m_SatLatency);  // Get delayed right signal
+    float OutLeft = m_Delay1LineLeft.Pull(DelayL - m_SatLatency);    // Get delayed left signal
 
     // Apply Saturation
-    OutRight = std::tanh(OutRight * m_SatDrive) / m_SatDrive;
-    OutLeft = std::tanh(OutLeft * m_SatDrive) / m_SatDrive;
+    OutRight = m_Sat1Right.Process(OutRight);
+    OutLeft = m_Sat1Left.Process(OutLeft);
 
     // Apply tone shaping filters to delay 1
     OutRight = m_BassFilter1.Process(OutRight, DadDSP::eChannel::Right);  // Apply bass filter
@@ -255,17 +285,17 @@ void cDelay::onProcess(AudioBuffer *pIn, AudioBuffer *pOut, DadGUI::eEffectState
 
     if (m_RepeatDelay2 == 0) {
         // Use delay line 1 as source for delay 2
-        Out2Right = m_Delay1LineRight.Pull(m_PrevSubDelayR);  // Read from delay 1
-        Out2Left = m_Delay1LineLeft.Pull(m_PrevSubDelayL);    // Read from delay 1
+        Out2Right = m_Delay1LineRight.Pull(m_PrevSubDelayR - m_SatLatency);  // Read from delay 1
+        Out2Left = m_Delay1LineLeft.Pull(m_PrevSubDelayL - m_SatLatency);    // Read from delay 1
     } else {
         // Use dedicated delay line 2
-        Out2Right = m_Delay2LineRight.Pull(m_PrevSubDelayR);  // Read from delay 2
-        Out2Left = m_Delay2LineLeft.Pull(m_PrevSubDelayL);    // Read from delay 2
+        Out2Right = m_Delay2LineRight.Pull(m_PrevSubDelayR - m_SatLatency);  // Read from delay 2
+        Out2Left = m_Delay2LineLeft.Pull(m_PrevSubDelayL - m_SatLatency);    // Read from delay 2
     }
 
     // Apply Saturation
-    Out2Right = std::tanh(Out2Right * m_SatDrive) / m_SatDrive;
-    Out2Left = std::tanh(Out2Left * m_SatDrive) / m_SatDrive;
+    Out2Right = m_Sat2Right.Process(Out2Right);
+    Out2Left = m_Sat2Left.Process(Out2Left);
 
     // Apply tone shaping to delay 2
     Out2Right = m_BassFilter2.Process(Out2Right, DadDSP::eChannel::Right);  // Apply bass filter
@@ -349,7 +379,11 @@ void cDelay::TrebleChange(DadDSP::cParameter *pParameter, uint32_t CallbackUserD
 void cDelay::SatChange(DadDSP::cParameter *pParameter, uint32_t CallbackUserData) {
     cDelay *pthis = (cDelay *)CallbackUserData;  // Get class instance
     float gain = pParameter->getValue() * 0.01;
-    pthis->m_SatDrive = 1.0f + gain * 10.0f;
+    float Drive = 1.0f + gain * 10.0f;
+    pthis->m_Sat1Right.setDrive(Drive);
+    pthis->m_Sat1Left.setDrive(Drive);
+    pthis->m_Sat2Right.setDrive(Drive);
+    pthis->m_Sat2Left.setDrive(Drive);
 }
 
 
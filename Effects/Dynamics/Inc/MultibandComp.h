@@ -0,0 +1,169 @@
+//==================================================================================
+//==================================================================================
+// File: MultibandComp.h
+// Description: Declaration of the 3 band compressor with output limiter
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#pragma once
+
+#include "cEffectBase.h"
+#include "BiquadFilter.h"
+#include "cCompressor.h"
+
+#define DECLARE_EFFECT DadEffect::cMultibandComp __Effect
+#define EFFECT_NAME "Multiband"
+#define EFFECT_VERSION "Version 1.0"
+#define EFFECT_SPLATCH_SCREEN "Multiband.png"
+constexpr uint32_t EFFECT_BUILD = BUILD_ID('M', 'B', 'C', '1');
+
+namespace DadEffect {
+
+//**********************************************************************************
+// cMultibandComp - Configuration
+//
+
+// Crossover
+// A Linkwitz-Riley 4th order section is two identical Butterworth biquads
+// (Q = 1/sqrt(2)). cBiQuad takes a bandwidth in octaves: for a given Q
+//     BW = 2 * asinh(1 / (2 * Q)) / ln(2) * sin(w) / w
+constexpr float             XOVER_BW_BUTTERWORTH = 1.8999835f;  // 2 * asinh(1/sqrt(2)) / ln(2)
+constexpr float             XOVER_LOW_MIN  = 60.0f;
+constexpr float             XOVER_LOW_MAX  = 600.0f;
+constexpr float             XOVER_HIGH_MIN = 1000.0f;
+constexpr float             XOVER_HIGH_MAX = 8000.0f;
+
+// Bands
+constexpr uint16_t          MBC_NUM_BANDS = 3;
+constexpr uint16_t          MBC_BAND_LOW  = 0;
+constexpr uint16_t          MBC_BAND_MID  = 1;
+constexpr uint16_t          MBC_BAND_HIGH = 2;
+
+constexpr uint32_t          MBCOMP_ID = BUILD_ID('M', 'B', 'C', 'P');
+
+//**********************************************************************************
+// class cMultibandComp
+//
+// Input -> LR4 crossover (low | mid | high) -> compressor per band -> sum
+//       -> look-ahead limiter -> output
+//
+// Crossover: the input is split at the low frequency, the upper part is split
+// again at the high frequency. The low band goes through the allpass
+// equivalent of the second split (LR4 LP + HP = 2nd order allpass, Q = 0.707)
+// so the three bands sum back to a flat magnitude response.
+//
+// The compressors are stereo linked. Their detectors run once per
+// COMP_BLOCK_SIZE samples (see cCompressor), the limiter guarantees the
+// output ceiling with LIMITER_DELAY samples of latency.
+//**********************************************************************************
+class cMultibandComp: public cEffectBase{
+public:
+    // =============================================================================
+    // Public Methods
+    // =============================================================================
+
+    // -----------------------------------------------------------------------------
+    // Constructor - initializes nothing by itself
+    // -----------------------------------------------------------------------------
+    cMultibandComp() = default;
+
+    // -----------------------------------------------------------------------------
+    // Initializes DSP components and user interface parameters
+    // -----------------------------------------------------------------------------
+    void onInitialize() override;
+
+    // -----------------------------------------------------------------------------
+    // Returns the unique effect identifier
+    // -----------------------------------------------------------------------------
+    uint32_t getEffectID() override{
+    	return MBCOMP_ID;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Audio processing function - processes one input/output audio buffer
+    // -----------------------------------------------------------------------------
+    void onProcess(AudioBuffer *pIn, AudioBuffer *pOut, DadGUI::eEffectState_t State, bool Silence) override;
+
+protected:
+
+    // -----------------------------------------------------------------------------
+    // Static callbacks (UI parameter change handlers)
+    // -----------------------------------------------------------------------------
+    static void LowFreqChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData);
+    static void HighFreqChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData);
+    static void CeilingChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData);
+    static void ThresholdChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData);
+    static void RatioChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData);
+    static void GainChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData);
+    static void AttackChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData);
+    static void ReleaseChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData);
+    static void KneeChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData);
+
+    // -----------------------------------------------------------------------------
+    // DSP Helper Functions
+    // -----------------------------------------------------------------------------
+    void setCrossover(DadDSP::cBiQuad& LowPass, DadDSP::cBiQuad& HighPass, float Freq);
+    uint16_t findBand(DadDSP::cParameter* pParameter, DadGUI::cUIParameter* pBandParameters);
+
+    // =============================================================================
+    // User Interface Components
+    // =============================================================================
+
+    // -----------------------------------------------------------------------------
+    // Parameter declarations
+    DadGUI::cUIParameter                 m_LowFreq;
+    DadGUI::cUIParameter                 m_HighFreq;
+    DadGUI::cUIParameter                 m_Ceiling;
+
+    DadGUI::cUIParameter                 m_Threshold[MBC_NUM_BANDS];
+    DadGUI::cUIParameter                 m_Ratio[MBC_NUM_BANDS];
+    DadGUI::cUIParameter                 m_Gain[MBC_NUM_BANDS];
+
+    DadGUI::cUIParameter                 m_Attack;
+    DadGUI::cUIParameter                 m_Release;
+    DadGUI::cUIParameter                 m_Knee;
+
+    // -----------------------------------------------------------------------------
+    // Parameter view declarations
+    DadGUI::cParameterNumNormalView      m_LowFreqView;
+    DadGUI::cParameterNumNormalView      m_HighFreqView;
+    DadGUI::cParameterNumNormalView      m_CeilingView;
+
+    DadGUI::cParameterNumNormalView      m_ThresholdView[MBC_NUM_BANDS];
+    DadGUI::cParameterNumNormalView      m_RatioView[MBC_NUM_BANDS];
+    DadGUI::cParameterNumLeftRightView   m_GainView[MBC_NUM_BANDS];
+
+    DadGUI::cParameterNumNormalView      m_AttackView;
+    DadGUI::cParameterNumNormalView      m_ReleaseView;
+    DadGUI::cParameterNumNormalView      m_KneeView;
+
+    // -----------------------------------------------------------------------------
+    // Panel declarations
+    DadGUI::cPanelOfParameterView        m_ParameterMainPanel;
+    DadGUI::cPanelOfParameterView        m_ParameterBandPanel[MBC_NUM_BANDS];
+    DadGUI::cPanelOfParameterView        m_ParameterDynamicsPanel;
+
+    // =============================================================================
+    // DSP Components
+    // =============================================================================
+
+    // -----------------------------------------------------------------------------
+    // Crossover (LR4 stereo sections)
+    DadDSP::cBiQuad         m_LowSplitLP;       // Low band
+    DadDSP::cBiQuad         m_LowSplitHP;       // Mid + high bands
+    DadDSP::cBiQuad         m_HighSplitLP;      // Mid band
+    DadDSP::cBiQuad         m_HighSplitHP;      // High band
+    DadDSP::cBiQuad         m_LowAllPass;       // Phase compensation of the low band
+
+    // -----------------------------------------------------------------------------
+    // Dynamics
+    DadDSP::cCompressor     m_Compressor[MBC_NUM_BANDS];
+    DadDSP::cLimiter        m_Limiter;
+    uint32_t                m_BlockCount;       // Sample position inside the detector block
+};
+
+}  // namespace DadEffect
+
+//***End of file**************************************************************
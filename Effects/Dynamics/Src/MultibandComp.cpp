@@ -0,0 +1,286 @@
+//==================================================================================
+//==================================================================================
+// File: MultibandComp.cpp
+// Description: Implementation of the 3 band compressor with output limiter
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+#include "@EffectsConfig.h"
+#if ACTIVE_EFFECT == EFFECT_MULTIBAND
+#include "MultibandComp.h"
+#include "TCMPlacement.h"
+#include <cmath>
+
+namespace DadEffect {
+
+// Pre calculed constants
+constexpr float TWO_PI_OVER_SAMPLING_RATE = 2.0f * DadDSP::kPi / SAMPLING_RATE;
+constexpr float LIMITER_RELEASE = 0.080f;       // Output limiter release in seconds
+
+// Band names for the menu and the views
+static const char* __BandNames[MBC_NUM_BANDS] = { "Low", "Mid", "High" };
+
+//**********************************************************************************
+// cMultibandComp
+//**********************************************************************************
+
+// -----------------------------------------------------------------------------
+// Initializes DSP components and user interface parameters
+// -----------------------------------------------------------------------------
+void cMultibandComp::onInitialize() {
+    // =============================================================================
+    // Initialize DSP Components
+
+    // -----------------------------------------------------------------------------
+    // Crossover: frequencies are set by the parameter callbacks
+    m_LowSplitLP.Initialize(SAMPLING_RATE, 200.0f, 0.0f, XOVER_BW_BUTTERWORTH, DadDSP::FilterType::LPF24);
+    m_LowSplitHP.Initialize(SAMPLING_RATE, 200.0f, 0.0f, XOVER_BW_BUTTERWORTH, DadDSP::FilterType::HPF24);
+    m_HighSplitLP.Initialize(SAMPLING_RATE, 2500.0f, 0.0f, XOVER_BW_BUTTERWORTH, DadDSP::FilterType::LPF24);
+    m_HighSplitHP.Initialize(SAMPLING_RATE, 2500.0f, 0.0f, XOVER_BW_BUTTERWORTH, DadDSP::FilterType::HPF24);
+    m_LowAllPass.Initialize(SAMPLING_RATE, 2500.0f, 0.0f, XOVER_BW_BUTTERWORTH, DadDSP::FilterType::AFP);
+
+    // -----------------------------------------------------------------------------
+    // Dynamics
+    for (int i = 0; i < MBC_NUM_BANDS; i++) {
+        m_Compressor[i].Initialize(SAMPLING_RATE);
+    }
+    m_Limiter.Initialize(SAMPLING_RATE);
+    m_Limiter.setRelease(LIMITER_RELEASE);
+    m_BlockCount = 0;
+
+    // Insert effect: the whole signal goes through the wet path
+    __DryWet.setMix(100);
+
+	// =============================================================================
+    // Initialize UI Parameters
+
+    // Crossover frequencies
+    //                            Initial value, Min,           Max,           Rapid inc, Slow incr, CallBack,       Callback data,  SlopeTime, MIDI CC
+    m_LowFreq.Init(MBCOMP_ID,     200.0f,        XOVER_LOW_MIN, XOVER_LOW_MAX, 20.0f,     5.0f,      LowFreqChange,  (uint32_t)this, 0.3f,      20);
+    m_HighFreq.Init(MBCOMP_ID,    2500.0f,       XOVER_HIGH_MIN,XOVER_HIGH_MAX,200.0f,    50.0f,     HighFreqChange, (uint32_t)this, 0.3f,      21);
+
+    // Output ceiling (dBFS)
+    //                            Initial value, Min,    Max,  Rapid inc, Slow incr, CallBack,       Callback data,  SlopeTime, MIDI CC
+    m_Ceiling.Init(MBCOMP_ID,     -1.0f,         -24.0f, 0.0f, 1.0f,      0.1f,      CeilingChange,  (uint32_t)this, 0.1f,      22);
+
+    // Per band threshold (dBFS), ratio (x:1) and makeup gain (dB)
+    for (int i = 0; i < MBC_NUM_BANDS; i++) {
+        //                           Initial value, Min,    Max,   Rapid inc, Slow incr, CallBack,        Callback data,  SlopeTime, MIDI CC
+        m_Threshold[i].Init(MBCOMP_ID, -18.0f,      -48.0f, 0.0f,  2.0f,      0.5f,      ThresholdChange, (uint32_t)this, 0.1f,      23 + (i * 3));
+        m_Ratio[i].Init(MBCOMP_ID,     3.0f,        1.0f,   20.0f, 1.0f,      0.1f,      RatioChange,     (uint32_t)this, 0.1f,      24 + (i * 3));
+        m_Gain[i].Init(MBCOMP_ID,      0.0f,        -12.0f, 12.0f, 1.0f,      0.1f,      GainChange,      (uint32_t)this, 0.1f,      25 + (i * 3));
+    }
+
+    // Time constants (ms) and knee (dB), shared by the three bands
+    //                         Initial value, Min,   Max,     Rapid inc, Slow incr, CallBack,      Callback data,  SlopeTime, MIDI CC
+    m_Attack.Init(MBCOMP_ID,   10.0f,         0.5f,  100.0f,  5.0f,      0.5f,      AttackChange,  (uint32_t)this, 0.0f,      32);
+    m_Release.Init(MBCOMP_ID,  150.0f,        20.0f, 1000.0f, 50.0f,     5.0f,      ReleaseChange, (uint32_t)this, 0.0f,      33);
+    m_Knee.Init(MBCOMP_ID,     6.0f,          0.0f,  12.0f,   1.0f,      0.5f,      KneeChange,    (uint32_t)this, 0.0f,      34);
+
+    // Parameter view initialization
+    m_LowFreqView.Init(&m_LowFreq, "Low X", "Low crossover", "Hz", "Hertz");
+    m_HighFreqView.Init(&m_HighFreq, "High X", "High crossover", "Hz", "Hertz");
+    m_CeilingView.Init(&m_Ceiling, "Ceil", "Output ceiling", "dB", "Decibel");
+
+    for (int i = 0; i < MBC_NUM_BANDS; i++) {
+        m_ThresholdView[i].Init(&m_Threshold[i], "Thresh", "Threshold", "dB", "Decibel");
+        m_RatioView[i].Init(&m_Ratio[i], "Ratio", "Ratio", ":1", ":1");
+        m_GainView[i].Init(&m_Gain[i], "Gain", "Makeup gain", "dB", "Decibel");
+    }
+
+    m_AttackView.Init(&m_Attack, "Attack", "Attack", "ms", "millisec");
+    m_ReleaseView.Init(&m_Release, "Release", "Release", "ms", "millisec");
+    m_KneeView.Init(&m_Knee, "Knee", "Knee", "dB", "Decibel");
+
+    // Panel Initialization
+    m_ParameterMainPanel.Init(&m_LowFreqView, &m_HighFreqView, &m_CeilingView);
+    for (int i = 0; i < MBC_NUM_BANDS; i++) {
+        m_ParameterBandPanel[i].Init(&m_ThresholdView[i], &m_RatioView[i], &m_GainView[i]);
+    }
+    m_ParameterDynamicsPanel.Init(&m_AttackView, &m_ReleaseView, &m_KneeView);
+
+    // Effect menu part initialization
+    m_Menu.addMenuItem(&m_ParameterMainPanel, "Bands");
+    for (int i = 0; i < MBC_NUM_BANDS; i++) {
+        m_Menu.addMenuItem(&m_ParameterBandPanel[i], __BandNames[i]);
+    }
+    m_Menu.addMenuItem(&m_ParameterDynamicsPanel, "Dynamic");
+}
+
+// -----------------------------------------------------------------------------
+// Sets one LR4 split frequency
+// The bandwidth giving Q = 1/sqrt(2) depends on the frequency (see header)
+// -----------------------------------------------------------------------------
+void cMultibandComp::setCrossover(DadDSP::cBiQuad& LowPass, DadDSP::cBiQuad& HighPass, float Freq) {
+    float Omega = Freq * TWO_PI_OVER_SAMPLING_RATE;
+    float Bandwidth = XOVER_BW_BUTTERWORTH * std::sin(Omega) / Omega;
+
+    LowPass.setCutoffFreq(Freq);
+    LowPass.setBandwidth(Bandwidth);
+    LowPass.CalculateParameters();
+
+    HighPass.setCutoffFreq(Freq);
+    HighPass.setBandwidth(Bandwidth);
+    HighPass.CalculateParameters();
+}
+
+// -----------------------------------------------------------------------------
+// Returns the band of a per band parameter
+// -----------------------------------------------------------------------------
+uint16_t cMultibandComp::findBand(DadDSP::cParameter* pParameter, DadGUI::cUIParameter* pBandParameters) {
+    for (uint16_t i = 0; i < MBC_NUM_BANDS; i++) {
+        if (pParameter == &pBandParameters[i]) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Audio processing function - processes one input/output audio buffer
+// -----------------------------------------------------------------------------
+ITCM_CODE void cMultibandComp::onProcess(AudioBuffer *pIn, AudioBuffer *pOut, DadGUI::eEffectState_t State, bool Silence) {
+    float inL = pIn->Left;
+    float inR = pIn->Right;
+
+    #ifdef HARD_DRYWET
+    if(State == DadGUI::eEffectState_t::off){
+        inL = 0;
+        inR = 0;
+    }
+	#endif
+
+    // ─────────────────────────────────────────────────────────────────────────────
+    // 1. LR4 crossover
+    float BandL[MBC_NUM_BANDS];
+    float BandR[MBC_NUM_BANDS];
+
+    float RestL = m_LowSplitHP.Process(inL, DadDSP::eChannel::Left);
+    float RestR = m_LowSplitHP.Process(inR, DadDSP::eChannel::Right);
+
+    BandL[MBC_BAND_LOW] = m_LowAllPass.Process(m_LowSplitLP.Process(inL, DadDSP::eChannel::Left), DadDSP::eChannel::Left);
+    BandR[MBC_BAND_LOW] = m_LowAllPass.Process(m_LowSplitLP.Process(inR, DadDSP::eChannel::Right), DadDSP::eChannel::Right);
+    BandL[MBC_BAND_MID] = m_HighSplitLP.Process(RestL, DadDSP::eChannel::Left);
+    BandR[MBC_BAND_MID] = m_HighSplitLP.Process(RestR, DadDSP::eChannel::Right);
+    BandL[MBC_BAND_HIGH] = m_HighSplitHP.Process(RestL, DadDSP::eChannel::Left);
+    BandR[MBC_BAND_HIGH] = m_HighSplitHP.Process(RestR, DadDSP::eChannel::Right);
+
+    // ─────────────────────────────────────────────────────────────────────────────
+    // 2. Per band compression: peak detection per sample, gain computer per block
+    float OutL = 0.0f;
+    float OutR = 0.0f;
+    for (int i = 0; i < MBC_NUM_BANDS; i++) {
+        m_Compressor[i].Detect(BandL[i], BandR[i]);
+        float Gain = m_Compressor[i].getGain();
+        OutL += BandL[i] * Gain;
+        OutR += BandR[i] * Gain;
+    }
+
+    if (++m_BlockCount == DadDSP::COMP_BLOCK_SIZE) {
+        m_BlockCount = 0;
+        for (int i = 0; i < MBC_NUM_BANDS; i++) {
+            m_Compressor[i].UpdateBlock();
+        }
+    }
+
+    // ─────────────────────────────────────────────────────────────────────────────
+    // 3. Output limiter
+    m_Limiter.Process(OutL, OutR);
+
+    // ─────────────────────────────────────────────────────────────────────────────
+    // 4. Apply wet gain and output
+    float WetGain = __DryWet.getGainWet();
+    pOut->Left = OutL * WetGain;
+    pOut->Right = OutR * WetGain;
+}
+
+// ---------------------------------------------------------------------------------
+// Callback: LowFreqChange - Updates the low/mid split
+// ---------------------------------------------------------------------------------
+void cMultibandComp::LowFreqChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData) {
+    cMultibandComp* pthis = (cMultibandComp*)CallbackUserData;
+    pthis->setCrossover(pthis->m_LowSplitLP, pthis->m_LowSplitHP, pParameter->getValue());
+}
+
+// ---------------------------------------------------------------------------------
+// Callback: HighFreqChange - Updates the mid/high split and the low band allpass
+// ---------------------------------------------------------------------------------
+void cMultibandComp::HighFreqChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData) {
+    cMultibandComp* pthis = (cMultibandComp*)CallbackUserData;
+    float Freq = pParameter->getValue();
+    pthis->setCrossover(pthis->m_HighSplitLP, pthis->m_HighSplitHP, Freq);
+
+    pthis->m_LowAllPass.setCutoffFreq(Freq);
+    pthis->m_LowAllPass.setBandwidth(pthis->m_HighSplitLP.getBandwidth());
+    pthis->m_LowAllPass.CalculateParameters();
+}
+
+// ---------------------------------------------------------------------------------
+// Callback: CeilingChange - Updates the limiter ceiling
+// ---------------------------------------------------------------------------------
+void cMultibandComp::CeilingChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData) {
+    cMultibandComp* pthis = (cMultibandComp*)CallbackUserData;
+    pthis->m_Limiter.setCeiling(pParameter->getValue());
+}
+
+// ---------------------------------------------------------------------------------
+// Callback: ThresholdChange - Updates the threshold of one band
+// ---------------------------------------------------------------------------------
+void cMultibandComp::ThresholdChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData) {
+    cMultibandComp* pthis = (cMultibandComp*)CallbackUserData;
+    uint16_t Band = pthis->findBand(pParameter, pthis->m_Threshold);
+    pthis->m_Compressor[Band].setThreshold(pParameter->getValue());
+}
+
+// ---------------------------------------------------------------------------------
+// Callback: RatioChange - Updates the ratio of one band
+// ---------------------------------------------------------------------------------
+void cMultibandComp::RatioChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData) {
+    cMultibandComp* pthis = (cMultibandComp*)CallbackUserData;
+    uint16_t Band = pthis->findBand(pParameter, pthis->m_Ratio);
+    pthis->m_Compressor[Band].setRatio(pParameter->getValue());
+}
+
+// ---------------------------------------------------------------------------------
+// Callback: GainChange - Updates the makeup gain of one band
+// ---------------------------------------------------------------------------------
+void cMultibandComp::GainChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData) {
+    cMultibandComp* pthis = (cMultibandComp*)CallbackUserData;
+    uint16_t Band = pthis->findBand(pParameter, pthis->m_Gain);
+    pthis->m_Compressor[Band].setMakeup(pParameter->getValue());
+}
+
+// ---------------------------------------------------------------------------------
+// Callback: AttackChange - Updates the attack time of all bands
+// ---------------------------------------------------------------------------------
+void cMultibandComp::AttackChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData) {
+    cMultibandComp* pthis = (cMultibandComp*)CallbackUserData;
+    for (int i = 0; i < MBC_NUM_BANDS; i++) {
+        pthis->m_Compressor[i].setAttack(pParameter->getValue() * 0.001f);
+    }
+}
+
+// ---------------------------------------------------------------------------------
+// Callback: ReleaseChange - Updates the release time of all bands
+// ---------------------------------------------------------------------------------
+void cMultibandComp::ReleaseChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData) {
+    cMultibandComp* pthis = (cMultibandComp*)CallbackUserData;
+    for (int i = 0; i < MBC_NUM_BANDS; i++) {
+        pthis->m_Compressor[i].setRelease(pParameter->getValue() * 0.001f);
+    }
+}
+
+// ---------------------------------------------------------------------------------
+// Callback: KneeChange - Updates the soft knee width of all bands
+// ---------------------------------------------------------------------------------
+void cMultibandComp::KneeChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData) {
+    cMultibandComp* pthis = (cMultibandComp*)CallbackUserData;
+    for (int i = 0; i < MBC_NUM_BANDS; i++) {
+        pthis->m_Compressor[i].setKnee(pParameter->getValue());
+    }
+}
+
+} // namespace DadEffect
+#endif
+//***End of file**************************************************************
@@ -0,0 +1,51 @@
+//==================================================================================
+//==================================================================================
+// File: PhaserKernels.h
+// Description: All-pass cascade kernels of the phaser, specialised at compile
+//              time for a stage count and filter order
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#pragma once
+
+#include "main.h"
+#include <cstddef>
+#include "cAllPass.h"
+
+namespace DadEffect {
+
+constexpr std::size_t   NB_MAX_FILTERS         = 6;                             // Maximum number of filters per channel
+constexpr std::size_t   NB_MAX_TOTAL_FILTERS   = NB_MAX_FILTERS * 2;            // Total filters (both channels)
+
+// All-pass cascade kernel: processes one stereo sample in place. The filter
+// arrays hold NB_MAX_FILTERS left channel filters then the right channel ones.
+using PhaserKernel_t = void (*)(DadDSP::cAllPass* pAllPass, DadDSP::cAllPass2* pAllPass2, float& Left, float& Right);
+
+//**********************************************************************************
+// Function: PhaserKernel
+// Description: NbStages cascaded first-order all-pass filters per channel; for
+//              second-order modes the second-order filter of the last stage is
+//              applied to the cascade output (same signal path as the generic
+//              loop over all the stages with a tap at the last one)
+//**********************************************************************************
+template<uint8_t NbStages, uint8_t Order>
+void PhaserKernel(DadDSP::cAllPass* pAllPass, DadDSP::cAllPass2* pAllPass2, float& Left, float& Right) {
+    static_assert((NbStages >= 1) && (NbStages <= NB_MAX_FILTERS), "Invalid phaser stage count");
+    static_assert((Order == 1) || (Order == 2), "Invalid all-pass order");
+
+    for (std::size_t Index = 0; Index < NbStages; Index++) {
+        Left = pAllPass[Index].Process(Left);
+        Right = pAllPass[Index + NB_MAX_FILTERS].Process(Right);
+    }
+
+    if (Order == 2) {
+        Left = pAllPass2[NbStages - 1].Process(Left);
+        Right = pAllPass2[NbStages - 1 + NB_MAX_FILTERS].Process(Right);
+    }
+}
+
+} // namespace DadEffect
+
+//***End of file**************************************************************
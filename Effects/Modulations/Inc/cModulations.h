@@ -13,7 +13,7 @@
 #define EFFECT_NAME "Modulations"
 #define EFFECT_VERSION "Version 1.0"
 #define EFFECT_SPLATCH_SCREEN "Modulations.png"
-constexpr uint32_t EFFECT_BUILD = BUILD_ID('M', 'O', 'D', '1');
+constexpr uint32_t EFFECT_BUILD = BUILD_ID('M', 'O', 'D', '2');   // 2: tremolo sync parameter
 
 namespace DadEffect {
 //**********************************************************************************
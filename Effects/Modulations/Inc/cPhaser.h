@@ -11,8 +11,10 @@
 
 #include "MultiModeEffect.h"
 #include <array>
+#include <utility>
 #include "cDCO.h"
 #include "cAllPass.h"
+#include "PhaserKernels.h"
 
 namespace DadEffect {
 
@@ -22,8 +24,6 @@ namespace DadEffect {
 //**********************************************************************************
 
 constexpr uint32_t      PHASER_ID              = BUILD_ID('P', 'H', 'A', 'S');  // Phaser effect ID
-constexpr std::size_t   NB_MAX_FILTERS         = 6;                             // Maximum number of filters per channel
-constexpr std::size_t   NB_MAX_TOTAL_FILTERS   = NB_MAX_FILTERS * 2;            // Total filters (both channels)
 constexpr uint8_t       NB_PH_MODE             = 6;                             // Number of phaser modes
 
 //**********************************************************************************
@@ -82,6 +82,28 @@ public:
     void Process(AudioBuffer* pIn, AudioBuffer* pOut, DadGUI::eEffectState_t State, bool Silence) override;
 
 protected:
+    // =============================================================================
+    // ALL-PASS KERNELS SECTION
+    // =============================================================================
+
+    // -----------------------------------------------------------------------------
+    // Method: MakeKernels
+    // Description: Builds the kernel table from m_ModeParams
+    // -----------------------------------------------------------------------------
+    template<std::size_t... Modes>
+    static constexpr std::array<PhaserKernel_t, NB_PH_MODE> MakeKernels(std::index_sequence<Modes...>);
+
+#ifdef MONITOR
+    // -----------------------------------------------------------------------------
+    // Method: ProbeKernel (SysEx BENCH probe)
+    // Description: Cycles per stereo sample of the kernel of a mode, run on the
+    //              filters of the effect with the audio suspended (filter
+    //              states restored afterwards)
+    // -----------------------------------------------------------------------------
+    template<uint8_t Mode>
+    static float ProbeKernel(uint32_t CallbackUserData);
+#endif
+
     // -----------------------------------------------------------------------------
     // Method: MixChange (Callback)
     // Description: Updates dry/wet mix parameter when changed by user
@@ -166,6 +188,7 @@ protected:
     float m_Fad;                                           // Fade factor for mode switching
     uint8_t m_SwitchMode;                                  // Mode switching state machine
     uint8_t m_CtMaJFilter;                                 // Filter update counter
+    PhaserKernel_t m_pKernel;                              // Kernel of the active mode
 
     // Mode parameter definitions
     static constexpr std::array<ModeParam, NB_PH_MODE> m_ModeParams = {{
@@ -183,6 +206,8 @@ protected:
 
     DadDSP::cAllPass2    m_AllPass2[NB_MAX_TOTAL_FILTERS];  // Second-order all-pass filters
     DadDSP::sAPF2State   m_APF2State[NB_MAX_TOTAL_FILTERS]; // Second-order filter states
+
+    static const std::array<PhaserKernel_t, NB_PH_MODE> m_Kernels; // One kernel per mode
 };
 
 } // namespace DadEffect
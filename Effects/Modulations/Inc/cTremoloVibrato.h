@@ -12,6 +12,7 @@
 #include "MultiModeEffect.h"
 #include "cDCO.h"
 #include "cDelayLine.h"
+#include "cMidiClock.h"
 
 namespace DadEffect {
 
@@ -71,6 +72,17 @@ protected:
 	// --------------------------------------------------------------------------
 	static void MixChange(DadDSP::cParameter *pParameter, uint32_t CallbackUserData);
 
+    // =============================================================================
+    // MIDI CLOCK SYNC SECTION
+    // =============================================================================
+
+	// --------------------------------------------------------------------------
+	// Method: UpdateClockSync
+	// Description: Locks the LFOs on the MIDI clock when a sync division is
+	//              selected, restores the free running frequency otherwise
+	// --------------------------------------------------------------------------
+	void UpdateClockSync();
+
     // =============================================================================
     // USER INTERFACE COMPONENTS SECTION
     // =============================================================================
@@ -86,6 +98,7 @@ protected:
 	DadGUI::cUIParameter m_Freq;           // LFO frequency in Hz
 	DadGUI::cUIParameter m_LFORatio;       // LFO duty cycle percentage
 	DadGUI::cUIParameter m_StereoMode;     // Stereo processing mode
+	DadGUI::cUIParameter m_Sync;           // MIDI clock sync division (0: free running)
 
     // -----------------------------------------------------------------------------
     // PARAMETER VIEWS (UI Widgets to Display/Edit Parameters)
@@ -98,6 +111,7 @@ protected:
 	DadGUI::cParameterDiscretView        m_LFOShapeView;       // LFO shape parameter view
 	DadGUI::cParameterNumLeftRightView   m_LFORatioView;       // LFO ratio parameter view
 	DadGUI::cParameterDiscretView		 m_StereoModeView;     // Stereo mode parameter view
+	DadGUI::cParameterDiscretView		 m_SyncView;           // MIDI clock sync parameter view
 
     // -----------------------------------------------------------------------------
     // PANEL COMPONENTS
@@ -118,6 +132,8 @@ protected:
 	DadDSP::cDelayLine m_ModulationLineLeft;      // Left channel delay line for vibrato
 
 	float m_CoefComp = 0.0f;                      // Compensation factor for vibrato depth consistency
+	uint32_t m_SyncCounter = 0;                   // Samples since the last clock sync update
+	bool m_ClockSynced = false;                   // LFOs currently locked on the MIDI clock
 };
 
 } // namespace DadEffect
@@ -7,9 +7,10 @@
 //==================================================================================
 //==================================================================================
 #include "@EffectsConfig.h"
-#if ACTIVE_EFFECT == EFFECT_MODULATIONS
+#if (ACTIVE_EFFECT == EFFECT_MODULATIONS) || defined(CHAIN_SLOT_CHORUS)
 
 #include "cChorus.h"
+#include "TCMPlacement.h"
 
 // Modulator offset constants for different delay lines
 
@@ -169,7 +170,7 @@ void cChorus::onDesactivate() {
 // Method: Process
 // Description: Audio processing method - applies chorus effect to input buffer
 // ---------------------------------------------------------------------------------
-void cChorus::Process(AudioBuffer* pIn, AudioBuffer* pOut, DadGUI::eEffectState_t State, bool Silence) {
+ITCM_CODE void cChorus::Process(AudioBuffer* pIn, AudioBuffer* pOut, DadGUI::eEffectState_t State, bool Silence) {
 
     // Declare processing variables
     float OutSingleLeft;   // Single chorus output left channel
@@ -183,23 +184,36 @@ void cChorus::Process(AudioBuffer* pIn, AudioBuffer* pOut, DadGUI::eEffectState_
     float WetGain = __DryWet.getGainWet(); // Wet signal gain
 
     // Process single chorus mode (first modulator only)
+    // Its output also feeds the triple cascade, so it always runs
     OutSingleLeft = m_Modulator1Left.Process(pIn->Left, Deep);
     OutSingleRight = m_Modulator1Right.Process(pIn->Right, Deep);
 
-    // Process triple chorus mode (cascaded modulators)
-    Out = m_Modulator2Left.Process(OutSingleLeft, Deep);
-    OutTripleLeft = m_Modulator3Left.Process(Out, Deep);
-
-    Out = m_Modulator2Right.Process(OutSingleRight, Deep);
-    OutTripleRight = m_Modulator3Right.Process(Out, Deep);
-
     // Declare crossfade output variables
     float OutFadeLeft;   // Crossfaded output left channel
     float OutFadeRight;  // Crossfaded output right channel
 
-    // Apply crossfade between single and triple chorus modes
-    m_Fader.Process(OutSingleLeft, OutSingleRight, OutTripleLeft, OutTripleRight,
-                   OutFadeLeft, OutFadeRight);
+    if (!m_Fader.isFading() && !m_Fader.isOnB()) {
+        // Steady single mode: the triple cascade is not evaluated
+        OutFadeLeft = OutSingleLeft;
+        OutFadeRight = OutSingleRight;
+    } else {
+        // Process triple chorus mode (cascaded modulators)
+        Out = m_Modulator2Left.Process(OutSingleLeft, Deep);
+        OutTripleLeft = m_Modulator3Left.Process(Out, Deep);
+
+        Out = m_Modulator2Right.Process(OutSingleRight, Deep);
+        OutTripleRight = m_Modulator3Right.Process(Out, Deep);
+
+        if (m_Fader.isFading()) {
+            // Apply crossfade between single and triple chorus modes
+            m_Fader.Process(OutSingleLeft, OutSingleRight, OutTripleLeft, OutTripleRight,
+                           OutFadeLeft, OutFadeRight);
+        } else {
+            // Steady triple mode
+            OutFadeLeft = OutTripleLeft;
+            OutFadeRight = OutTripleRight;
+        }
+    }
 
     // Apply wet gain to output signals
     pOut->Left = OutFadeLeft * WetGain;
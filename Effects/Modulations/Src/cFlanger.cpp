@@ -9,6 +9,7 @@
 #include "@EffectsConfig.h"
 #if ACTIVE_EFFECT == EFFECT_MODULATIONS
 #include "cFlanger.h"
+#include "TCMPlacement.h"
 
 // Modulator offset constants for different delay lines
 constexpr float FL_MODULATOR_OFFSET_LEFT  = 0.005f;
@@ -146,7 +147,7 @@ void cFlanger::onDesactivate() {
 // Method: Process
 // Description: Audio processing method - applies chorus effect to input buffer
 // ---------------------------------------------------------------------------------
-void cFlanger::Process(AudioBuffer* pIn, AudioBuffer* pOut, DadGUI::eEffectState_t State, bool Silence) {
+ITCM_CODE void cFlanger::Process(AudioBuffer* pIn, AudioBuffer* pOut, DadGUI::eEffectState_t State, bool Silence) {
 
     // Declare processing variables
     float OutLeft;   	// Single chorus output left channel
@@ -9,6 +9,10 @@
 #include "@EffectsConfig.h"
 #if ACTIVE_EFFECT == EFFECT_MODULATIONS
 #include "cPhaser.h"
+#include "TCMPlacement.h"
+#ifdef MONITOR
+#include "cMidiSysEx.h"
+#endif
 
 namespace DadEffect {
 
@@ -24,6 +28,53 @@ constexpr float FAD_STEP       = 1.0f / 10000; // Fade step for mode switching
 // Mode parameters array definition
 constexpr std::array<ModeParam, NB_PH_MODE> cPhaser::m_ModeParams;
 
+//**********************************************************************************
+// All-pass kernels
+//**********************************************************************************
+
+// ---------------------------------------------------------------------------------
+// Method: MakeKernels
+// Description: Builds the kernel table from m_ModeParams
+// ---------------------------------------------------------------------------------
+template<std::size_t... Modes>
+constexpr std::array<PhaserKernel_t, NB_PH_MODE> cPhaser::MakeKernels(std::index_sequence<Modes...>) {
+    return {{ &PhaserKernel<m_ModeParams[Modes].m_NbFilter, m_ModeParams[Modes].m_APFOrder>... }};
+}
+
+// Kernel table (one specialisation per mode)
+const std::array<PhaserKernel_t, NB_PH_MODE> cPhaser::m_Kernels =
+    cPhaser::MakeKernels(std::make_index_sequence<NB_PH_MODE>{});
+
+#ifdef MONITOR
+constexpr uint32_t PHASER_PROBE_SAMPLES = 4800;    // 100 ms of samples at 48 kHz
+
+// ---------------------------------------------------------------------------------
+// Method: ProbeKernel
+// Description: Cycles per stereo sample of the kernel of a mode
+// ---------------------------------------------------------------------------------
+template<uint8_t Mode>
+float cPhaser::ProbeKernel(uint32_t CallbackUserData) {
+    cPhaser* pThis = reinterpret_cast<cPhaser*>(CallbackUserData);
+
+    DadDSP::sAPFState  APFState[NB_MAX_TOTAL_FILTERS];
+    DadDSP::sAPF2State APF2State[NB_MAX_TOTAL_FILTERS];
+    memcpy(APFState, pThis->m_APFState, sizeof(APFState));
+    memcpy(APF2State, pThis->m_APF2State, sizeof(APF2State));
+
+    uint32_t Start = DWT->CYCCNT;
+    for (uint32_t n = 0; n < PHASER_PROBE_SAMPLES; n++) {
+        float Left = 0.5f;
+        float Right = -0.5f;
+        m_Kernels[Mode](pThis->m_AllPass, pThis->m_AllPass2, Left, Right);
+    }
+    uint32_t Cycles = DWT->CYCCNT - Start;
+
+    memcpy(pThis->m_APFState, APFState, sizeof(APFState));
+    memcpy(pThis->m_APF2State, APF2State, sizeof(APF2State));
+    return static_cast<float>(Cycles) / PHASER_PROBE_SAMPLES;
+}
+#endif
+
 //**********************************************************************************
 // Class: cPhaser
 // Description: Implements phaser audio effect
@@ -137,8 +188,19 @@ void cPhaser::onInitialize() {
     m_SwitchMode = 0;
     m_ActiveMode = 0;
     m_NewMode = 0;
+    m_pKernel = m_Kernels[m_ActiveMode];
     m_Fad = 1.0f;
     m_DeepValue = 0.0f;
+
+#ifdef MONITOR
+    // Kernel cost of each mode, reported by the SysEx BENCH command
+    DadDrivers::__MidiSysEx.addBenchProbe("Phaser m1", ProbeKernel<0>, (uint32_t) this);
+    DadDrivers::__MidiSysEx.addBenchProbe("Phaser m2", ProbeKernel<1>, (uint32_t) this);
+    DadDrivers::__MidiSysEx.addBenchProbe("Phaser m3", ProbeKernel<2>, (uint32_t) this);
+    DadDrivers::__MidiSysEx.addBenchProbe("Phaser m4", ProbeKernel<3>, (uint32_t) this);
+    DadDrivers::__MidiSysEx.addBenchProbe("Phaser m5", ProbeKernel<4>, (uint32_t) this);
+    DadDrivers::__MidiSysEx.addBenchProbe("Phaser m6", ProbeKernel<5>, (uint32_t) this);
+#endif
 }
 
 // ---------------------------------------------------------------------------------
@@ -172,7 +234,7 @@ void cPhaser::onDesactivate() {
 // Method: Process
 // Description: Audio processing method - applies phaser effect to input buffer
 // ---------------------------------------------------------------------------------
-void cPhaser::Process(AudioBuffer* pIn, AudioBuffer* pOut, DadGUI::eEffectState_t State, bool Silence) {
+ITCM_CODE void cPhaser::Process(AudioBuffer* pIn, AudioBuffer* pOut, DadGUI::eEffectState_t State, bool Silence) {
     // Step 1: Update LFOs
     m_LeftLFO.Step();
     m_RightLFO.Step();
@@ -190,6 +252,7 @@ void cPhaser::Process(AudioBuffer* pIn, AudioBuffer* pOut, DadGUI::eEffectState_
         // Fade out current mode
         if (m_Fad <= 0.0f) {
             m_ActiveMode = m_NewMode;  // Switch to new mode
+            m_pKernel = m_Kernels[m_ActiveMode]; // Select the kernel of the new mode
             m_SwitchMode = 2;          // Start fade in
         } else {
             m_Fad -= FAD_STEP;         // Continue fading out
@@ -209,35 +272,9 @@ void cPhaser::Process(AudioBuffer* pIn, AudioBuffer* pOut, DadGUI::eEffectState_
     // Step 3: Initialize processing buffers
     float OutLeft = pIn->Left;
     float OutRight = pIn->Right;
-    float OutLeftTemp = OutLeft;
-    float OutRightTemp = OutRight;
-    float OutLeftTemp2 = OutLeft;
-    float OutRightTemp2 = OutRight;
 
-    // Step 4: Apply all-pass filter cascade
-    std::size_t NbFilter = m_ModeParams[m_ActiveMode].m_NbFilter - 1;
-    for (std::size_t Index = 0; Index < NB_MAX_FILTERS; Index++) {
-        std::size_t IndexRight = Index + NB_MAX_FILTERS;
-
-        // Process through first-order filters
-        OutLeftTemp = m_AllPass[Index].Process(OutLeftTemp);
-        OutRightTemp = m_AllPass[IndexRight].Process(OutRightTemp);
-
-        // Process through second-order filters
-        OutLeftTemp2 = m_AllPass2[Index].Process(OutLeftTemp);
-        OutRightTemp2 = m_AllPass2[IndexRight].Process(OutRightTemp);
-
-        // Select output based on filter order and number of filters
-        if (Index == NbFilter) {
-            if (m_ModeParams[m_ActiveMode].m_APFOrder == 1) {
-                OutLeft = OutLeftTemp;
-                OutRight = OutRightTemp;
-            } else {
-                OutLeft = OutLeftTemp2;
-                OutRight = OutRightTemp2;
-            }
-        }
-    }
+    // Step 4: Apply the all-pass cascade of the active mode
+    m_pKernel(m_AllPass, m_AllPass2, OutLeft, OutRight);
 
     // Step 5: Update one filter frequency per call (round-robin)
     setFilterFreq(m_CtMaJFilter);
@@ -9,6 +9,7 @@
 #include "@EffectsConfig.h"
 #if ACTIVE_EFFECT == EFFECT_MODULATIONS
 #include "cTremoloVibrato.h"
+#include "TCMPlacement.h"
 
 // Vibrato constants
 constexpr float DELAY_MAX_TIME = 0.02f;  // Maximum modulation delay time in seconds
@@ -17,6 +18,9 @@ constexpr float DELAY_MAX_TIME = 0.02f;  // Maximum modulation delay time in sec
 constexpr float FREQ_MIN = 0.5f;  // Minimum LFO frequency in Hz
 constexpr float FREQ_MAX = 9.0f;  // Maximum LFO frequency in Hz
 
+// MIDI clock sync divisions: LFO cycle length in quarter notes (index 0 = free running)
+constexpr float SYNC_BEATS[] = {0.0f, 2.0f, 1.0f, 0.5f, 1.0f / 3.0f, 0.25f};
+
 //**********************************************************************************
 // Utility function: ceil_to_uint
 // Description: Rounds a float up to the next unsigned integer
@@ -78,6 +82,9 @@ void cTremoloVibrato::onInitialize(){
 	// Stereo mode parameter
 	m_StereoMode.Init(TREMOLO_ID, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, nullptr, 0, 0.0f, 26);
 
+	// MIDI clock sync parameter
+	m_Sync.Init(TREMOLO_ID, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, nullptr, 0, 0.0f, 27);
+
     // =============================================================================
     // VIEW SETUP SECTION
     // =============================================================================
@@ -96,6 +103,13 @@ void cTremoloVibrato::onInitialize(){
 	m_StereoModeView.AddDiscreteValue("Trem", "Tremolo St.");                     // Tremolo stereo
 	m_StereoModeView.AddDiscreteValue("Vibr", "Vibrato St.");                     // Vibrato stereo
 	m_StereoModeView.AddDiscreteValue("Both", "Both St.");                        // Both stereo effects
+	m_SyncView.Init(&m_Sync, "Sync", "MIDI Sync");                                // MIDI clock sync view
+	m_SyncView.AddDiscreteValue("Off", "Free running");                           // No sync
+	m_SyncView.AddDiscreteValue("1/2", "Half note");                              // 2 beats
+	m_SyncView.AddDiscreteValue("1/4", "Quarter note");                           // 1 beat
+	m_SyncView.AddDiscreteValue("1/8", "Eighth note");                            // 1/2 beat
+	m_SyncView.AddDiscreteValue("1/8T", "Eighth triplet");                        // 1/3 beat
+	m_SyncView.AddDiscreteValue("1/16", "Sixteenth note");                        // 1/4 beat
 
     // =============================================================================
     // MENU GROUPING SECTION
@@ -106,7 +120,7 @@ void cTremoloVibrato::onInitialize(){
 	m_ItemTremoloMenu.Init(&m_TremoloDeepView, nullptr, &m_VibratoDeepView); 		// Tremolo menu items
 #endif
 	m_ItemLFOMenu.Init(&m_LFOShapeView, &m_LFORatioView, &m_FreqView);              // LFO menu items
-	m_ItemStereoMode.Init(&m_StereoModeView, nullptr, nullptr);                     // Stereo mode menu item
+	m_ItemStereoMode.Init(&m_StereoModeView, nullptr, &m_SyncView);                 // Stereo mode / sync menu item
 
     // =============================================================================
     // MAIN MENU CONFIGURATION SECTION
@@ -157,7 +171,13 @@ void cTremoloVibrato::onDesactivate(){
 // Method: Process
 // Description: Audio processing method - applies effect to input buffer
 // ---------------------------------------------------------------------------------
-void cTremoloVibrato::Process(AudioBuffer* pIn, AudioBuffer* pOut, DadGUI::eEffectState_t State, bool Silence){
+ITCM_CODE void cTremoloVibrato::Process(AudioBuffer* pIn, AudioBuffer* pOut, DadGUI::eEffectState_t State, bool Silence){
+    // Follow the MIDI clock (once per audio block)
+	if (++m_SyncCounter >= AUDIO_BUFFER_SIZE) {
+		m_SyncCounter = 0;
+		UpdateClockSync();
+	}
+
     // Update LFO phases
 	m_LFOLeft.Step();
 	m_LFORight.Step();
@@ -248,12 +268,46 @@ void cTremoloVibrato::Process(AudioBuffer* pIn, AudioBuffer* pOut, DadGUI::eEffe
 	}
 }
 
+// ---------------------------------------------------------------------------------
+// Method: UpdateClockSync
+// Description: Locks the LFOs on the MIDI clock when a sync division is
+//              selected, restores the free running frequency otherwise
+// ---------------------------------------------------------------------------------
+void cTremoloVibrato::UpdateClockSync(){
+	const DadDrivers::cMidiClock& Clock = DadDrivers::__MidiClock;
+	uint32_t Sync = static_cast<uint32_t>(m_Sync.getValue());
+
+	if ((Sync == 0) || (Sync >= (sizeof(SYNC_BEATS) / sizeof(SYNC_BEATS[0]))) || !Clock.isLocked()) {
+		if (m_ClockSynced) {
+            // Back to the Freq parameter
+			m_ClockSynced = false;
+			SpeedChange(&m_Freq, (uint32_t)this);
+		}
+		return;
+	}
+
+    // Lock both LFOs on the clock phase, right LFO keeps its half cycle offset
+	float NbBeats = SYNC_BEATS[Sync];
+	float Step = Clock.getPhaseIncrement(NbBeats, SAMPLING_RATE);
+	float Phase = Clock.getPhase(NbBeats);
+	m_LFOLeft.syncToPhase(Phase, Step);
+	m_LFORight.syncToPhase(Phase + 0.5f, Step);
+
+    // Vibrato depth compensation for the synced frequency
+	float Freq = Step * SAMPLING_RATE;
+	if (Freq < FREQ_MIN) Freq = FREQ_MIN;
+	else if (Freq > FREQ_MAX) Freq = FREQ_MAX;
+	m_CoefComp = FREQ_MIN / Freq;
+	m_ClockSynced = true;
+}
+
 // ---------------------------------------------------------------------------------
 // Method: SpeedChange (Callback)
 // Description: Updates LFO frequency and compensation factor when speed changes
 // ---------------------------------------------------------------------------------
 void cTremoloVibrato::SpeedChange(DadDSP::cParameter *pParameter, uint32_t CallbackUserData){
 	cTremoloVibrato *pthis = reinterpret_cast<cTremoloVibrato *>(CallbackUserData);
+	if (pthis->m_ClockSynced) return;  // Frequency driven by the MIDI clock
 
     // Update LFO frequencies
 	pthis->m_LFOLeft.setFreq(pParameter->getValue());
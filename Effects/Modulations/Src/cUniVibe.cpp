@@ -9,6 +9,7 @@
 #include "@EffectsConfig.h"
 #if ACTIVE_EFFECT == EFFECT_MODULATIONS
 #include "cUniVibe.h"
+#include "TCMPlacement.h"
 
 // Frequency constants for LFO
 constexpr float UN_LFO_FREQ_MAX = 10;
@@ -139,7 +140,7 @@ void cUniVibe::onDesactivate() {
 // Method: Process
 // Description: Audio processing method - applies UniVibe phaser effect
 // ---------------------------------------------------------------------------------
-void cUniVibe::Process(AudioBuffer* pIn, AudioBuffer* pOut, DadGUI::eEffectState_t State, bool Silence) {
+ITCM_CODE void cUniVibe::Process(AudioBuffer* pIn, AudioBuffer* pOut, DadGUI::eEffectState_t State, bool Silence) {
     // Update LFO position
     m_LFO.Step();
 
@@ -13,14 +13,16 @@
 #include "cDCO.h"
 #include "BiquadFilter.h"
 #include "cDelayLine.h"
-#include "cFastLFO.h"
+#include "cLFOBank.h"
 #include "cPitchShifter.h"
 
+#ifndef EFFECT_CHAIN_SLOT    // Hosted by a cEffectChain: the chain declares the effect
 #define DECLARE_EFFECT DadEffect::cReverb __Effect
 #define EFFECT_NAME "Reverb"
-#define EFFECT_VERSION "Version 1.0"
+#define EFFECT_VERSION "Version 1.2"
 #define EFFECT_SPLATCH_SCREEN "Reverb.png"
-constexpr uint32_t EFFECT_BUILD = BUILD_ID('R', 'E', 'V', '1');
+constexpr uint32_t EFFECT_BUILD = BUILD_ID('R', 'E', 'V', '4');   // 2: engine parameter, 3: freeze, 4: freeze not saved
+#endif
 
 namespace DadEffect {
 
@@ -52,15 +54,45 @@ constexpr float             DAMPING_Q            = 2.0f;
 // FDN Feedback Delay Network
 constexpr uint16_t			FDM_MOD_MAX_SAMPLES = 80;
 constexpr uint16_t			FDM_NUM_DELAYS  = 16;
-constexpr float				FDM_MAX_DELAY_S = 0.5f;
 constexpr float 			FDM_MIN_LEN_MULTIPLIER = 0.6f;
 constexpr float 			FDM_MAX_LEN_MULTIPLIER = 3.0f;
-constexpr uint32_t 			FDM_BUFFER_SIZE = static_cast<uint32_t>(FDM_MOD_MAX_SAMPLES + (FDM_MAX_LEN_MULTIPLIER * FDM_MAX_DELAY_S * SAMPLING_RATE));
-constexpr uint32_t 			FDM_BUFFER_SIZE_NO_MOD = static_cast<uint32_t>(FDM_MAX_LEN_MULTIPLIER * FDM_MAX_DELAY_S * SAMPLING_RATE);
+constexpr float 			FDM_MAX_SIZE_MULTIPLIER = FDM_MIN_LEN_MULTIPLIER + FDM_MAX_LEN_MULTIPLIER; // Size at 100%
+constexpr uint32_t 			FDM_LINE_MARGIN = 2;		// Interpolated read of the longest delay
+
+// True-stereo engine: the even FDN lines carry the left channel, the odd lines
+// the right one. Each half is mixed by its own 8-point Hadamard transform, the
+// halves are coupled by a rotation of the last butterfly stage.
+constexpr float				FDM_STEREO_CROSS = 0.30f;	// Sine of the left/right coupling rotation
+constexpr float				REVERB_ENGINE_FADE = 0.050f;	// Engine change crossfade (s)
+
+// Freeze: the late reverb is brought to infinite sustain (unity FDN gains, no
+// damping, no input), one loop is recorded to SDRAM and played back instead of
+// the FDN. The loop ends are spliced over REVERB_FREEZE_FADE. The loop output
+// keeps the effect out of idle.
+constexpr float				REVERB_FREEZE_LOOP = 1.500f;	// Recorded loop (s)
+constexpr float				REVERB_FREEZE_FADE = 0.050f;	// Gain ramps, FDN/loop crossfade and loop splice (s)
+
+// Idle detection: pre-delay + early + longest FDN line (6007 samples x 3.6) with margin
+constexpr float				REVERB_IDLE_HOLD = 0.700f;
+
+// LFO bank lanes: one per FDN delay, then the two damping LFOs
+constexpr uint16_t			LFO_LANE_DAMPING  = FDM_NUM_DELAYS;
+constexpr uint16_t			LFO_LANE_DAMPING2 = FDM_NUM_DELAYS + 1;
+constexpr uint16_t			NUM_LFO_LANES     = FDM_NUM_DELAYS + 2;
 
 
 constexpr uint32_t			REVERB_ID = BUILD_ID('R', 'E', 'V', 'B');
 
+//**********************************************************************************
+// Freeze states
+//**********************************************************************************
+enum class eFreezeState : uint8_t {
+    Off,        // Normal reverb
+    Capture,    // FDN ramped to infinite sustain, then one loop recorded
+    Play,       // Loop played back, FDN stopped once crossfaded
+    Release     // FDN restored and crossfaded back in
+};
+
 //**********************************************************************************
 // class cReverb
 //**********************************************************************************
@@ -108,12 +140,23 @@ protected:
     static void WidthChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData);
     static void ModDepthChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData);
     static void ShimmerChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData);
+    static void EngineChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData);
+    static void FreezeChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData);
 
     // -----------------------------------------------------------------------------
     // DSP Helper Functions
     // -----------------------------------------------------------------------------
     void updateDelayLengths();
 
+    // -----------------------------------------------------------------------------
+    // Late reverb: diffusion, FDN and shimmer, returns the stereo taps
+    void processLate(float preDelayedL, float preDelayedR, float& lateL, float& lateR);
+
+    // -----------------------------------------------------------------------------
+    // Freeze state machine, ramps and loop record / playback
+    void updateFreeze();
+    void readLoop(float& loopL, float& loopR);
+
     // =============================================================================
     // Protected Member Variables
     // =============================================================================
@@ -137,6 +180,8 @@ protected:
     DadGUI::cUIParameter                 m_Damping;
     DadGUI::cUIParameter                 m_DampingMod;
     DadGUI::cUIParameter                 m_Size;
+    DadGUI::cUIParameter                 m_Engine;
+    DadGUI::cUIParameter                 m_Freeze;
 
     // -----------------------------------------------------------------------------
     // Parameter view declarations
@@ -153,6 +198,8 @@ protected:
     DadGUI::cParameterNumNormalView     m_DampingView;
     DadGUI::cParameterNumNormalView     m_DampingModView;
     DadGUI::cParameterNumNormalView     m_SizeView;
+    DadGUI::cParameterDiscretView       m_EngineView;
+    DadGUI::cParameterDiscretView       m_FreezeView;
 
     // -----------------------------------------------------------------------------
     // Panel declarations
@@ -160,6 +207,7 @@ protected:
     DadGUI::cPanelOfParameterView       m_ParameterEffectPanel;
     DadGUI::cPanelOfParameterView       m_ParameterTonePanel;
     DadGUI::cPanelOfParameterView       m_ParameterAdvancedPanel;
+    DadGUI::cPanelOfParameterView       m_ParameterFreezePanel;
 
     // =============================================================================
     // DSP Components
@@ -180,10 +228,11 @@ protected:
     // -----------------------------------------------------------------------------
     // Diffusion network (allpass filters)
     DadDSP::cDelayLine      m_AllpassLine[NUM_ALLPASS];
+    DadDSP::cDelayLine      m_AllpassLineR[NUM_ALLPASS];   // Right channel (true-stereo engine)
     float                   m_AllpassCoeff[NUM_ALLPASS];
 
     // -----------------------------------------------------------------------------
-    // Main FDN delay network (mono late reverb)
+    // Main FDN delay network (mono or true-stereo late reverb)
     DadDSP::cDelayLine      m_DelayLine[FDM_NUM_DELAYS];
     uint32_t 				m_CurrentDelayLengths[FDM_NUM_DELAYS];
     float 					m_SizeMultiplier;
@@ -191,7 +240,7 @@ protected:
     // -----------------------------------------------------------------------------
     // FD Modulation
 	float 					m_ModDepth;
-    DadDSP::cFastLFO<2024>  m_FDM_ModLFO[FDM_NUM_DELAYS];
+    DadDSP::cLFOBank<NUM_LFO_LANES> m_LFOBank;   // FDN modulation and damping LFOs
 
     // -----------------------------------------------------------------------------
     // Damping
@@ -199,8 +248,6 @@ protected:
     DadDSP::sFilterState	m_DampingFilterStates[FDM_NUM_DELAYS];
     float 					m_DampingCutoff;
 
-    DadDSP::cFastLFO<2024>   m_DampingLFO;
-    DadDSP::cFastLFO<2024>   m_DampingLFO2;
     float					m_MemLFO_Value;
     float 					m_DampingLFO_Depth;
 
@@ -218,6 +265,20 @@ protected:
 	 DadDSP::cPitchShifter	m_PitchShifterUp;
 	 DadDSP::cBiQuad        m_ShimmerHPF;
 	 float                  m_ShimmerDeep;
+
+	 // Engine: 0 mono, 1 true stereo, crossfaded in between
+	 float                  m_StereoMix;
+	 float                  m_StereoTarget;
+
+	 // Freeze
+	 eFreezeState           m_FreezeState;
+	 bool                   m_FreezeTarget;     // Set by the parameter, applied in onProcess
+	 float                  m_FreezeFade;       // 0 normal FDN, 1 infinite sustain
+	 float                  m_LoopMix;          // Late output: 0 FDN, 1 loop
+	 uint32_t               m_RecordPos;
+	 uint32_t               m_LoopPos;
+	 float*                 m_pLoopL;
+	 float*                 m_pLoopR;
 };
 
 }  // namespace DadEffect
@@ -7,9 +7,11 @@
 //==================================================================================
 //==================================================================================
 #include "@EffectsConfig.h"
-#if ACTIVE_EFFECT == EFFECT_REVERB
+#if (ACTIVE_EFFECT == EFFECT_REVERB) || defined(CHAIN_SLOT_REVERB)
 #include "Sections.h"
+#include "TCMPlacement.h"
 #include "Reverb.h"
+#include "cMemoryPlan.h"
 #include <cmath>
 
 namespace DadEffect {
@@ -17,18 +19,8 @@ namespace DadEffect {
 //**********************************************************************************
 // Delay buffers and configuration
 //**********************************************************************************
-#define ALIGN_32 __attribute__((aligned(32)))
 
 // -----------------------------------------------------------------------------
-// Pre-Delay
-RAM_D1 ALIGN_32 static float __PreDelayBufferL[PRE_DELAYS_BUFFER_SIZE+128];
-RAM_D1 ALIGN_32 static float __PreDelayBufferR[PRE_DELAYS_BUFFER_SIZE+128];
-
-// -----------------------------------------------------------------------------
-// Early Delay
-RAM_D1 ALIGN_32 static float __EarlyBufferL[NUM_EARLY_PER_CHANNEL][EARLY_DELAYS_BUFFER_SIZE+128];
-RAM_D1 ALIGN_32 static float __EarlyBufferR[NUM_EARLY_PER_CHANNEL][EARLY_DELAYS_BUFFER_SIZE+128];
-
 // Early reflections configuration /!\ max 60ms = 2880
 static const uint32_t __EarlyDelaysL[NUM_EARLY_PER_CHANNEL] = {
     199, 353, 547, 769, 1019, 1361
@@ -42,9 +34,6 @@ static const float __EarlyGains[NUM_EARLY_PER_CHANNEL] = {
 };
 
 // -----------------------------------------------------------------------------
-// Diffusion network
-ALIGN_32 static float __AllpassBuffer[NUM_ALLPASS][ALLPASS_BUFFER_SIZE+128];
-
 // Allpass delay lengths  /!\ max 20ms = 960
 static const uint32_t __AllpassLengths[NUM_ALLPASS] = {
 		149, 263, 389, 509, 641
@@ -55,17 +44,72 @@ static const float 	__AllpassCoeff[NUM_ALLPASS] = {
 };
 
 // -----------------------------------------------------------------------------
-// FDN Feedback Delay Network
-SDRAM_SECTION ALIGN_32 static float __FDM_DelayBuffer[FDM_NUM_DELAYS][FDM_BUFFER_SIZE+256];
-
-// FDM delay lengths /!\ max 0.5s = 24000
-static const float __BaseDelayLengths[FDM_NUM_DELAYS] = {
+// FDM delay lengths at size multiplier 1
+static constexpr float __BaseDelayLengths[FDM_NUM_DELAYS] = {
 	1493.7f, 1787.3f, 2087.9f, 2383.1f,
 	2683.7f, 2999.3f, 3217.7f, 3539.9f,
 	3863.3f, 4177.1f, 4441.7f, 4787.9f,
 	5087.3f, 5399.1f, 5701.7f, 6007.3f
 };
 
+// Longest unmodulated delay of a FDN line (size 100%)
+static constexpr uint32_t FDMLineMaxLength(uint16_t Line) {
+	return static_cast<uint32_t>(__BaseDelayLengths[Line] * FDM_MAX_SIZE_MULTIPLIER);
+}
+
+// FDN line sizes, rounded to cache lines so that every line starts aligned
+static constexpr uint32_t FDMLineSize(uint16_t Line) {
+	return (FDMLineMaxLength(Line) + FDM_MOD_MAX_SAMPLES + FDM_LINE_MARGIN + 7) & ~7u;
+}
+static constexpr uint32_t FDMTotalSize() {
+	uint32_t Size = 0;
+	for (uint16_t Line = 0; Line < FDM_NUM_DELAYS; Line++) Size += FDMLineSize(Line);
+	return Size;
+}
+
+//**********************************************************************************
+// Memory plan
+// The allpasses, early reflections and pre-delay are read at every sample and
+// short: they go to internal RAM. Each FDN line is sized for its own longest
+// delay instead of the longest delay of the network. The freeze loop is only
+// used while frozen and goes to SDRAM.
+//**********************************************************************************
+enum eReverbRegion : uint32_t {
+	REV_REGION_ALLPASS = 0,
+	REV_REGION_ALLPASS_R,
+	REV_REGION_EARLY_L,
+	REV_REGION_EARLY_R,
+	REV_REGION_PRE_DELAY,
+	REV_REGION_FDN,
+	REV_REGION_FREEZE,
+	REV_NB_REGIONS
+};
+
+constexpr uint32_t ALLPASS_LINE_SIZE   = ALLPASS_BUFFER_SIZE + 128;
+constexpr uint32_t EARLY_LINE_SIZE     = EARLY_DELAYS_BUFFER_SIZE + 128;
+constexpr uint32_t PRE_DELAY_LINE_SIZE = PRE_DELAYS_BUFFER_SIZE + 128;
+
+// Freeze loop: the played part, then the splice recorded past its end
+constexpr uint32_t FREEZE_LOOP_LENGTH   = static_cast<uint32_t>(REVERB_FREEZE_LOOP * SAMPLING_RATE);
+constexpr uint32_t FREEZE_SPLICE_LENGTH = static_cast<uint32_t>(REVERB_FREEZE_FADE * SAMPLING_RATE);
+constexpr uint32_t FREEZE_RECORD_LENGTH = FREEZE_LOOP_LENGTH + FREEZE_SPLICE_LENGTH;
+constexpr uint32_t FREEZE_LINE_SIZE     = (FREEZE_RECORD_LENGTH + 7) & ~7u;
+
+constexpr DadUtilities::sMemRegion REVERB_REGIONS[REV_NB_REGIONS] = {
+	DadUtilities::HotFloatRegion("Allpass",   NUM_ALLPASS * ALLPASS_LINE_SIZE),
+	DadUtilities::HotFloatRegion("AllpassR",  NUM_ALLPASS * ALLPASS_LINE_SIZE),
+	DadUtilities::HotFloatRegion("EarlyL",    NUM_EARLY_PER_CHANNEL * EARLY_LINE_SIZE),
+	DadUtilities::HotFloatRegion("EarlyR",    NUM_EARLY_PER_CHANNEL * EARLY_LINE_SIZE),
+	DadUtilities::HotFloatRegion("PreDelay",  2 * PRE_DELAY_LINE_SIZE),
+	DadUtilities::FloatRegion("FDN",          FDMTotalSize(), DadUtilities::eMemBank::SDRAM),
+	DadUtilities::FloatRegion("Freeze",       2 * FREEZE_LINE_SIZE, DadUtilities::eMemBank::SDRAM)
+};
+
+constexpr DadUtilities::cMemoryPlan<REV_NB_REGIONS> REVERB_MEMORY_PLAN(REVERB_REGIONS);
+static_assert(REVERB_MEMORY_PLAN.fits(), "Reverb buffers exceed the memory budgets (see cMemoryPlan.h)");
+
+DECLARE_MEMORY_ARENAS(__ReverbArena, REVERB_MEMORY_PLAN)
+
 // Stereo Panoramisation fixe
 static const float pan_left[16] = {
 	0.85f, 0.25f, 0.70f, 0.40f,
@@ -81,19 +125,48 @@ static const float pan_right[16] = {
 	0.35f, 0.90f, 0.20f, 0.80f
 };
 
+// True-stereo output taps: left from the even lines, right from the odd lines.
+// Alternate signs and spread gains decorrelate the two outputs.
+static const float __StereoTapsL[FDM_NUM_DELAYS / 2] = {
+	0.90f, -0.75f, 0.85f, -0.60f, 0.80f, -0.70f, 0.65f, -0.95f
+};
+
+static const float __StereoTapsR[FDM_NUM_DELAYS / 2] = {
+	-0.80f, 0.90f, -0.65f, 0.85f, -0.95f, 0.60f, 0.75f, -0.70f
+};
+
 // Pre calculed constants
 constexpr float INV_SQRT2 = 0.7071067811865475f;
+constexpr float SQRT2 = 1.4142135623730951f;
 constexpr float INV_SQRT16 = 0.25f;
 constexpr float MyPI = 3.14159265358979323846f;
 constexpr float ONE_OVER_SAMPLING_RATE = 1.0f / SAMPLING_RATE;
 
 // Conservation d'énergie (standard)
 constexpr float INPUT_GAIN = 1.0f / std::sqrt(static_cast<float>(FDM_NUM_DELAYS));
+constexpr float INPUT_GAIN_STEREO = 1.0f / std::sqrt(static_cast<float>(FDM_NUM_DELAYS / 2));
+
+// Last butterfly of the true-stereo engine: sqrt(2) x rotation (1, 1 = Hadamard)
+constexpr float STEREO_DIRECT = SQRT2 * std::sqrt(1.0f - FDM_STEREO_CROSS * FDM_STEREO_CROSS);
+constexpr float STEREO_CROSS  = SQRT2 * FDM_STEREO_CROSS;
+
+constexpr float ENGINE_FADE_STEP = 1.0f / (REVERB_ENGINE_FADE * SAMPLING_RATE);
+constexpr float FREEZE_FADE_STEP = 1.0f / FREEZE_SPLICE_LENGTH;
 
 //**********************************************************************************
 // Fast Math Helpers (Inlined)
 //**********************************************************************************
 
+// -----------------------------------------------------------------------------
+// Linear ramp of Value toward Target
+// -----------------------------------------------------------------------------
+inline float RampTo(float Value, float Target, float Step) {
+    if (Target > Value) {
+        return (Value + Step < Target) ? Value + Step : Target;
+    }
+    return (Value - Step > Target) ? Value - Step : Target;
+}
+
 // -----------------------------------------------------------------------------
 // Optimized Hadamard Matrix (N=16) - Inlined
 // -----------------------------------------------------------------------------
@@ -189,6 +262,93 @@ inline void FastHadamardMatrix16(float* data) {
     // -------------------------------------------------------------------------
 }
 
+// -----------------------------------------------------------------------------
+// True-stereo feedback matrix (N=16)
+// -----------------------------------------------------------------------------
+// Stages 1 to 3 of FastHadamardMatrix16 only pair lines of the same parity:
+// they are one 8-point Hadamard transform on the even (left) lines and one on
+// the odd (right) lines. The stride 1 stage, which couples the two halves, is
+// replaced by the reflection  a' = Direct.a + Cross.b,  b' = Cross.a - Direct.b
+// Direct = Cross = 1 gives back FastHadamardMatrix16, sqrt(2) x (cos, sin)
+// keeps the matrix orthogonal with less left/right coupling.
+// -----------------------------------------------------------------------------
+inline void FastHadamardMatrix16Stereo(float* data, float Direct, float Cross) {
+    float t1[16];
+
+    // Stage 1: stride 8
+    for(int i=0; i<8; ++i) {
+        float a = data[i];
+        float b = data[i+8];
+        t1[i]   = a + b;
+        t1[i+8] = a - b;
+    }
+
+    // Stage 2: stride 4
+    for(int i=0; i<4; ++i) {
+        float a = t1[i];
+        float b = t1[i+4];
+        data[i]   = a + b;
+        data[i+4] = a - b;
+        a = t1[i+8];
+        b = t1[i+12];
+        data[i+8]  = a + b;
+        data[i+12] = a - b;
+    }
+
+    // Stage 3: stride 2
+    for(int i=0; i<16; i+=4) {
+        float a = data[i];
+        float b = data[i+2];
+        t1[i]   = a + b;
+        t1[i+2] = a - b;
+        a = data[i+1];
+        b = data[i+3];
+        t1[i+1] = a + b;
+        t1[i+3] = a - b;
+    }
+
+    // Stage 4: left/right coupling
+    for(int i=0; i<16; i+=2) {
+        float a = t1[i];
+        float b = t1[i+1];
+        data[i]   = Direct * a + Cross * b;
+        data[i+1] = Cross * a - Direct * b;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Allpass diffusion cascade
+// -----------------------------------------------------------------------------
+inline float Diffuse(DadDSP::cDelayLine* pLines, float diffused) {
+    for(int i = 0; i < NUM_ALLPASS; i++) {
+        float delayed = pLines[i].Pull(__AllpassLengths[i]);
+        pLines[i].Push( diffused + __AllpassCoeff[i] * delayed);
+        diffused = -diffused + delayed;
+    }
+    return diffused;
+}
+
+// -----------------------------------------------------------------------------
+// Late reverb output taps
+// -----------------------------------------------------------------------------
+inline void MonoTaps(const float* delayOuts, float& lateL, float& lateR) {
+    lateL = 0.0f;
+    lateR = 0.0f;
+    for (int i = 0; i < FDM_NUM_DELAYS; i++) {
+        lateL += delayOuts[i] * pan_left[i];
+        lateR += delayOuts[i] * pan_right[i];
+    }
+}
+
+inline void StereoTaps(const float* delayOuts, float& lateL, float& lateR) {
+    lateL = 0.0f;
+    lateR = 0.0f;
+    for (int i = 0; i < FDM_NUM_DELAYS / 2; i++) {
+        lateL += delayOuts[2 * i] * __StereoTapsL[i];
+        lateR += delayOuts[2 * i + 1] * __StereoTapsR[i];
+    }
+}
+
 //**********************************************************************************
 // cReverb
 //**********************************************************************************
@@ -213,48 +373,73 @@ void cReverb::onInitialize() {
 
 	m_ShimmerDeep = 0.0f;
 
+	// Idle detection must cover the silent gaps of the tail
+	m_Idle.setHoldTime(REVERB_IDLE_HOLD);
+
     // -----------------------------------------------------------------------------
 	// Pre-delay initialization
-    m_PreDelayLineL.Initialize(__PreDelayBufferL, PRE_DELAYS_BUFFER_SIZE);
+    float* pPreDelay = REVERB_MEMORY_PLAN.getBuffer<float>(__ReverbArena, REV_REGION_PRE_DELAY);
+    m_PreDelayLineL.Initialize(pPreDelay, PRE_DELAYS_BUFFER_SIZE);
     m_PreDelayLineL.Clear();
-    m_PreDelayLineR.Initialize(__PreDelayBufferR, PRE_DELAYS_BUFFER_SIZE);
+    m_PreDelayLineR.Initialize(pPreDelay + PRE_DELAY_LINE_SIZE, PRE_DELAYS_BUFFER_SIZE);
     m_PreDelayLineR.Clear();
     m_PreDelayLength = 0;
 
     // -----------------------------------------------------------------------------
     // Initialize early reflections
 	m_EarlyFinalGain = 0;
+    float* pEarlyL = REVERB_MEMORY_PLAN.getBuffer<float>(__ReverbArena, REV_REGION_EARLY_L);
+    float* pEarlyR = REVERB_MEMORY_PLAN.getBuffer<float>(__ReverbArena, REV_REGION_EARLY_R);
     for(int i = 0; i < NUM_EARLY_PER_CHANNEL; i++) {
-        m_EarlyReflectionsL[i].Initialize(__EarlyBufferL[i], EARLY_DELAYS_BUFFER_SIZE);
+        m_EarlyReflectionsL[i].Initialize(pEarlyL + i * EARLY_LINE_SIZE, EARLY_DELAYS_BUFFER_SIZE);
         m_EarlyReflectionsL[i].Clear();
-        m_EarlyReflectionsR[i].Initialize(__EarlyBufferR[i], EARLY_DELAYS_BUFFER_SIZE);
+        m_EarlyReflectionsR[i].Initialize(pEarlyR + i * EARLY_LINE_SIZE, EARLY_DELAYS_BUFFER_SIZE);
         m_EarlyReflectionsR[i].Clear();
         m_EarlyFinalGain += __EarlyGains[i];
     }
     m_EarlyFinalGain = 1.0f / m_EarlyFinalGain;
 
     // -----------------------------------------------------------------------------
-    // Initialize allpass diffusion network (mono)
+    // Initialize allpass diffusion network (mono, left in true stereo)
+    float* pAllpass = REVERB_MEMORY_PLAN.getBuffer<float>(__ReverbArena, REV_REGION_ALLPASS);
+    float* pAllpassR = REVERB_MEMORY_PLAN.getBuffer<float>(__ReverbArena, REV_REGION_ALLPASS_R);
     for(int i = 0; i < NUM_ALLPASS; i++) {
-        m_AllpassLine[i].Initialize(__AllpassBuffer[i], ALLPASS_BUFFER_SIZE);
+        m_AllpassLine[i].Initialize(pAllpass + i * ALLPASS_LINE_SIZE, ALLPASS_BUFFER_SIZE);
         m_AllpassLine[i].Clear();
+        m_AllpassLineR[i].Initialize(pAllpassR + i * ALLPASS_LINE_SIZE, ALLPASS_BUFFER_SIZE);
     }
+    m_StereoMix = 0.0f;
+    m_StereoTarget = 0.0f;
+
+    // -----------------------------------------------------------------------------
+    // Freeze loop, written before being read: no clear
+    m_pLoopL = REVERB_MEMORY_PLAN.getBuffer<float>(__ReverbArena, REV_REGION_FREEZE);
+    m_pLoopR = m_pLoopL + FREEZE_LINE_SIZE;
+    m_FreezeState = eFreezeState::Off;
+    m_FreezeTarget = false;
+    m_FreezeFade = 0.0f;
+    m_LoopMix = 0.0f;
+    m_RecordPos = 0;
+    m_LoopPos = 0;
 
     // -----------------------------------------------------------------------------
-    // Initialize main FDN delay lines (mono)
+    // Initialize main FDN delay lines (shared by both engines)
+    m_LFOBank.Initialize(SAMPLING_RATE);
+    float* pFDN = REVERB_MEMORY_PLAN.getBuffer<float>(__ReverbArena, REV_REGION_FDN);
     for(int i = 0; i < FDM_NUM_DELAYS; i++) {
-        m_DelayLine[i].Initialize(__FDM_DelayBuffer[i], FDM_BUFFER_SIZE);
+        m_DelayLine[i].Initialize(pFDN, FDMLineSize(i));
+        pFDN += FDMLineSize(i);
         m_DelayLine[i].Clear();
 
         // Initialize modulation with different phases and rates
         // f = 0.3 to 1.05 Hz
-        m_FDM_ModLFO[i].Initialise(SAMPLING_RATE, 0.3f + (float)i * 0.05f, (float)i/(float)FDM_NUM_DELAYS);
+        m_LFOBank.setLane(i, 0.3f + (float)i * 0.05f, (float)i/(float)FDM_NUM_DELAYS);
         m_DampingFilterStates[i].Reset();
     }
 
     m_DampingFilter.Initialize(SAMPLING_RATE, DAMPING_CUTOFF_INIT, 0.0f, DAMPING_Q, DadDSP::FilterType::LPF24);
-    m_DampingLFO.Initialise(SAMPLING_RATE, 0.55f, 0.0f);
-    m_DampingLFO2.Initialise(SAMPLING_RATE, 0.25f, 0.0f);
+    m_LFOBank.setLane(LFO_LANE_DAMPING, 0.55f, 0.0f);
+    m_LFOBank.setLane(LFO_LANE_DAMPING2, 0.25f, 0.0f);
     m_DampingCutoff = DAMPING_CUTOFF_INIT;
     m_MemLFO_Value = 0.0f;
     m_DampingLFO_Depth = 0.50f;
@@ -277,61 +462,60 @@ void cReverb::onInitialize() {
 	// =============================================================================
     // Initialize UI Parameters
 
-    // Time parameter: controls reverb decay time (0.1s to 10s)
-    //             Initial value, Min, Max ,   Rapid inc, Slow incr, CallBack,  Callback data,  SlopeTime,   MIDI CC
-    m_Time.Init(REVERB_ID, 4.5f, 0.1f, 10.0f,  0.5f,      0.1f,      TimeChange,(uint32_t)this, 0.5f,        20);
-
-    // Pre-delay parameter (in milliseconds)
-    //                         Initial value, Min,  Max,    Rapid inc, Slow incr, CallBack,       Callback data,   SlopeTime, MIDI CC  RealTime
-    m_PreDelay.Init(REVERB_ID, 0.0f,          0.0f, 100.0f, 10.0f,     1.0f,      PreDelayChange, (uint32_t)this, 0.3f,      21,       true);
-
-    // Mix parameter: dry/wet balance (0% to 100%)
-    //                    Initial value, Min,  Max ,   Rapid inc, Slow incr, CallBack,  Callback data,  SlopeTime, MIDI CC
-    m_Mix.Init(REVERB_ID, 40.0f,         0.0f, 100.0f, 5.0f,      1.0f,      MixChange, (uint32_t)this, 1.0f,      22);
-
-    // Modulation Depth parameter (chorus-like effect)
-    //                              Initial value, Min,  Max , Rapid inc, Slow incr, CallBack,       Callback data,  SlopeTime, MIDI CC
-    m_ModDepthParam.Init(REVERB_ID, 25.0f,         0.0f, 100,  2.0f,      0.5f,      ModDepthChange, (uint32_t)this, 0.5f,      23);
-
-    // Shimmer parameter (pitch-shifted reverb feedback)
-    //                        Initial value, Min,  Max,   Rapid inc, Slow incr, CallBack,      Callback data,  SlopeTime, MIDI CC
-    m_Shimmer.Init(REVERB_ID, 5.0f,          0.0f, 100.f, 5.f,       1.f,       ShimmerChange, (uint32_t)this, 0.4f,      24);
-
-    // Bass parameter (gain in dB for low shelf)
-    //                     Initial value, Min,    Max ,  Rapid inc, Slow incr, CallBack,   Callback data,  SlopeTime, MIDI CC
-    m_Bass.Init(REVERB_ID, 0.0f,          -12.0f, 12.0f, 1.0f,      0.5f,      BassChange, (uint32_t)this, 0.0f,      25);
-
-    // Treble parameter (gain in dB for high shelf)
-    //                       Initial value, Min,    Max ,  Rapid inc, Slow incr, CallBack,     Callback data,  SlopeTime, MIDI CC
-    m_Treble.Init(REVERB_ID, 0.0f,          -12.0f, 12.0f, 1.0f,      0.5f,      TrebleChange, (uint32_t)this, 0.0f,      26);
-
-    // Damping parameter (controls high frequency decay)
-    //                        Initial value, Min,  Max ,   Rapid inc, Slow incr, CallBack,      Callback data,  SlopeTime, MIDI CC
-    m_Damping.Init(REVERB_ID, 50.0f,         0.0f, 100.0f, 5.0f,      1.0f,      DampingChange, (uint32_t)this, 0.3f,      27);
-
-    // Damping mod parameter (controls modulation to damping frequency)
-    //                        Initial value, Min,  Max ,   Rapid inc, Slow incr, CallBack,      Callback data,        SlopeTime, MIDI CC
-    m_DampingMod.Init(REVERB_ID, 50.0f,         0.0f, 100.0f, 5.0f,      1.0f,      DampingModChange, (uint32_t)this, 0.3f,      28);
-
-    // Size parameter (room size multiplier)
-    //             Initial value, Min, Max ,   Rapid inc, Slow incr, CallBack,  Callback data,   SlopeTime, MIDI CC, RT process
-    m_Size.Init(REVERB_ID, 65.0f, 0,   100.0f, 5.0f,      1.0f,      SizeChange, (uint32_t)this, 0.0f,      29);
-
-
-    // Parameter view initialization
-    m_TimeView.Init(&m_Time, "Time", "Time", "S", "Second");
-    m_PreDelayView.Init(&m_PreDelay, "PreDly", "Pre-Delay", "ms", "millisec");
-    m_MixView.Init(&m_Mix, "Mix", "Mix", "%", "%");
-
-    m_ModDepthView.Init(&m_ModDepthParam, "Mod", "Modulation Deep", "%", "%");
-    m_ShimmerView.Init(&m_Shimmer, "Shimmer", "Shimmer Deep", "%", "%");
-
-    m_BassView.Init(&m_Bass, "Bass", "Bass", "dB", "Decibel");
-    m_TrebleView.Init(&m_Treble, "Treble", "Treble", "dB", "Decibel");
+    // Parameter descriptors, kept in flash
+    using eCurve = DadDSP::eSmoothCurve;
+    static constexpr DadGUI::sNumParameterDesc ParameterDesc[] = {
+        //  Init,  Min,    Max,    Rapid, Slow, CallBack,         Slope, CC, RT,    Curve (decimation: costly callbacks)     View labels
+        { { 4.5f,  0.1f,   10.0f,  0.5f,  0.1f, TimeChange,       0.5f,  20, false, eCurve::Exponential, 2 }, { "Time",    "Time",               "S",  "Second"   } },
+        { { 0.0f,  0.0f,   100.0f, 10.0f, 1.0f, PreDelayChange,   0.3f,  21, true                            }, { "PreDly",  "Pre-Delay",          "ms", "millisec" } },
+        { { 40.0f, 0.0f,   100.0f, 5.0f,  1.0f, MixChange,        1.0f,  22                                  }, { "Mix",     "Mix",                "%",  "%"        } },
+        { { 25.0f, 0.0f,   100.0f, 2.0f,  0.5f, ModDepthChange,   0.5f,  23                                  }, { "Mod",     "Modulation Deep",    "%",  "%"        } },
+        { { 5.0f,  0.0f,   100.0f, 5.0f,  1.0f, ShimmerChange,    0.4f,  24                                  }, { "Shimmer", "Shimmer Deep",       "%",  "%"        } },
+        { { 0.0f,  -12.0f, 12.0f,  1.0f,  0.5f, BassChange,       0.0f,  25                                  }, { "Bass",    "Bass",               "dB", "Decibel"  } },
+        { { 0.0f,  -12.0f, 12.0f,  1.0f,  0.5f, TrebleChange,     0.0f,  26                                  }, { "Treble",  "Treble",             "dB", "Decibel"  } },
+        { { 50.0f, 0.0f,   100.0f, 5.0f,  1.0f, DampingChange,    0.3f,  27, false, eCurve::OnePole,     2 }, { "Damp",    "Damping",            "%",  "%"        } },
+        { { 50.0f, 0.0f,   100.0f, 5.0f,  1.0f, DampingModChange, 0.3f,  28                                  }, { "DampMod", "Damping modulation", "%",  "%"        } },
+        { { 65.0f, 0.0f,   100.0f, 5.0f,  1.0f, SizeChange,       0.0f,  29                                  }, { "Size",    "Size",               "%",  "%"        } }
+    };
+
+    // Parameters and views, in the order of the descriptors
+    DadGUI::cUIParameter* const pParameters[] = {
+        &m_Time, &m_PreDelay, &m_Mix, &m_ModDepthParam, &m_Shimmer,
+        &m_Bass, &m_Treble, &m_Damping, &m_DampingMod, &m_Size
+    };
+    DadGUI::cParameterNumView* const pViews[] = {
+        &m_TimeView, &m_PreDelayView, &m_MixView, &m_ModDepthView, &m_ShimmerView,
+        &m_BassView, &m_TrebleView, &m_DampingView, &m_DampingModView, &m_SizeView
+    };
+    static_assert(sizeof(ParameterDesc) / sizeof(ParameterDesc[0]) == sizeof(pParameters) / sizeof(pParameters[0]),
+                  "One descriptor per parameter");
+
+    for (uint8_t Index = 0; Index < sizeof(pParameters) / sizeof(pParameters[0]); Index++) {
+        pParameters[Index]->Init(REVERB_ID, ParameterDesc[Index].Parameter, (uint32_t)this);
+        pViews[Index]->Init(pParameters[Index], ParameterDesc[Index].View);
+    }
 
-    m_DampingView.Init(&m_Damping, "Damp", "Damping", "%", "%");
-    m_DampingModView.Init(&m_DampingMod, "DampMod", "Damping modulation", "%", "%");
-    m_SizeView.Init(&m_Size, "Size", "Size", "%", "%");
+    // Engine (quality mode): mono or true-stereo late reverb
+    static constexpr DadGUI::sUIParameterDesc EngineDesc = { 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, EngineChange, 0.0f, 30 };
+    static constexpr DadGUI::sDiscretValues EngineNames[] = {
+        { "Mono",   "Mono late" },
+        { "Stereo", "True stereo" }
+    };
+    m_Engine.Init(REVERB_ID, EngineDesc, (uint32_t)this);
+    m_EngineView.Init(&m_Engine, "Engine", "Reverb engine");
+    m_EngineView.setDiscreteValues(EngineNames, sizeof(EngineNames) / sizeof(EngineNames[0]));
+
+    // Freeze: latched by a long press of the on/off switch (instead of bypass) or by MIDI
+    static constexpr DadGUI::sUIParameterDesc FreezeDesc = { 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, FreezeChange, 0.0f, 31 };
+    static constexpr DadGUI::sDiscretValues FreezeNames[] = {
+        { "Off", "Off" },
+        { "On",  "Infinite sustain" }
+    };
+    m_Freeze.Init(REVERB_ID, FreezeDesc, (uint32_t)this);
+    m_Freeze.setTransient();                        // A preset must not start a capture
+    m_FreezeView.Init(&m_Freeze, "Freeze", "Freeze");
+    m_FreezeView.setDiscreteValues(FreezeNames, sizeof(FreezeNames) / sizeof(FreezeNames[0]));
+    m_pHoldParameter = &m_Freeze;
 
     // Panel Initialization
 #ifdef HARD_DRYWET
@@ -339,15 +523,17 @@ void cReverb::onInitialize() {
 #else
     m_ParameterMainPanel.Init(&m_TimeView, &m_PreDelayView, &m_MixView);
 #endif
-    m_ParameterEffectPanel.Init(&m_ModDepthView, nullptr, &m_ShimmerView);
+    m_ParameterEffectPanel.Init(&m_ModDepthView, &m_EngineView, &m_ShimmerView);
     m_ParameterTonePanel.Init(&m_BassView, nullptr, &m_TrebleView);
     m_ParameterAdvancedPanel.Init(&m_DampingView, &m_DampingModView, &m_SizeView);
+    m_ParameterFreezePanel.Init(nullptr, &m_FreezeView, nullptr);
 
     // Effect menu part initialization
     m_Menu.addMenuItem(&m_ParameterMainPanel, "Reverb");
     m_Menu.addMenuItem(&m_ParameterEffectPanel, "Effects");
     m_Menu.addMenuItem(&m_ParameterTonePanel, "Tone");
     m_Menu.addMenuItem(&m_ParameterAdvancedPanel, "Advanced");
+    m_Menu.addMenuItem(&m_ParameterFreezePanel, "Freeze");
 }
 
 // -----------------------------------------------------------------------------
@@ -358,9 +544,9 @@ void cReverb::updateDelayLengths() {
 
     	m_CurrentDelayLengths[i] =
         		static_cast<uint32_t>(__BaseDelayLengths[i] * m_SizeMultiplier);
-        // Clamp to buffer size
-        if(m_CurrentDelayLengths[i] >= FDM_BUFFER_SIZE_NO_MOD) {
-            m_CurrentDelayLengths[i] = FDM_BUFFER_SIZE_NO_MOD - 1;
+        // Clamp to the line size
+        if(m_CurrentDelayLengths[i] > FDMLineMaxLength(i)) {
+            m_CurrentDelayLengths[i] = FDMLineMaxLength(i);
         }
 
 		float delaySec = static_cast<float>(m_CurrentDelayLengths[i]) * ONE_OVER_SAMPLING_RATE;
@@ -370,12 +556,24 @@ void cReverb::updateDelayLengths() {
 
 // -----------------------------------------------------------------------------
 // Audio processing function - processes one input/output audio buffer
-// STEREO: Early reflections stereo + Late reverb mono
+// STEREO: Early reflections stereo + Late reverb mono or true stereo
 // -----------------------------------------------------------------------------
-void cReverb::onProcess(AudioBuffer *pIn, AudioBuffer *pOut, DadGUI::eEffectState_t State, bool Silence) {
+ITCM_CODE void cReverb::onProcess(AudioBuffer *pIn, AudioBuffer *pOut, DadGUI::eEffectState_t State, bool Silence) {
     float inL = pIn->Left;
     float inR = pIn->Right;
 
+    // Engine crossfade
+    if (m_StereoMix != m_StereoTarget) {
+        if (m_StereoMix == 0.0f) {
+            // Right diffusion restarts from silence
+            for (int i = 0; i < NUM_ALLPASS; i++) m_AllpassLineR[i].Clear();
+        }
+        m_StereoMix = RampTo(m_StereoMix, m_StereoTarget, ENGINE_FADE_STEP);
+    }
+
+    // Freeze requests and ramps
+    updateFreeze();
+
     #ifdef HARD_DRYWET
     if(State == DadGUI::eEffectState_t::off){
         inL = 0;
@@ -403,22 +601,111 @@ void cReverb::onProcess(AudioBuffer *pIn, AudioBuffer *pOut, DadGUI::eEffectStat
     EarlyL *= m_EarlyFinalGain;
     EarlyR *= m_EarlyFinalGain;
 
+    // ─────────────────────────────────────────────────────────────────────────────
+    // 3. to 9. Late reverb, replaced by the frozen loop once crossfaded
+    float lateL = 0.0f;
+    float lateR = 0.0f;
+    if ((m_FreezeState != eFreezeState::Play) || (m_LoopMix != 1.0f)) {
+        processLate(preDelayedL, preDelayedR, lateL, lateR);
+
+        // The loop is recorded once the FDN sustains
+        if ((m_FreezeState == eFreezeState::Capture) && (m_FreezeFade == 1.0f)) {
+            m_pLoopL[m_RecordPos] = lateL;
+            m_pLoopR[m_RecordPos] = lateR;
+            if (++m_RecordPos == FREEZE_RECORD_LENGTH) {
+                // Playback starts past the splice, one loop behind the FDN:
+                // uncorrelated signals for the equal power crossfade
+                m_FreezeState = eFreezeState::Play;
+                m_LoopPos = FREEZE_SPLICE_LENGTH;
+            }
+        }
+    }
+
+    if (m_LoopMix != 0.0f) {
+        float loopL;
+        float loopR;
+        readLoop(loopL, loopR);
+        if (m_LoopMix == 1.0f) {
+            lateL = loopL;
+            lateR = loopR;
+        } else {
+            float GainLoop = sqrtf(m_LoopMix);
+            float GainFDN = sqrtf(1.0f - m_LoopMix);
+            lateL = lateL * GainFDN + loopL * GainLoop;
+            lateR = lateR * GainFDN + loopR * GainLoop;
+        }
+    }
+
+    constexpr float FINAL_GAIN = 0.080f;
+    lateL *= FINAL_GAIN;
+    lateR *= FINAL_GAIN;
+
+    // ──────────────────────────────────────────────────────────────
+    // 10. Mix early + late reverb stereo
+    float reverbL = EarlyL * 0.3f + lateL * 0.7f;
+    float reverbR = EarlyR * 0.3f + lateR * 0.7f;
+
+    // ──────────────────────────────────────────────────────────────
+    // 11. Apply tone filters (stereo)
+    float reverbProcessedL = m_TrebleFilterL.Process(
+        m_BassFilterL.Process(reverbL, DadDSP::eChannel::Left),
+        DadDSP::eChannel::Left
+    );
+
+    float reverbProcessedR = m_TrebleFilterR.Process(
+        m_BassFilterR.Process(reverbR, DadDSP::eChannel::Right),
+        DadDSP::eChannel::Right
+    );
+
+    // ──────────────────────────────────────────────────────────────
+    // 12. Apply wet gain and output
+    float WetGain = __DryWet.getGainWet();
+    pOut->Left = reverbProcessedL * WetGain;
+    pOut->Right = reverbProcessedR * WetGain;
+}
+
+
+// -----------------------------------------------------------------------------
+// Late reverb: diffusion, FDN and shimmer, returns the stereo taps
+// While freezing, m_FreezeFade crossfades the FDN to infinite sustain
+// -----------------------------------------------------------------------------
+ITCM_CODE void cReverb::processLate(float preDelayedL, float preDelayedR, float& lateL, float& lateR) {
     // ─────────────────────────────────────────────────────────────────────────────
     // 3. Diffusion through allpass cascade
+    //    Mono: mid signal on every line. True stereo: left on the even lines,
+    //    right on the odd lines, each through its own cascade.
     float diffused = (preDelayedL + preDelayedR) * INV_SQRT2;
-    for(int i = 0; i < NUM_ALLPASS; i++) {
-        float delayed = m_AllpassLine[i].Pull(__AllpassLengths[i]);
-        m_AllpassLine[i].Push( diffused + __AllpassCoeff[i] * delayed);
-        diffused = -diffused + delayed;
+    float injectEven;
+    float injectOdd;
+    if (m_StereoMix == 0.0f) {
+        diffused = Diffuse(m_AllpassLine, diffused);
+        injectEven = diffused * INPUT_GAIN;
+        injectOdd = injectEven;
+    } else {
+        float diffusedR = Diffuse(m_AllpassLineR, preDelayedR);
+        diffused = Diffuse(m_AllpassLine, diffused + (preDelayedL - diffused) * m_StereoMix);
+        float inputGain = INPUT_GAIN + (INPUT_GAIN_STEREO - INPUT_GAIN) * m_StereoMix;
+        injectEven = diffused * inputGain;
+        injectOdd = (diffused + (diffusedR - diffused) * m_StereoMix) * inputGain;
+    }
+
+    // Freeze: the input fades out
+    if (m_FreezeFade != 0.0f) {
+        injectEven *= 1.0f - m_FreezeFade;
+        injectOdd *= 1.0f - m_FreezeFade;
     }
 
     // ─────────────────────────────────────────────────────────────────────────────
     // 4. Read delay outputs with modulation
     float delayOuts[FDM_NUM_DELAYS];
 
+    // Advance all the LFOs in one pass
+    m_LFOBank.Step();
+    const float* pModLFO = m_LFOBank.getSines();
+
     for (int i = 0; i < FDM_NUM_DELAYS; i++) {
         // Calculate modulated delay length
-        float modDelayLength = m_CurrentDelayLengths[i] + (m_ModDepth * m_FDM_ModLFO[i].processFast());
+        float modDelayLength = m_CurrentDelayLengths[i] + (m_ModDepth * pModLFO[i]);
         delayOuts[i] = m_DelayLine[i].Pull(modDelayLength);
     }
 
@@ -426,7 +713,8 @@ void cReverb::onProcess(AudioBuffer *pIn, AudioBuffer *pOut, DadGUI::eEffectStat
     // 5. Apply moduled lowpass damping in feedback loop
 
     // Damping modulation
-    float LFO_Value = (m_DampingLFO2.processFast() + m_DampingLFO.processFast()) * 0.5;
+    // Nearest point values: the filter is only recomputed when the table index changes
+    float LFO_Value = (m_LFOBank.getSineFast(LFO_LANE_DAMPING2) + m_LFOBank.getSineFast(LFO_LANE_DAMPING)) * 0.5;
 
     if(LFO_Value != m_MemLFO_Value){
     	m_MemLFO_Value = LFO_Value;
@@ -441,19 +729,39 @@ void cReverb::onProcess(AudioBuffer *pIn, AudioBuffer *pOut, DadGUI::eEffectStat
     	m_DampingFilter.CalculateParameters();
     }
 
-    for (uint16_t i = 0; i < FDM_NUM_DELAYS; i++) {
-    	delayOuts[i] = m_DampingFilter.Process(delayOuts[i], m_DampingFilterStates[i]);
+    if (m_FreezeFade == 0.0f) {
+        for (uint16_t i = 0; i < FDM_NUM_DELAYS; i++) {
+        	delayOuts[i] = m_DampingFilter.Process(delayOuts[i], m_DampingFilterStates[i]);
+        }
+    } else {
+        // Freeze: damping bypassed (the filter keeps running for the release)
+        for (uint16_t i = 0; i < FDM_NUM_DELAYS; i++) {
+            float damped = m_DampingFilter.Process(delayOuts[i], m_DampingFilterStates[i]);
+            delayOuts[i] = damped + (delayOuts[i] - damped) * m_FreezeFade;
+        }
     }
 
     // ─────────────────────────────────────────────────────────────────────────────
     // 6. Apply per-delay gains for decay (based on RT60)
-    for (int i = 0; i < FDM_NUM_DELAYS; i++) {
-        delayOuts[i] *= m_Gains[i];
+    if (m_FreezeFade == 0.0f) {
+        for (int i = 0; i < FDM_NUM_DELAYS; i++) {
+            delayOuts[i] *= m_Gains[i];
+        }
+    } else {
+        // Freeze: unity loop gain (matrix normalization only)
+        for (int i = 0; i < FDM_NUM_DELAYS; i++) {
+            delayOuts[i] *= m_Gains[i] + (INV_SQRT16 - m_Gains[i]) * m_FreezeFade;
+        }
     }
 
     // ─────────────────────────────────────────────────────────────────────────────
     // 7. Compute feedback using Hadamard mix
-    FastHadamardMatrix16(delayOuts);
+    if (m_StereoMix == 0.0f) {
+        FastHadamardMatrix16(delayOuts);
+    } else {
+        FastHadamardMatrix16Stereo(delayOuts, 1.0f + (STEREO_DIRECT - 1.0f) * m_StereoMix,
+                                              1.0f + (STEREO_CROSS - 1.0f) * m_StereoMix);
+    }
 
     // ─────────────────────────────────────────────────────────────────────────────
     // 8 Compute Shimmer
@@ -475,50 +783,80 @@ void cReverb::onProcess(AudioBuffer *pIn, AudioBuffer *pOut, DadGUI::eEffectStat
     // 9. Compute and mix feedback
 
     // Add diffused input (Stage 3) to feedback (normalized injection)
-    for (int i = 0; i < FDM_NUM_DELAYS; i++) {
-    	float feedbackSample = delayOuts[i] + (diffused * INPUT_GAIN) + (shimmerShifted * INPUT_GAIN * m_ShimmerDeep);
-    	m_DelayLine[i].Push(feedbackSample);
+    float shimmerInject = shimmerShifted * INPUT_GAIN * m_ShimmerDeep * (1.0f - m_FreezeFade);
+    for (int i = 0; i < FDM_NUM_DELAYS; i += 2) {
+    	m_DelayLine[i].Push(delayOuts[i] + injectEven + shimmerInject);
+    	m_DelayLine[i + 1].Push(delayOuts[i + 1] + injectOdd + shimmerInject);
     }
 
     // ──────────────────────────────────────────────────────────────
     // 9. Compute stereo reverb output
 
-    float lateL = 0.0f;
-    float lateR = 0.0f;
-
-    for (int i = 0; i < FDM_NUM_DELAYS; i++) {
-        lateL += delayOuts[i] * pan_left[i];
-        lateR += delayOuts[i] * pan_right[i];
+    if (m_StereoMix == 0.0f) {
+        MonoTaps(delayOuts, lateL, lateR);
+    } else if (m_StereoMix == 1.0f) {
+        StereoTaps(delayOuts, lateL, lateR);
+    } else {
+        float stereoL, stereoR;
+        MonoTaps(delayOuts, lateL, lateR);
+        StereoTaps(delayOuts, stereoL, stereoR);
+        lateL += (stereoL - lateL) * m_StereoMix;
+        lateR += (stereoR - lateR) * m_StereoMix;
     }
+}
 
-    constexpr float FINAL_GAIN = 0.080f;
-    lateL *= FINAL_GAIN;
-    lateR *= FINAL_GAIN;
-
-    // ──────────────────────────────────────────────────────────────
-    // 10. Mix early + late reverb stereo
-    float reverbL = EarlyL * 0.3f + lateL * 0.7f;
-    float reverbR = EarlyR * 0.3f + lateR * 0.7f;
+// -----------------------------------------------------------------------------
+// Freeze state machine and ramps (one sample)
+// -----------------------------------------------------------------------------
+ITCM_CODE void cReverb::updateFreeze() {
+    if (m_FreezeTarget) {
+        if (m_FreezeState == eFreezeState::Off) {
+            m_FreezeState = eFreezeState::Capture;
+            m_RecordPos = 0;
+        } else if (m_FreezeState == eFreezeState::Release) {
+            // Back to the loop while it is audible, otherwise a new capture
+            if (m_LoopMix != 0.0f) {
+                m_FreezeState = eFreezeState::Play;
+            } else {
+                m_FreezeState = eFreezeState::Capture;
+                m_RecordPos = 0;
+            }
+        }
+    } else if ((m_FreezeState == eFreezeState::Capture) || (m_FreezeState == eFreezeState::Play)) {
+        m_FreezeState = eFreezeState::Release;
+    }
 
-    // ──────────────────────────────────────────────────────────────
-    // 11. Apply tone filters (stereo)
-    float reverbProcessedL = m_TrebleFilterL.Process(
-        m_BassFilterL.Process(reverbL, DadDSP::eChannel::Left),
-        DadDSP::eChannel::Left
-    );
+    if (m_FreezeState == eFreezeState::Off) return;
 
-    float reverbProcessedR = m_TrebleFilterR.Process(
-        m_BassFilterR.Process(reverbR, DadDSP::eChannel::Right),
-        DadDSP::eChannel::Right
-    );
+    float FadeTarget = (m_FreezeState == eFreezeState::Release) ? 0.0f : 1.0f;
+    float LoopTarget = (m_FreezeState == eFreezeState::Play) ? 1.0f : 0.0f;
+    m_FreezeFade = RampTo(m_FreezeFade, FadeTarget, FREEZE_FADE_STEP);
+    m_LoopMix = RampTo(m_LoopMix, LoopTarget, FREEZE_FADE_STEP);
 
-    // ──────────────────────────────────────────────────────────────
-    // 12. Apply wet gain and output
-    float WetGain = __DryWet.getGainWet();
-    pOut->Left = reverbProcessedL * WetGain;
-    pOut->Right = reverbProcessedR * WetGain;
+    if ((m_FreezeState == eFreezeState::Release) && (m_FreezeFade == 0.0f) && (m_LoopMix == 0.0f)) {
+        m_FreezeState = eFreezeState::Off;
+    }
 }
 
+// -----------------------------------------------------------------------------
+// Reads the next sample of the freeze loop
+// The loop start fades in over the recording past its end (equal power splice)
+// -----------------------------------------------------------------------------
+ITCM_CODE void cReverb::readLoop(float& loopL, float& loopR) {
+    if (m_LoopPos < FREEZE_SPLICE_LENGTH) {
+        float Splice = static_cast<float>(m_LoopPos) * FREEZE_FADE_STEP;
+        float GainIn = sqrtf(Splice);
+        float GainOut = sqrtf(1.0f - Splice);
+        loopL = m_pLoopL[m_LoopPos] * GainIn + m_pLoopL[m_LoopPos + FREEZE_LOOP_LENGTH] * GainOut;
+        loopR = m_pLoopR[m_LoopPos] * GainIn + m_pLoopR[m_LoopPos + FREEZE_LOOP_LENGTH] * GainOut;
+    } else {
+        loopL = m_pLoopL[m_LoopPos];
+        loopR = m_pLoopR[m_LoopPos];
+    }
+    if (++m_LoopPos == FREEZE_LOOP_LENGTH) {
+        m_LoopPos = 0;
+    }
+}
 
 // ---------------------------------------------------------------------------------
 // Callback: TimeChange - Updates per-delay gains based on RT60
@@ -630,6 +968,22 @@ void cReverb::ShimmerChange(DadDSP::cParameter *pParameter, uint32_t CallbackUse
     pthis->m_ShimmerDeep = pParameter->getValue() * 0.6;
 }
 
+// ---------------------------------------------------------------------------------
+// Callback: EngineChange - Mono or true-stereo late reverb (crossfaded in onProcess)
+// ---------------------------------------------------------------------------------
+void cReverb::EngineChange(DadDSP::cParameter *pParameter, uint32_t CallbackUserData) {
+    cReverb *pthis = (cReverb *)CallbackUserData;
+    pthis->m_StereoTarget = (pParameter->getValue() != 0.0f) ? 1.0f : 0.0f;
+}
+
+// ---------------------------------------------------------------------------------
+// Callback: FreezeChange - Freeze request (state machine run in onProcess)
+// ---------------------------------------------------------------------------------
+void cReverb::FreezeChange(DadDSP::cParameter *pParameter, uint32_t CallbackUserData) {
+    cReverb *pthis = (cReverb *)CallbackUserData;
+    pthis->m_FreezeTarget = (pParameter->getValue() >= 0.5f);
+}
+
 
 } // namespace DadEffect
 #endif
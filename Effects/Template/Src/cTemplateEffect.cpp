@@ -23,24 +23,25 @@ constexpr uint32_t TEMPLATE_ID BUILD_ID('T', 'E', 'M', 'P');
 // Description: Initializes DSP components and user interface parameters
 // -----------------------------------------------------------------------------
 void cTemplateEffect::onInitialize(){
-    // Initialize gain parameter with DSP configuration
-    m_ParameterGain.Init(TEMPLATE_ID, // SerializeID
-                         50.0f,       // Initial Value
-                         0.0f,        // Min Value
-                         100.0f,      // Max Value
-                         5.0f,        // Rapid Increment
-                         1.0f,        // Slow Increment
-                         nullptr,     // Callback
-                         0,           // CallbackUserData
-                         0.5f,        // Slope 0.5 seconds for change Min to Max
-                         20);         // Midi CC
+    // Gain parameter and view, described by a constant table kept in flash
+    static constexpr DadGUI::sNumParameterDesc GainDesc = {
+        { 50.0f,            // Initial Value
+          0.0f,             // Min Value
+          100.0f,           // Max Value
+          5.0f,             // Rapid Increment
+          1.0f,             // Slow Increment
+          nullptr,          // Callback
+          0.5f,             // Slope 0.5 seconds for change Min to Max
+          20 },             // Midi CC
+        { "Gain",           // Parameter short name
+          "Gain",           // Parameter long name
+          "%",              // Unit Short name
+          "percent" }       // Unit Long name
+    };
 
-    // Initialize parameter views for GUI display
-    m_ParameterGainView.Init(&m_ParameterGain,     // Parameter
-                             "Gain",               // Parameter short name
-                             "Gain",               // Parameter long name
-                             "%",                  // Unit Short name
-                             "percent");           // Unit Long name
+    // Initialize gain parameter and its view for GUI display
+    m_ParameterGain.Init(TEMPLATE_ID, GainDesc.Parameter);
+    m_ParameterGainView.Init(&m_ParameterGain, GainDesc.View);
 
     // Initialize parameter panels for user interface
     m_ParametrerDemoPanel.Init(&m_ParameterGainView,  // Parameter View 1
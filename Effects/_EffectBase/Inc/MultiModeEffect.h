@@ -18,9 +18,12 @@
 #include "cUIVuMeter.h"
 #include "cInfoView.h"
 #include "SwitchManager.h"
+#include "cIdleManager.h"
 
 namespace DadEffect {
 
+constexpr float MULTIMODE_IDLE_HOLD = 0.200f;   // Longest silent gap of the mode tails (s)
+
 //**********************************************************************************
 // Class: cMultiModeEffect
 // Description: Base class for multi-mode audio effects
@@ -214,6 +217,11 @@ protected:
     float							m_FadGain = 1.0f;		   // Wet gain for memory switch fade
     bool 							m_ChangeEffect = false;	   // Effect change pending flag
     uint8_t							m_TargetSlot = 0.0f;	   // Target memory slot for switch
+
+    // =============================================================================
+    // Idle detection of the active effect
+    // =============================================================================
+    DadDSP::cIdleManager            m_Idle;                    // Skips processing once the tail has decayed
 };
 
 } // namespace DadEffect
@@ -17,6 +17,7 @@
 #include "cUIMenu.h"
 #include "cInfoView.h"
 #include "SwitchManager.h"
+#include "cIdleManager.h"
 
 namespace DadEffect {
 
@@ -36,10 +37,28 @@ public:
     void Initialize();
     virtual void onInitialize() = 0;
 
+    // -----------------------------------------------------------------------------
+    // Initializes the effect as a slot of a cEffectChain: effect menu and
+    // parameters only, the chain owns the common panels, switches and events
+    void InitializeSlot();
+
     // -----------------------------------------------------------------------------
     // Returns the unique effect identifier
     virtual uint32_t getEffectID() = 0;
 
+    // -----------------------------------------------------------------------------
+    // Returns the effect menu
+    virtual DadGUI::cUIMenu* getMenu() { return &m_Menu; }
+
+    // -----------------------------------------------------------------------------
+    // Returns the parameter driven by the tap tempo (nullptr if none) and its unit
+    inline DadDSP::cParameter* getTapTempoParameter() const { return m_pTapTempoParameter; }
+    inline DadGUI::eTempoType getTempoType() const { return m_TempoType; }
+
+    // -----------------------------------------------------------------------------
+    // Returns the parameter toggled by a long press of the on/off switch (nullptr: bypass)
+    inline DadDSP::cParameter* getHoldParameter() const { return m_pHoldParameter; }
+
     // -----------------------------------------------------------------------------
     // Main Audio processing function
     void Process(AudioBuffer *pIn, AudioBuffer *pOut, DadGUI::eEffectState_t State, bool Silence);
@@ -48,6 +67,24 @@ public:
     // Child audio processing function: processes one input/output audio buffer
     virtual void onProcess(AudioBuffer *pIn, AudioBuffer *pOut, DadGUI::eEffectState_t State, bool Silence) = 0;
 
+    // -----------------------------------------------------------------------------
+    // Runs onProcess unless the effect is idle (output decayed under -120 dBFS
+    // with a silent input), zero output while idle
+    inline void ProcessIdle(AudioBuffer *pIn, AudioBuffer *pOut, DadGUI::eEffectState_t State, bool Silence) {
+        if (m_Idle.isIdle() && !m_Idle.WakeUp(pIn, Silence)) {
+            pOut->Left = 0.0f;
+            pOut->Right = 0.0f;
+            return;
+        }
+        onProcess(pIn, pOut, State, Silence);
+        m_Idle.Track(pIn, pOut, Silence);
+    }
+
+    // -----------------------------------------------------------------------------
+    // Idle state of the effect
+    inline bool isIdle() const { return m_Idle.isIdle(); }
+    inline const DadDSP::cIdleManager& getIdleManager() const { return m_Idle; }
+
     // -----------------------------------------------------------------------------
     // Periodically updates switch state and detects user actions
     void on_GUI_FastUpdate() override;
@@ -87,6 +124,11 @@ protected:
     DadDSP::cParameter*                 m_pTapTempoParameter;  // Parameter modified by the TapTempo
     DadGUI::eTempoType                 m_TempoType;           // Defines the output unit period for seconds or frequency or none
 
+    // =============================================================================
+    // Hold (long press of the on/off switch)
+    // =============================================================================
+    DadDSP::cParameter*                 m_pHoldParameter;      // Parameter toggled instead of bypass (freeze), set in onInitialize
+
     // =============================================================================
     // Fade for change memory
     // =============================================================================
@@ -95,6 +137,11 @@ protected:
     bool                               m_ChangeEffect = false; // Effect change pending flag
     uint8_t                            m_TargetSlot = 0.0f;    // Target memory slot for switch
 
+    // =============================================================================
+    // Idle detection (hold time set by the effect in onInitialize)
+    // =============================================================================
+    DadDSP::cIdleManager               m_Idle;                 // Skips processing once the tail has decayed
+
 };
 
 } // namespace DadEffect
@@ -0,0 +1,222 @@
+//==================================================================================
+//==================================================================================
+// File: cEffectChain.h
+// Description: Host running several effects in series in one firmware
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#pragma once
+
+#include "cEffectBase.h"
+#include "MultiModeEffect.h"
+#ifdef MONITOR
+#include "cMonitor.h"
+#endif
+
+#ifndef HARD_DRYWET
+#error "cEffectChain requires HARD_DRYWET: slots must not drive the global dry/wet"
+#endif
+
+namespace DadEffect {
+
+//**********************************************************************************
+// cEffectChain - Configuration
+//
+
+constexpr uint8_t           CHAIN_MAX_SLOTS = 3;            // Slots of a chain
+constexpr uint8_t           CHAIN_MAX_ORDERS = 6;           // CHAIN_MAX_SLOTS!
+constexpr uint8_t           CHAIN_ORDER_SHORT_SIZE = 16;    // "Cho>Del>Rev"
+constexpr uint8_t           CHAIN_ORDER_LONG_SIZE = 48;     // "Chorus > Delay > Reverb"
+constexpr float             CHAIN_BYPASS_TIME = 0.020f;     // Slot bypass fade in seconds
+constexpr float             CHAIN_DEFAULT_BUDGET = 30.0f;   // Slot budget in % of a sample period
+
+//**********************************************************************************
+// Class: cMultiModeSlot
+// Description: Adapter hosting one mode of a multi-mode effect (e.g. cChorus)
+//              as a slot of a cEffectChain
+//**********************************************************************************
+class cMultiModeSlot : public cEffectBase {
+public:
+    // -----------------------------------------------------------------------------
+    // Binds the adapter to its mode (before cEffectChain::Initialize)
+    inline void Bind(cMultiModeEffectBase* pEffect) { m_pEffect = pEffect; }
+
+    // -----------------------------------------------------------------------------
+    // Initializes and activates the hosted mode
+    void onInitialize() override {
+        m_pEffect->Initialize();
+        m_pEffect->onActivate();
+        m_Idle.setHoldTime(MULTIMODE_IDLE_HOLD);
+    }
+
+    // -----------------------------------------------------------------------------
+    // Identifier and menu of the hosted mode
+    uint32_t getEffectID() override { return m_pEffect->getID(); }
+    DadGUI::cUIMenu* getMenu() override { return m_pEffect->getMenu(); }
+
+    // -----------------------------------------------------------------------------
+    // Audio processing delegate
+    void onProcess(AudioBuffer *pIn, AudioBuffer *pOut, DadGUI::eEffectState_t State, bool Silence) override {
+        m_pEffect->Process(pIn, pOut, State, Silence);
+    }
+
+protected:
+    cMultiModeEffectBase*   m_pEffect = nullptr;    // Hosted mode
+};
+
+//**********************************************************************************
+// Struct: sChainSlot
+// Description: Description of one slot of a chain
+//**********************************************************************************
+struct sChainSlot {
+    cEffectBase*    pEffect;        // Slot effect (processes in place of its own firmware)
+    const char*     pShortName;     // Name used by the chain panels
+    const char*     pLongName;
+    bool            Hold = false;   // Long press of the on/off switch toggles the slot hold
+                                    // parameter (freeze) instead of bypassing the chain
+};
+
+//**********************************************************************************
+// Class: cEffectChain
+// Description: Runs up to CHAIN_MAX_SLOTS effects in series
+//
+// Input -> slot[Order[0]] -> slot[Order[1]] -> slot[Order[2]] -> output
+//
+// Each slot is initialized without its global GUI setup (InitializeSlot) and
+// its parameters are moved to the chain event family: every slot stays live
+// and a memory saves the whole chain. The slots output wet only (HARD_DRYWET);
+// the chain mixes each slot with its input (Mix) and crossfades it out when
+// bypassed. A bypassed slot is not processed once its fade is over.
+//
+// The slot memories are static: each slot keeps its own buffers (cMemoryPlan
+// or section attributes). A plan only checks the budgets of its own effect,
+// the linker reports a chain that does not fit.
+//
+// Under MONITOR each slot is timed with a cMonitor and compared to a budget
+// in percent of the sample period (getSlotLoad / getSlotOverruns).
+//**********************************************************************************
+class cEffectChain : public DadGUI::iGUI_EventListener {
+public:
+    // -----------------------------------------------------------------------------
+    // Constructor / Destructor
+    cEffectChain() = default;
+    virtual ~cEffectChain() = default;
+
+    // -----------------------------------------------------------------------------
+    // Initializes the slots, the chain panels and the GUI components
+    void Initialize(uint32_t ChainID, const sChainSlot* pSlots, uint8_t NbSlots);
+
+    // -----------------------------------------------------------------------------
+    // Main Audio processing function
+    void Process(AudioBuffer *pIn, AudioBuffer *pOut, DadGUI::eEffectState_t State, bool Silence);
+
+    // -----------------------------------------------------------------------------
+    // Applies pending order changes and memory restores, updates the slot loads
+    void on_GUI_FastUpdate() override;
+
+#ifdef MONITOR
+    // -----------------------------------------------------------------------------
+    // Slot CPU budget in percent of the sample period
+    inline void setSlotBudget(uint8_t Slot, float Percent) {
+        if (Slot < m_NbSlots) m_SlotBudget[Slot] = Percent;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Average CPU load of a slot (%) over the last MONITOR_UPDATE_MS
+    inline float getSlotLoad(uint8_t Slot) const {
+        return (Slot < m_NbSlots) ? m_SlotLoad[Slot] : 0.0f;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Number of monitor periods where the slot peak exceeded its budget
+    inline uint32_t getSlotOverruns(uint8_t Slot) const {
+        return (Slot < m_NbSlots) ? m_SlotOverruns[Slot] : 0;
+    }
+#endif
+
+protected:
+    // -----------------------------------------------------------------------------
+    // Static callbacks (UI parameter change handlers)
+    static void EditChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData);
+    static void OrderChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData);
+    static void BypassChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData);
+    static void MixChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData);
+
+    // -----------------------------------------------------------------------------
+    // Callback events for memory restore start and end
+    static void StartRestoreEvent(void *pID, uint32_t Data);
+    static void EndRestoreEvent(void *pID, uint32_t Data);
+
+    // -----------------------------------------------------------------------------
+    // Helper functions
+    void buildOrders();
+    uint8_t findSlot(DadDSP::cParameter* pParameter, DadGUI::cUIParameter* pSlotParameters);
+
+    // =============================================================================
+    // Slots
+    // =============================================================================
+    sChainSlot                          m_Slots[CHAIN_MAX_SLOTS];
+    uint8_t                             m_NbSlots = 0;
+
+    uint8_t                             m_Orders[CHAIN_MAX_ORDERS][CHAIN_MAX_SLOTS]; // Permutations of the slots
+    uint8_t                             m_NbOrders = 0;
+    volatile uint8_t                    m_ActiveOrder = 0;  // Order processed by the audio thread
+    char                                m_OrderShortNames[CHAIN_MAX_ORDERS][CHAIN_ORDER_SHORT_SIZE]; // Order view labels
+    char                                m_OrderLongNames[CHAIN_MAX_ORDERS][CHAIN_ORDER_LONG_SIZE];
+
+    float                               m_BypassGain[CHAIN_MAX_SLOTS];   // 1 active, 0 bypassed
+    float                               m_BypassTarget[CHAIN_MAX_SLOTS];
+    float                               m_DryGain[CHAIN_MAX_SLOTS];
+    float                               m_WetGain[CHAIN_MAX_SLOTS];
+
+    // =============================================================================
+    // User Interface Components
+    // =============================================================================
+    DadGUI::cUIParameter                m_Edit;             // Slot shown by the menu
+    DadGUI::cUIParameter                m_Order;            // Processing order
+    DadGUI::cUIParameter                m_Bypass[CHAIN_MAX_SLOTS];
+    DadGUI::cUIParameter                m_Mix[CHAIN_MAX_SLOTS];
+
+    DadGUI::cParameterDiscretView       m_EditView;
+    DadGUI::cParameterDiscretView       m_OrderView;
+    DadGUI::cParameterDiscretView       m_BypassView[CHAIN_MAX_SLOTS];
+    DadGUI::cParameterNumNormalView     m_MixView[CHAIN_MAX_SLOTS];
+
+    DadGUI::cPanelOfParameterView       m_ChainPanel;
+    DadGUI::cPanelOfParameterView       m_BypassPanel;
+    DadGUI::cPanelOfParameterView       m_MixPanel;
+
+    DadGUI::cUIMemory                   m_MemoryPanel;
+    DadGUI::cUIVuMeter                  m_VuMeterPanel;
+    DadGUI::cPanelOfSystemView          m_PanelOfSystemView;
+
+    DadGUI::cInfoView                   m_InfoView;
+    DadGUI::cParameterInfoView          m_cParameterInfoView;
+    DadGUI::cSwitchOnOff                m_SwitchOnOff;
+    DadGUI::cTapTempoMemChange          m_SwitchTempoMem;
+
+    // =============================================================================
+    // Fade for order and memory changes
+    // =============================================================================
+    float                               m_FadeIncrement = 0.0f;
+    float                               m_FadGain = 1.0f;
+    bool                                m_ChangeEffect = false;
+    uint8_t                             m_TargetSlot = 0;   // Memory slot, 0xFF for an order change
+
+#ifdef MONITOR
+    // =============================================================================
+    // Slot monitoring
+    // =============================================================================
+    DadUtilities::cMonitor              m_SlotMonitor[CHAIN_MAX_SLOTS];
+    float                               m_SlotBudget[CHAIN_MAX_SLOTS];
+    float                               m_SlotLoad[CHAIN_MAX_SLOTS];
+    uint32_t                            m_SlotOverruns[CHAIN_MAX_SLOTS];
+    uint32_t                            m_LastMonitorTick = 0;
+#endif
+};
+
+} // namespace DadEffect
+
+//***End of file**************************************************************
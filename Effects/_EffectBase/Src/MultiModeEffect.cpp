@@ -8,6 +8,8 @@
 //==================================================================================
 
 #include "MultiModeEffect.h"
+#include "TCMPlacement.h"
+#include "Denormals.h"
 #include "GPIO.h"
 #include "DadUtilities.h"
 #include "GUI_Event.h"
@@ -69,6 +71,10 @@ namespace DadEffect {
     // Description: Initializes all effects, panels, and GUI components
     //
     void cMainMultiModeEffect::Initialize(){
+    	// Flush denormals (decaying tails) to zero, idle detection
+        DadDSP::EnableFlushToZero();
+        m_Idle.Initialize(SAMPLING_RATE, MULTIMODE_IDLE_HOLD);
+
     	// Initialize panels common to all effects
         m_PanelOfEffectChoice.Initialize(0, EffectChange, (uint32_t) this);
         m_VuMeterPanel.Init();                          // Initialize VU meter display
@@ -125,9 +131,17 @@ namespace DadEffect {
     // Process
     // Description: Real-time audio processing delegate to active effect
     //
-    void cMainMultiModeEffect::Process(AudioBuffer* pIn, AudioBuffer* pOut, DadGUI::eEffectState_t State, bool Silence){
+    ITCM_CODE void cMainMultiModeEffect::Process(AudioBuffer* pIn, AudioBuffer* pOut, DadGUI::eEffectState_t State, bool Silence){
     		AudioBuffer OutEffect;
-    		m_pActiveEffect->Process(pIn, &OutEffect, State, Silence); // Process audio through active effect
+
+    		// Process audio through active effect, skipped while idle
+    		if (m_Idle.isIdle() && !m_Idle.WakeUp(pIn, Silence)) {
+    			OutEffect.Left = 0.0f;
+    			OutEffect.Right = 0.0f;
+    		} else {
+    			m_pActiveEffect->Process(pIn, &OutEffect, State, Silence);
+    			m_Idle.Track(pIn, &OutEffect, Silence);
+    		}
 
     		// Apply wet gain fade for smooth effect/memory switching
         	if(!isZero(m_FadeIncrement)){
@@ -229,6 +243,7 @@ namespace DadEffect {
         m_pActiveEffect = getEffect(IndexEffect);        		// Set new active effect
         m_MemoryPanel.setSerializeID(m_pActiveEffect->getID()); // Update memory panel with new effect ID
         m_pActiveEffect->Activate();                            // Activate new effect
+        m_Idle.Reset();                                         // New effect starts active
     }
 
     // -----------------------------------------------------------------------------
@@ -8,6 +8,8 @@
 //==================================================================================
 
 #include "cEffectBase.h"
+#include "TCMPlacement.h"
+#include "Denormals.h"
 #include "GPIO.h"
 #include "DadUtilities.h"
 #include "cSwitch.h"
@@ -28,9 +30,12 @@ void cEffectBase::Initialize()
 {
     m_Menu.Init();
     m_pTapTempoParameter = nullptr;
+    m_pHoldParameter = nullptr;
 
     // Initialize audio processing settings
     __DryWet.setMix(100);
+    DadDSP::EnableFlushToZero();
+    m_Idle.Initialize(SAMPLING_RATE);
 
     // Initialize effect
     onInitialize();
@@ -43,7 +48,7 @@ void cEffectBase::Initialize()
 
     // Initialize UI components
     m_InfoView.Init();
-    m_SwitchOnOff.Init(&__Switch1, EffectID);
+    m_SwitchOnOff.Init(&__Switch1, EffectID, m_pHoldParameter);
     if (m_pTapTempoParameter == nullptr) m_TempoType = DadGUI::eTempoType::none;
     m_SwitchTempoMem.Init(&__Switch2, m_pTapTempoParameter, EffectID, m_TempoType);
 
@@ -66,16 +71,33 @@ void cEffectBase::Initialize()
 
     // Subscribe to fast GUI update events
     DadGUI::__GUI_EventManager.Subscribe_FastUpdate(this);
+
+    __BootProfiler.Mark("Effect");
+}
+
+// -----------------------------------------------------------------------------
+// Initializes the effect as a slot of a cEffectChain
+// The global dry/wet, panels, switches and event family are left to the chain
+void cEffectBase::InitializeSlot()
+{
+    m_Menu.Init();
+    m_pTapTempoParameter = nullptr;
+    m_pHoldParameter = nullptr;
+    m_Idle.Initialize(SAMPLING_RATE);
+
+    // Initialize effect
+    onInitialize();
+    if (m_pTapTempoParameter == nullptr) m_TempoType = DadGUI::eTempoType::none;
 }
 
 // -----------------------------------------------------------------------------
 // Audio processing function: processes one input/output audio buffer
-void cEffectBase::Process(AudioBuffer *pIn, AudioBuffer *pOut, DadGUI::eEffectState_t State, bool Silence)
+ITCM_CODE void cEffectBase::Process(AudioBuffer *pIn, AudioBuffer *pOut, DadGUI::eEffectState_t State, bool Silence)
 {
     AudioBuffer OutEffect;
 
-    // Process audio through child effect
-    onProcess(pIn, &OutEffect, State, Silence);
+    // Process audio through child effect (skipped while idle)
+    ProcessIdle(pIn, &OutEffect, State, Silence);
 
     // Apply wet gain fade for smooth effect/memory switching
     if (!isZero(m_FadeIncrement)) {
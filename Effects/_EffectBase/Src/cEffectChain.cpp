@@ -0,0 +1,365 @@
+//==================================================================================
+//==================================================================================
+// File: cEffectChain.cpp
+// Description: Host running several effects in series in one firmware
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "@EffectsConfig.h"
+#if ACTIVE_EFFECT == EFFECT_CHAIN
+#include "cEffectChain.h"
+#include "TCMPlacement.h"
+#include "Denormals.h"
+#include "GPIO.h"
+#include "DadUtilities.h"
+#include "cSwitch.h"
+#include "MainGUI.h"
+#include <cstdio>
+
+// *****************************************************************************
+// Global variables declarations
+// *****************************************************************************
+extern DadDrivers::cSwitch 	__Switch1;
+extern DadDrivers::cSwitch 	__Switch2;
+extern DadGUI::cMainGUI		__GUI;
+
+namespace DadEffect {
+
+constexpr float CHAIN_FADE_TIME = 0.200f;                                       // Order/memory fade in seconds
+constexpr float CHAIN_FADE_INCREMENT = 1 / (SAMPLING_RATE * CHAIN_FADE_TIME);   // Per-sample fade increment
+constexpr float CHAIN_BYPASS_INCREMENT = 1 / (SAMPLING_RATE * CHAIN_BYPASS_TIME);
+
+//**********************************************************************************
+// Class: cEffectChain
+//**********************************************************************************
+
+// -----------------------------------------------------------------------------
+// Initializes the slots, the chain panels and the GUI components
+void cEffectChain::Initialize(uint32_t ChainID, const sChainSlot* pSlots, uint8_t NbSlots)
+{
+    m_NbSlots = (NbSlots > CHAIN_MAX_SLOTS) ? CHAIN_MAX_SLOTS : NbSlots;
+    DadDSP::EnableFlushToZero();
+
+    // Initialize the slots and move their parameters to the chain family
+    DadDSP::cParameter* pTapTempoParameter = nullptr;
+    DadGUI::eTempoType  TempoType = DadGUI::eTempoType::none;
+    DadDSP::cParameter* pHoldParameter = nullptr;
+    for (uint8_t Slot = 0; Slot < m_NbSlots; Slot++) {
+        m_Slots[Slot] = pSlots[Slot];
+        cEffectBase* pEffect = m_Slots[Slot].pEffect;
+
+        pEffect->InitializeSlot();
+        DadGUI::__GUI_EventManager.MoveFamily4AllEvents(pEffect->getEffectID(), ChainID);
+
+        // The first slot with a tap tempo owns the tap tempo switch
+        if ((pTapTempoParameter == nullptr) && (pEffect->getTapTempoParameter() != nullptr)) {
+            pTapTempoParameter = pEffect->getTapTempoParameter();
+            TempoType = pEffect->getTempoType();
+        }
+
+        // The long press of the on/off switch bypasses the chain unless a slot opts in
+        if ((pHoldParameter == nullptr) && m_Slots[Slot].Hold) {
+            pHoldParameter = pEffect->getHoldParameter();
+        }
+
+        m_BypassGain[Slot] = 1.0f;
+        m_BypassTarget[Slot] = 1.0f;
+        m_DryGain[Slot] = 1.0f;
+        m_WetGain[Slot] = 1.0f;
+#ifdef MONITOR
+        m_SlotMonitor[Slot].Init();
+        m_SlotBudget[Slot] = CHAIN_DEFAULT_BUDGET;
+        m_SlotLoad[Slot] = 0.0f;
+        m_SlotOverruns[Slot] = 0;
+#endif
+    }
+    buildOrders();
+
+    // The chain mixes the slots itself, the analog dry path stays muted
+    // (after the slots: some of them set the global mix when initialized)
+    __DryWet.setMix(100);
+
+    // Chain parameters
+    m_Edit.Init(ChainID, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, EditChange, (uint32_t)this);
+    m_Order.Init(ChainID, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, OrderChange, (uint32_t)this);
+
+    m_EditView.Init(&m_Edit, "Edit", "Edit slot");
+    m_OrderView.Init(&m_Order, "Order", "Order");
+    for (uint8_t Slot = 0; Slot < m_NbSlots; Slot++) {
+        m_EditView.AddDiscreteValue(m_Slots[Slot].pShortName, m_Slots[Slot].pLongName);
+    }
+    for (uint8_t Order = 0; Order < m_NbOrders; Order++) {
+        char* pShortName = m_OrderShortNames[Order];
+        char* pLongName = m_OrderLongNames[Order];
+        int ShortLength = 0;
+        int LongLength = 0;
+        for (uint8_t Pos = 0; Pos < m_NbSlots; Pos++) {
+            const sChainSlot& Slot = m_Slots[m_Orders[Order][Pos]];
+            const char* pSeparator = (Pos != 0) ? ">" : "";
+            ShortLength += snprintf(pShortName + ShortLength, CHAIN_ORDER_SHORT_SIZE - ShortLength,
+                                    "%s%.3s", pSeparator, Slot.pShortName);
+            LongLength += snprintf(pLongName + LongLength, CHAIN_ORDER_LONG_SIZE - LongLength,
+                                   "%s%s", (Pos != 0) ? " > " : "", Slot.pLongName);
+            if (LongLength >= CHAIN_ORDER_LONG_SIZE) LongLength = CHAIN_ORDER_LONG_SIZE - 1;
+        }
+        m_OrderView.AddDiscreteValue(pShortName, pLongName);
+    }
+
+    DadGUI::cParameterView* pBypassViews[CHAIN_MAX_SLOTS] = {nullptr};
+    DadGUI::cParameterView* pMixViews[CHAIN_MAX_SLOTS] = {nullptr};
+    for (uint8_t Slot = 0; Slot < m_NbSlots; Slot++) {
+        m_Bypass[Slot].Init(ChainID, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, BypassChange, (uint32_t)this);
+        m_Mix[Slot].Init(ChainID, 50.0f, 0.0f, 100.0f, 5.0f, 1.0f, MixChange, (uint32_t)this, 0.5f);
+
+        m_BypassView[Slot].Init(&m_Bypass[Slot], m_Slots[Slot].pShortName, m_Slots[Slot].pLongName);
+        m_BypassView[Slot].AddDiscreteValue("On", "Active");
+        m_BypassView[Slot].AddDiscreteValue("Byp.", "Bypass");
+        m_MixView[Slot].Init(&m_Mix[Slot], m_Slots[Slot].pShortName, m_Slots[Slot].pLongName, "%", "%");
+
+        pBypassViews[Slot] = &m_BypassView[Slot];
+        pMixViews[Slot] = &m_MixView[Slot];
+    }
+
+    m_ChainPanel.Init(&m_EditView, nullptr, &m_OrderView);
+    m_BypassPanel.Init(pBypassViews[0], pBypassViews[1], pBypassViews[2]);
+    m_MixPanel.Init(pMixViews[0], pMixViews[1], pMixViews[2]);
+
+    // Initialize parameter panels
+    m_MemoryPanel.Init(ChainID);
+    m_VuMeterPanel.Init();
+    m_PanelOfSystemView.Initialize(ChainID);
+
+    // Append the chain panels to the menu of each slot
+    for (uint8_t Slot = 0; Slot < m_NbSlots; Slot++) {
+        DadGUI::cUIMenu* pMenu = m_Slots[Slot].pEffect->getMenu();
+        pMenu->addMenuItem(&m_ChainPanel,          "Chain");
+        pMenu->addMenuItem(&m_BypassPanel,         "Bypass");
+        pMenu->addMenuItem(&m_MixPanel,            "Mix");
+        pMenu->addMenuItem(&m_MemoryPanel,         "Memory");
+        pMenu->addMenuItem(&m_VuMeterPanel,        "Vu-Meter");
+        pMenu->addMenuItem(&m_PanelOfSystemView,   "System");
+    }
+
+    // Initialize UI components
+    m_InfoView.Init();
+    m_SwitchOnOff.Init(&__Switch1, ChainID, pHoldParameter);
+    m_SwitchTempoMem.Init(&__Switch2, pTapTempoParameter, ChainID, TempoType);
+
+    // Configure GUI identifiers and components
+    DadGUI::__GUI_EventManager.SetActiveFamily4AllEvents(ChainID);
+
+    __GUI.activeBackComponent(&m_InfoView);
+    __GUI.activeMainComponent(m_Slots[0].pEffect->getMenu());
+
+    m_cParameterInfoView.Init();
+
+    // Register memory restore event listeners
+    __GUI.RegisterStartRestoreListener(StartRestoreEvent, (uint32_t)this);
+    __GUI.RegisterEndRestoreListener(EndRestoreEvent, (uint32_t)this);
+
+    // Subscribe to fast GUI update events
+    DadGUI::__GUI_EventManager.Subscribe_FastUpdate(this);
+}
+
+// -----------------------------------------------------------------------------
+// Builds the permutations of the slots (first one is the declaration order)
+void cEffectChain::buildOrders()
+{
+    uint8_t Order[CHAIN_MAX_SLOTS];
+    for (uint8_t Slot = 0; Slot < m_NbSlots; Slot++) {
+        Order[Slot] = Slot;
+    }
+
+    // Permutations in lexicographic order
+    m_NbOrders = 0;
+    while (m_NbOrders < CHAIN_MAX_ORDERS) {
+        for (uint8_t Slot = 0; Slot < m_NbSlots; Slot++) {
+            m_Orders[m_NbOrders][Slot] = Order[Slot];
+        }
+        m_NbOrders++;
+
+        int8_t i = m_NbSlots - 2;
+        while ((i >= 0) && (Order[i] > Order[i + 1])) i--;
+        if (i < 0) break;
+        int8_t j = m_NbSlots - 1;
+        while (Order[j] < Order[i]) j--;
+        uint8_t Tmp = Order[i]; Order[i] = Order[j]; Order[j] = Tmp;
+        for (int8_t a = i + 1, b = m_NbSlots - 1; a < b; a++, b--) {
+            Tmp = Order[a]; Order[a] = Order[b]; Order[b] = Tmp;
+        }
+    }
+    m_ActiveOrder = 0;
+}
+
+// -----------------------------------------------------------------------------
+// Returns the slot of a per slot parameter
+uint8_t cEffectChain::findSlot(DadDSP::cParameter* pParameter, DadGUI::cUIParameter* pSlotParameters)
+{
+    for (uint8_t Slot = 0; Slot < m_NbSlots; Slot++) {
+        if (pParameter == &pSlotParameters[Slot]) {
+            return Slot;
+        }
+    }
+    return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Audio processing function: processes one input/output audio buffer
+ITCM_CODE void cEffectChain::Process(AudioBuffer *pIn, AudioBuffer *pOut, DadGUI::eEffectState_t State, bool Silence)
+{
+    AudioBuffer Buffer = *pIn;
+    const uint8_t* pOrder = m_Orders[m_ActiveOrder];
+
+    for (uint8_t Pos = 0; Pos < m_NbSlots; Pos++) {
+        uint8_t Slot = pOrder[Pos];
+
+        // Bypass fade, a fully bypassed slot is skipped
+        float Gain = m_BypassGain[Slot];
+        if (Gain != m_BypassTarget[Slot]) {
+            Gain += (m_BypassTarget[Slot] > Gain) ? CHAIN_BYPASS_INCREMENT : -CHAIN_BYPASS_INCREMENT;
+            if (Gain > 1.0f) Gain = 1.0f;
+            else if (Gain < 0.0f) Gain = 0.0f;
+            m_BypassGain[Slot] = Gain;
+        } else if (Gain == 0.0f) {
+            continue;
+        }
+
+        AudioBuffer Wet;
+#ifdef MONITOR
+        m_SlotMonitor[Slot].startMonitoring();
+#endif
+        // The Silence flag only describes the chain input (first slot), the
+        // next slots detect the silence of their input themselves
+        m_Slots[Slot].pEffect->ProcessIdle(&Buffer, &Wet, State, Silence && (Pos == 0));
+#ifdef MONITOR
+        m_SlotMonitor[Slot].stopMonitoring();
+#endif
+
+        // Slot mix, then crossfade with the bypassed signal
+        float MixLeft = Buffer.Left * m_DryGain[Slot] + Wet.Left * m_WetGain[Slot];
+        float MixRight = Buffer.Right * m_DryGain[Slot] + Wet.Right * m_WetGain[Slot];
+        Buffer.Left += Gain * (MixLeft - Buffer.Left);
+        Buffer.Right += Gain * (MixRight - Buffer.Right);
+    }
+
+    // Apply wet gain fade for smooth order/memory switching
+    if (!isZero(m_FadeIncrement)) {
+        m_FadGain += m_FadeIncrement;
+
+        if (m_FadGain <= 0.0f) {
+            m_FadGain = 0.0f;
+            m_FadeIncrement = 0.0f;
+            m_ChangeEffect = true;              // Apply the change at zero gain
+        } else if (m_FadGain >= 1.0) {
+            m_FadGain = 1.0f;
+            m_FadeIncrement = 0.0f;
+        }
+    }
+
+    // The slots already apply the on/off wet gain to their own output only:
+    // the dry part of the chain must follow it as well
+    float Out = m_FadGain * __DryWet.getGainWet();
+    pOut->Left = Buffer.Left * Out;
+    pOut->Right = Buffer.Right * Out;
+}
+
+// -----------------------------------------------------------------------------
+// Callback: EditChange - Shows the menu of the edited slot
+void cEffectChain::EditChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData)
+{
+    cEffectChain* pthis = (cEffectChain*)CallbackUserData;
+    uint8_t Slot = (uint8_t)pParameter->getValue();
+    if (Slot < pthis->m_NbSlots) {
+        __GUI.activeMainComponent(pthis->m_Slots[Slot].pEffect->getMenu());
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Callback: OrderChange - Fades out, the order is applied at zero gain
+void cEffectChain::OrderChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData)
+{
+    cEffectChain* pthis = (cEffectChain*)CallbackUserData;
+    if ((uint8_t)pParameter->getValue() == pthis->m_ActiveOrder) return;
+    pthis->m_TargetSlot = 0xFF;                         // Order change (not memory slot)
+    pthis->m_FadeIncrement = -CHAIN_FADE_INCREMENT;
+}
+
+// -----------------------------------------------------------------------------
+// Callback: BypassChange - Starts the bypass fade of one slot
+void cEffectChain::BypassChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData)
+{
+    cEffectChain* pthis = (cEffectChain*)CallbackUserData;
+    uint8_t Slot = pthis->findSlot(pParameter, pthis->m_Bypass);
+    pthis->m_BypassTarget[Slot] = (pParameter->getValue() < 0.5f) ? 1.0f : 0.0f;
+}
+
+// -----------------------------------------------------------------------------
+// Callback: MixChange - Dry/wet of one slot, both at unity gain at 50%
+void cEffectChain::MixChange(DadDSP::cParameter* pParameter, uint32_t CallbackUserData)
+{
+    cEffectChain* pthis = (cEffectChain*)CallbackUserData;
+    uint8_t Slot = pthis->findSlot(pParameter, pthis->m_Mix);
+    float Mix = pParameter->getValue() * 0.01f;
+    float Dry = 2.0f * (1.0f - Mix);
+    float Wet = 2.0f * Mix;
+    pthis->m_DryGain[Slot] = (Dry > 1.0f) ? 1.0f : Dry;
+    pthis->m_WetGain[Slot] = (Wet > 1.0f) ? 1.0f : Wet;
+}
+
+// -----------------------------------------------------------------------------
+// Static callback for memory restore start event
+void cEffectChain::StartRestoreEvent(void *pTargetSlot, uint32_t Data)
+{
+    cEffectChain *pthis = (cEffectChain *)Data;
+    pthis->m_TargetSlot = (uint8_t) * ((uint32_t *)pTargetSlot);
+    pthis->m_FadeIncrement = -CHAIN_FADE_INCREMENT;
+}
+
+// -----------------------------------------------------------------------------
+// Static callback for memory restore end event
+void cEffectChain::EndRestoreEvent(void *pID, uint32_t Data)
+{
+    cEffectChain *pthis = (cEffectChain *)Data;
+    pthis->m_FadeIncrement = CHAIN_FADE_INCREMENT;
+}
+
+// -----------------------------------------------------------------------------
+// Applies pending order changes and memory restores, updates the slot loads
+// Called at fast GUI update rate
+void cEffectChain::on_GUI_FastUpdate()
+{
+    if (m_ChangeEffect) {
+        if (m_TargetSlot != 0xFF) {
+            DadGUI::__MemoryManager.RestoreSlot(m_TargetSlot);
+        }
+        // The restored memory may hold another order as well
+        uint8_t Order = (uint8_t)m_Order.getValue();
+        if (Order < m_NbOrders) m_ActiveOrder = Order;
+
+        m_FadeIncrement = CHAIN_FADE_INCREMENT;   // Start fade-in
+        m_ChangeEffect = false;
+    }
+
+#ifdef MONITOR
+    uint32_t Tick = HAL_GetTick();
+    if (Tick - m_LastMonitorTick >= MONITOR_UPDATE_MS) {
+        m_LastMonitorTick = Tick;
+        float CyclesPerSample = (float)SystemCoreClock / SAMPLING_RATE;
+        for (uint8_t Slot = 0; Slot < m_NbSlots; Slot++) {
+            m_SlotLoad[Slot] = m_SlotMonitor[Slot].getCPULoad_percent();
+            float Peak = 100.0f * m_SlotMonitor[Slot].getMaxExecutionCycles() / CyclesPerSample;
+            if ((m_SlotMonitor[Slot].getCallCount() != 0) && (Peak > m_SlotBudget[Slot])) {
+                m_SlotOverruns[Slot]++;
+            }
+            m_SlotMonitor[Slot].reset();
+        }
+    }
+#endif
+}
+
+} // namespace DadEffect
+
+#endif
+//***End of file**************************************************************
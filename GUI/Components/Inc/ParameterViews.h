@@ -11,10 +11,41 @@
 #include "cUIParameter.h"
 #include "cDisplay.h"
 #include <string>
-#include <vector>
+
+// Capacity of the discrete values added one by one with AddDiscreteValue
+// (tables given to setDiscreteValues are not limited)
+#ifndef PARAM_MAX_DISCRETE_VALUES
+#define PARAM_MAX_DISCRETE_VALUES 12
+#endif
+
+// Encoder switch held this long without turning: MIDI learn of the parameter
+#ifndef PARAM_LEARN_PRESS_MS
+#define PARAM_LEARN_PRESS_MS 1000
+#endif
 
 namespace DadGUI {
 
+//**********************************************************************************
+// Struct: sNumViewDesc
+// Description: Constant description of a numeric view (labels stay in flash)
+//**********************************************************************************
+struct sNumViewDesc {
+    const char*    ShortName;                  // Compact label
+    const char*    LongName;                   // Info banner label
+    const char*    ShortUnit;                  // Unit shown beside the value
+    const char*    LongUnit;                   // Unit shown in the info banner
+    uint8_t        StringPrecision = 3;        // Significant digits
+};
+
+//**********************************************************************************
+// Struct: sNumParameterDesc
+// Description: Parameter and its numeric view, one line of an effect table
+//**********************************************************************************
+struct sNumParameterDesc {
+    sUIParameterDesc   Parameter;
+    sNumViewDesc       View;
+};
+
 //**********************************************************************************
 // Class: cParameterView
 // Description: Abstract base class for all parameter visualization components
@@ -27,7 +58,7 @@ public:
     // Function: Init
     // Description: Initialize parameter with given attributes
     // ---------------------------------------------------------------------------------
-    void Init(cUIParameter* pParameter, const std::string& ShortName, const std::string& LongName);
+    void Init(cUIParameter* pParameter, const char* ShortName, const char* LongName);
 
     // Return associated parameter pointer for external access
     cUIParameter* getParameter() { return m_pParameter; }
@@ -45,20 +76,41 @@ public:
     virtual bool Update(uint8_t NumParameterArea, DadGFX::cLayer* pDynamicLayer);
 
     // Return long name for temporary info display
-    virtual const std::string getInfoName() { return m_LongName; }
+    virtual const std::string getInfoName() { return std::string(m_LongName); }
 
     // Return current value string for temporary info display (pure virtual)
     virtual const std::string getInfoValue() = 0;
 
+    // Return info banner value: MIDI learn state while learning, value otherwise
+    const std::string getInfoBanner() {
+        return (m_pLearnState != nullptr) ? std::string(m_pLearnState) : getInfoValue();
+    }
+
 protected:
+    // ---------------------------------------------------------------------------------
+    // Function: UpdateLearn
+    // Description: Long press of the encoder switch starts / cancels MIDI learn
+    // ---------------------------------------------------------------------------------
+    void UpdateLearn(uint8_t SwitchState, int8_t Increment);
+
+    // Show the MIDI learn state in the info banner
+    void ShowLearnState(const char* pState);
+
     // Draw the dynamic (value-dependent) part of the view (pure virtual)
     virtual void DrawDynView(uint8_t NumParameterArea, DadGFX::cLayer* pLayer) = 0;
 
     // Member variables
-    std::string            	m_ShortName;           			// Short parameter name (compact label)
-    std::string            	m_LongName;            			// Long parameter name (info banner)
+    const char*            	m_ShortName = "";      			// Short parameter name (compact label)
+    const char*            	m_LongName = "";       			// Long parameter name (info banner)
     cUIParameter*   		m_pParameter = nullptr; 		// Pointer to the associated parameter
     float                  	m_MemParameterValue = 0.0f; 	// Cached last value for change detection
+
+    // MIDI learn by long press
+    uint32_t                m_PressStart = 0;               // Tick of the switch press
+    bool                    m_PressTurned = false;          // Encoder turned while pressed (no learn)
+    bool                    m_PressHandled = false;         // Long press already handled
+    bool                    m_Learning = false;             // Learn started from this view
+    const char*             m_pLearnState = nullptr;        // Learn state shown in the info banner
 };
 
 //**********************************************************************************
@@ -71,8 +123,16 @@ public:
     // Function: Init
     // Description: Initialize numeric parameter attributes (names, units, precision)
     // ---------------------------------------------------------------------------------
-    void Init(cUIParameter* pParameter, const std::string& ShortName, const std::string& LongName,
-              const std::string& ShortUnit, const std::string& LongUnit, uint8_t StringPrecision = 3);
+    void Init(cUIParameter* pParameter, const char* ShortName, const char* LongName,
+              const char* ShortUnit, const char* LongUnit, uint8_t StringPrecision = 3);
+
+    // ---------------------------------------------------------------------------------
+    // Function: Init
+    // Description: Initialize the view from a constant descriptor
+    // ---------------------------------------------------------------------------------
+    void Init(cUIParameter* pParameter, const sNumViewDesc& Desc) {
+        Init(pParameter, Desc.ShortName, Desc.LongName, Desc.ShortUnit, Desc.LongUnit, Desc.StringPrecision);
+    }
 
     // Return formatted value for temporary info banner
     const std::string getInfoValue() override;
@@ -82,8 +142,8 @@ protected:
     std::string ValueToString() const;
 
     // Member variables
-    std::string    m_ShortUnit;        // Unit short form (shown beside value)
-    std::string    m_LongUnit;         // Unit long form (used in info banner)
+    const char*    m_ShortUnit = "";   // Unit short form (shown beside value)
+    const char*    m_LongUnit = "";    // Unit long form (used in info banner)
     uint8_t        m_StringPrecision;  // Decimal precision for textual formatting
 };
 
@@ -116,8 +176,8 @@ protected:
 // Description: Holds a short and long version of a discrete parameter value label
 //**********************************************************************************
 struct sDiscretValues {
-    std::string m_ShortValue;  // Compact display label
-    std::string m_LongValue;   // Full descriptive label
+    const char* m_ShortValue;  // Compact display label
+    const char* m_LongValue;   // Full descriptive label
 };
 
 //**********************************************************************************
@@ -126,8 +186,11 @@ struct sDiscretValues {
 //**********************************************************************************
 class cParameterDiscretView : public cParameterView {
 public:
-    // Add a discrete value option to the table
-    void AddDiscreteValue(const std::string& ShortDiscretValue, const std::string& LongDiscretValue);
+    // Add a discrete value option to the table (labels must outlive the view)
+    void AddDiscreteValue(const char* ShortDiscretValue, const char* LongDiscretValue);
+
+    // Use a constant table of discrete values (replaces the added values)
+    void setDiscreteValues(const sDiscretValues* pValues, uint8_t NbValues);
 
     // Draw static and dynamic layers
     void Draw(uint8_t NumParameterArea, DadGFX::cLayer* pStaticLayer, DadGFX::cLayer* pDynamicLayer) override;
@@ -140,7 +203,9 @@ protected:
     void DrawDynView(uint8_t NumParameterArea, DadGFX::cLayer* pDynamicLayer) override;
 
     // Member variables
-    std::vector<sDiscretValues> m_TabDiscretValues;  // List of discrete values
+    sDiscretValues          m_TabDiscretValues[PARAM_MAX_DISCRETE_VALUES];  // Values added one by one
+    const sDiscretValues*   m_pDiscretValues = m_TabDiscretValues;          // Active table (own or constant)
+    uint8_t                 m_NbDiscretValues = 0;                          // Number of discrete values
 };
 
 } // namespace DadGUI
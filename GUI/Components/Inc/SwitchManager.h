@@ -18,6 +18,8 @@ namespace DadGUI {
 //**********************************************************************************
 // Class: cSwitchOnOff
 // Description: Handles simple On/Off/Bypass toggle using footswitch interactions
+//              A long press sets bypass, or toggles the hold parameter of the
+//              effect when it has one (reverb freeze)
 //**********************************************************************************
 class cSwitchOnOff : public iGUI_EventListener {
 public:
@@ -27,8 +29,10 @@ public:
     //-----------------------------------------------------------------------------------
     // Function: Init
     // Description: Initializes the component with switch reference and effect ID
+    //              pHoldParameter: toggled between its min and max by a long press
+    //              (nullptr: long press sets bypass)
     //-----------------------------------------------------------------------------------
-    void Init(DadDrivers::cSwitch* pFootSwitch, uint32_t EffectID);
+    void Init(DadDrivers::cSwitch* pFootSwitch, uint32_t EffectID, DadDSP::cParameter* pHoldParameter = nullptr);
 
     //-----------------------------------------------------------------------------------
     // Function: on_GUI_FastUpdate(){};
@@ -44,6 +48,7 @@ protected:
     uint32_t m_OldPressCount = 0;                // Tracks previous press count for change detection
     uint32_t m_LastPressTime = 0;                // Timestamp of last press for double-tap detection
     DadDrivers::cSwitch* m_pFootSwitch = nullptr; // Pointer to physical footswitch hardware
+    DadDSP::cParameter* m_pHoldParameter = nullptr; // Parameter toggled by a long press (nullptr: bypass)
 };
 
 //**********************************************************************************
@@ -107,6 +112,10 @@ protected:
     DadDrivers::cSwitch* m_pFootSwitch = nullptr;    // Pointer to physical footswitch hardware
     eTempoType m_TempoType = eTempoType::none;       // Type of tempo output calculation
     DadDSP::cParameter* m_pParameter = nullptr;      // Pointer to linked DSP parameter for tempo control
+    float m_ClockBeatPeriod = 0.0f;                  // Last MIDI clock beat period applied (s)
+
+    // Relative MIDI clock tempo change ignored (filters residual DLL wander)
+    static constexpr float CLOCK_TEMPO_TOLERANCE = 0.005f;
 };
 
 } // namespace DadGUI
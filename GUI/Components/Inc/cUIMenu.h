@@ -10,11 +10,13 @@
 
 #pragma once
 
-#include <string>
-#include <vector>
 #include "iUIComponent.h"
 #include "cDisplay.h"
 
+#ifndef MENU_MAX_ITEMS
+#define MENU_MAX_ITEMS 12               // Capacity of a menu (effect panels + common panels)
+#endif
+
 namespace DadGUI {
 
 //**********************************************************************************
@@ -25,7 +27,7 @@ namespace DadGUI {
 class cUIMenu;
 
 struct MenuItem {
-    std::string   Name;        // Display name of the menu item
+    const char*   Name;        // Display name of the menu item (literal, stays in flash)
     iUIComponent* pItem;       // Pointer to the associated GUI component
     cUIMenu*      pNextMenu;   // Optional pointer to a submenu
 };
@@ -53,10 +55,10 @@ public:
     // Description: Adds a new menu entry
     // Parameters:
     //   - pItem: Pointer to the associated GUI component
-    //   - Name: Display name of the menu entry
+    //   - Name: Display name of the menu entry (must outlive the menu)
     //   - pNextMenu: Pointer to a submenu (optional)
     // -----------------------------------------------------------------------------
-    void addMenuItem(iUIComponent* pItem, const std::string& Name,
+    void addMenuItem(iUIComponent* pItem, const char* Name,
                      cUIMenu* pNextMenu = nullptr);
 
     // -----------------------------------------------------------------------------
@@ -96,10 +98,10 @@ public:
     //   - Item: Index of the item to activate
     // -----------------------------------------------------------------------------
     void setItem(uint8_t Item) {
-        if (Item < m_TabMenuItem.size()) {
+        if (Item < m_NbMenuItems) {
             m_ActiveItem = Item;                 // Set specified item as active
         } else {
-            m_ActiveItem = m_TabMenuItem.size() - 1; // Clamp to last item
+            m_ActiveItem = m_NbMenuItems - 1;    // Clamp to last item
         }
         drawTab();
     }
@@ -130,7 +132,8 @@ protected:
     DadGFX::cLayer* m_pDynMenuLayer;   // Pointer to the dynamic (active) menu layer
     DadGFX::cLayer* m_pStatMenuLayer;  // Pointer to the static (background) menu layer
 
-    std::vector<MenuItem> m_TabMenuItem;  // List of menu items
+    MenuItem m_TabMenuItem[MENU_MAX_ITEMS];  // List of menu items
+    uint8_t  m_NbMenuItems = 0;           // Number of menu items
     int8_t  m_ActiveItem;                 // Index of the currently selected item
     int8_t  m_MenuShift;                  // Horizontal scroll offset for tab display
     uint8_t m_isActive;                   // Indicates if the menu is currently active
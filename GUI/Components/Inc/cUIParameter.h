@@ -15,6 +15,26 @@
 namespace DadGUI {
 class cParameterView;
 
+//**********************************************************************************
+// Struct: sUIParameterDesc
+// Description:
+// Constant description of a parameter (range, increments, smoothing, MIDI CC).
+// Effects declare them in static constexpr tables kept in flash.
+//**********************************************************************************
+struct sUIParameterDesc {
+    float                   InitValue;
+    float                   Min;
+    float                   Max;
+    float                   RapidIncrement;
+    float                   SlowIncrement;
+    DadDSP::CallbackType    Callback = nullptr;
+    float                   SlopeTime = 0;              // Seconds from Min to Max
+    uint8_t                 Control = 0xFF;             // MIDI CC (0xFF: none)
+    bool                    RTProcess = false;          // Smoothed in the audio thread
+    DadDSP::eSmoothCurve    Curve = DadDSP::eSmoothCurve::Linear;
+    uint16_t                CallbackDecimation = 1;
+};
+
 //**********************************************************************************
 // Class: cUIParameter
 // Description:
@@ -48,6 +68,21 @@ public:
               uint8_t Control = 0xFF,
 			  bool RTProcess = false);
 
+    //***********************************************************************************
+    // Method: Init
+    // Description:
+    // Initializes parameter from a constant descriptor
+    //***********************************************************************************
+    void Init(uint32_t SerializeID, const sUIParameterDesc& Desc, uint32_t CallbackUserData = 0);
+
+    //***********************************************************************************
+    // Method: setTransient
+    // Description:
+    // Performance control (freeze, hold): removed from the presets, so a memory
+    // restore never changes it and changing it does not make the memory dirty
+    //***********************************************************************************
+    void setTransient();
+
     //***********************************************************************************
     // Method: Save
     // Description:
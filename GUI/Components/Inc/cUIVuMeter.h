@@ -51,16 +51,16 @@ public:
     void on_GUI_Update() override;
 
     // ---------------------------------------------------------------------------------
-    // Function: GUIProcessIn
-    // Description: Processes audio input buffers and updates VU-meter readings in real time
+    // Function: on_GUI_RT_ProcessInBlock
+    // Description: Processes an audio input block and updates VU-meter readings in real time
     // ---------------------------------------------------------------------------------
-    void on_GUI_RT_ProcessIn(AudioBuffer* pIn) override;
+    void on_GUI_RT_ProcessInBlock(const AudioBuffer* pIn, uint32_t NbSamples) override;
 
     // ---------------------------------------------------------------------------------
-    // Function: GUIProcessOut
-    // Description: Processes audio ouput buffers and updates VU-meter readings in real time
+    // Function: on_GUI_RT_ProcessOutBlock
+    // Description: Processes an audio output block and updates VU-meter readings in real time
     // ---------------------------------------------------------------------------------
-    void on_GUI_RT_ProcessOut(AudioBuffer* pOut) override;
+    void on_GUI_RT_ProcessOutBlock(const AudioBuffer* pOut, uint32_t NbSamples) override;
 
     // ---------------------------------------------------------------------------------
     // Function: Redraw
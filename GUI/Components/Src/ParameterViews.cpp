@@ -10,6 +10,7 @@
 #include "ParameterViews.h"
 #include "MainGUI.h"
 #include "cEncoder.h"
+#include "cMidi.h"
 
 // *****************************************************************************
 // Global variables declarations
@@ -18,6 +19,7 @@ extern DadGUI::cMainGUI __GUI;
 extern DadDrivers::cEncoder	__Encoder1;
 extern DadDrivers::cEncoder	__Encoder2;
 extern DadDrivers::cEncoder	__Encoder3;
+extern DadDrivers::cMidi	__Midi;
 
 namespace DadGUI {
 
@@ -45,7 +47,7 @@ constexpr float Deg2Rad(float a) { return a * PI / 180.0f; }
 // Function: Init
 // Description: Initialize the parameter view with parameter pointer and names
 // ---------------------------------------------------------------------------------
-void cParameterView::Init(cUIParameter* pParameter, const std::string& ShortName, const std::string& LongName) {
+void cParameterView::Init(cUIParameter* pParameter, const char* ShortName, const char* LongName) {
     m_pParameter = pParameter;     // Backend parameter object
     m_ShortName = ShortName;       // Short display name
     m_LongName  = LongName;        // Long descriptive name
@@ -77,6 +79,9 @@ bool cParameterView::Update(uint8_t NumParameterArea, DadGFX::cLayer* pDynamicLa
         m_pParameter->Increment(Increment, SwitchState);
     }
 
+    // Long press: MIDI learn
+    UpdateLearn(SwitchState, Increment);
+
     // Detect external changes (MIDI, memory restore),  or local change
     float TargetValue = m_pParameter->getTargetValue();
     if (m_MemParameterValue != TargetValue) {
@@ -89,6 +94,56 @@ bool cParameterView::Update(uint8_t NumParameterArea, DadGFX::cLayer* pDynamicLa
     return false; // No change detected
 }
 
+// ---------------------------------------------------------------------------------
+// Function: UpdateLearn
+// Description: Long press of the encoder switch starts / cancels MIDI learn
+// The switch also selects the slow increment: a press with rotation is ignored.
+// ---------------------------------------------------------------------------------
+void cParameterView::UpdateLearn(uint8_t SwitchState, int8_t Increment) {
+    uint32_t Tick = HAL_GetTick();
+
+    if (SwitchState == 0) {
+        m_PressStart = Tick;
+        m_PressTurned = false;
+        m_PressHandled = false;
+    } else {
+        if (Increment != 0) m_PressTurned = true;
+        if (!m_PressTurned && !m_PressHandled && ((Tick - m_PressStart) >= PARAM_LEARN_PRESS_MS)) {
+            m_PressHandled = true;
+            if (__Midi.isLearning(m_pParameter)) {
+                // Second long press: leave learn mode
+                __Midi.CancelLearn();
+                m_Learning = false;
+                ShowLearnState("Learn canceled");
+            } else {
+                __Midi.StartLearn(m_pParameter);
+                m_Learning = __Midi.isLearning(m_pParameter);
+                ShowLearnState(m_Learning ? "MIDI learn..." : "Not learnable");
+            }
+        }
+    }
+
+    // Learn ended by a Control Change, or by another view / a clear
+    if (m_Learning && !__Midi.isLearning(m_pParameter)) {
+        m_Learning = false;
+        switch (__Midi.getLearnResult()) {
+            case DadDrivers::eMidiLearn::Learned: ShowLearnState("Learned");      break;
+            case DadDrivers::eMidiLearn::Failed:  ShowLearnState("Learn failed"); break;
+            default:                              ShowLearnState("Learn canceled"); break;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------------
+// Function: ShowLearnState
+// Description: Show the MIDI learn state in the info banner
+// ---------------------------------------------------------------------------------
+void cParameterView::ShowLearnState(const char* pState) {
+    m_pLearnState = pState;
+    __GUI.NotifyParamChange(this);
+    m_pLearnState = nullptr;
+}
+
 //**********************************************************************************
 // cParameterNumView implementation
 //**********************************************************************************
@@ -97,8 +152,8 @@ bool cParameterView::Update(uint8_t NumParameterArea, DadGFX::cLayer* pDynamicLa
 // Function: Init
 // Description: Initialize numeric parameter attributes (names, units, precision)
 // ---------------------------------------------------------------------------------
-void cParameterNumView::Init(cUIParameter* pParameter, const std::string& ShortName, const std::string& LongName,
-                             const std::string& ShortUnit, const std::string& LongUnit, uint8_t StringPrecision) {
+void cParameterNumView::Init(cUIParameter* pParameter, const char* ShortName, const char* LongName,
+                             const char* ShortUnit, const char* LongUnit, uint8_t StringPrecision) {
     cParameterView::Init(pParameter, ShortName, LongName);
     m_ShortUnit = ShortUnit;        // Short unit display
     m_LongUnit  = LongUnit;         // Long unit description
@@ -202,7 +257,7 @@ std::string cParameterNumView::ValueToString() const {
 // Description: Return formatted value for temporary info banner
 // ---------------------------------------------------------------------------------
 const std::string cParameterNumView::getInfoValue() {
-    return ValueToString() + " " + m_LongUnit;
+    return ValueToString() + " " + std::string(m_LongUnit);
 }
 
 //**********************************************************************************
@@ -225,10 +280,10 @@ void cParameterNumNormalView::Draw(uint8_t NumParameterArea, DadGFX::cLayer* pSt
 
     // Draw the parameter name centered at the top of the layer
     pStaticLayer->setFont(__GUI.GetFontS());
-    uint16_t NameWidth = pStaticLayer->getTextWidth(m_ShortName.c_str());
+    uint16_t NameWidth = pStaticLayer->getTextWidth(m_ShortName);
     pStaticLayer->setCursor(xCenterView - (NameWidth / 2), (PARAM_NAME_HEIGHT - pStaticLayer->getTextHeight()) / 2);
     pStaticLayer->setTextFrontColor(__ThemesManager->ParameterName);
-    pStaticLayer->drawText(m_ShortName.c_str());
+    pStaticLayer->drawText(m_ShortName);
 
     // Draw the static arcs representing the potentiometer boundaries
     pStaticLayer->drawArc(xCenterView, yCenterView,
@@ -292,7 +347,7 @@ void cParameterNumNormalView::DrawDynView(uint8_t NumParameterArea, DadGFX::cLay
 
     // Render the parameter's current value as text
     char Buffer[30];
-    snprintf(Buffer, sizeof(Buffer), "%s %s", ValueToString().c_str(), m_ShortUnit.c_str());
+    snprintf(Buffer, sizeof(Buffer), "%s %s", ValueToString().c_str(), m_ShortUnit);
     pLayer->setFont(__GUI.GetFontS());
     uint16_t TextWidth = pLayer->getTextWidth(Buffer);
     pLayer->setCursor(xCenterView - (TextWidth / 2),
@@ -335,7 +390,7 @@ void cParameterNumLeftRightView::DrawDynView(uint8_t NumParameterArea, DadGFX::c
 
     // Render value text
     char Buffer[30];
-    snprintf(Buffer, sizeof(Buffer), "%s %s", ValueToString().c_str(), m_ShortUnit.c_str());
+    snprintf(Buffer, sizeof(Buffer), "%s %s", ValueToString().c_str(), m_ShortUnit);
     pLayer->setFont(__GUI.GetFontSB());
     uint16_t TextWidth = pLayer->getTextWidth(Buffer);
     pLayer->setCursor(xCenterView - (TextWidth / 2),
@@ -375,14 +430,31 @@ void cParameterNumLeftRightView::DrawDynView(uint8_t NumParameterArea, DadGFX::c
 // Function: AddDiscreteValue
 // Description: Add a discrete enumerated label pair and update parameter max value
 // ---------------------------------------------------------------------------------
-void cParameterDiscretView::AddDiscreteValue(const std::string& ShortDiscretValue, const std::string& LongDiscretValue) {
-    sDiscretValues Values;
-    Values.m_LongValue  = LongDiscretValue;   // Full descriptive label
-    Values.m_ShortValue = ShortDiscretValue;  // Compact display label
-    m_TabDiscretValues.push_back(Values);
+void cParameterDiscretView::AddDiscreteValue(const char* ShortDiscretValue, const char* LongDiscretValue) {
+    // Values added after a constant table or beyond the capacity
+    if ((m_pDiscretValues != m_TabDiscretValues) || (m_NbDiscretValues >= PARAM_MAX_DISCRETE_VALUES)) {
+        Error_Handler();
+    }
+    m_TabDiscretValues[m_NbDiscretValues].m_LongValue  = LongDiscretValue;   // Full descriptive label
+    m_TabDiscretValues[m_NbDiscretValues].m_ShortValue = ShortDiscretValue;  // Compact display label
+    m_NbDiscretValues++;
 
     // Update the backend parameter max value to reflect discrete count - 1
-    m_pParameter->setMaxValue(static_cast<float>(m_TabDiscretValues.size() - 1));
+    m_pParameter->setMaxValue(static_cast<float>(m_NbDiscretValues - 1));
+}
+
+// ---------------------------------------------------------------------------------
+// Function: setDiscreteValues
+// Description: Point the view at a constant table and update parameter max value
+// ---------------------------------------------------------------------------------
+void cParameterDiscretView::setDiscreteValues(const sDiscretValues* pValues, uint8_t NbValues) {
+    if ((pValues == nullptr) || (NbValues == 0)) {
+        Error_Handler();
+    }
+    m_pDiscretValues  = pValues;    // Table stays in flash
+    m_NbDiscretValues = NbValues;
+
+    m_pParameter->setMaxValue(static_cast<float>(m_NbDiscretValues - 1));
 }
 
 // ---------------------------------------------------------------------------------
@@ -391,7 +463,7 @@ void cParameterDiscretView::AddDiscreteValue(const std::string& ShortDiscretValu
 // ---------------------------------------------------------------------------------
 void cParameterDiscretView::Draw(uint8_t NumParameterArea, DadGFX::cLayer* pStaticLayer, DadGFX::cLayer* pDynamicLayer) {
     m_MemParameterValue = m_pParameter->getTargetValue();
-    if (m_TabDiscretValues.size() == 0) return;
+    if (m_NbDiscretValues == 0) return;
 
     const uint16_t xCenterView = pStaticLayer->getWith() / 2;
     const uint16_t yCenterView = pStaticLayer->getHeight() / 2;
@@ -403,10 +475,10 @@ void cParameterDiscretView::Draw(uint8_t NumParameterArea, DadGFX::cLayer* pStat
 
     // Draw parameter name
     pStaticLayer->setFont(__GUI.GetFontS());
-    uint16_t NameWidth = pStaticLayer->getTextWidth(m_ShortName.c_str());
+    uint16_t NameWidth = pStaticLayer->getTextWidth(m_ShortName);
     pStaticLayer->setCursor(xCenterView - (NameWidth / 2), (PARAM_NAME_HEIGHT - pStaticLayer->getTextHeight()) / 2);
     pStaticLayer->setTextFrontColor(__ThemesManager->ParameterName);
-    pStaticLayer->drawText(m_ShortName.c_str());
+    pStaticLayer->drawText(m_ShortName);
 
     // Draw static pot point and surrounding arc
     pStaticLayer->drawArc(xCenterView, yCenterView,
@@ -415,7 +487,7 @@ void cParameterDiscretView::Draw(uint8_t NumParameterArea, DadGFX::cLayer* pStat
 						  __ThemesManager->ParameterLines);
 
     // Draw discrete markers around the pot
-    uint8_t NbDiscretValues = static_cast<uint8_t>(m_TabDiscretValues.size());
+    uint8_t NbDiscretValues = m_NbDiscretValues;
     if (NbDiscretValues != 0) {
         float IncAlpha = Deg2Rad(static_cast<float>(PARAM_POT_ALPHA) / static_cast<float>(NbDiscretValues + 1));
         float Alpha = Deg2Rad(240.0f) - IncAlpha;
@@ -449,7 +521,7 @@ void cParameterDiscretView::Draw(uint8_t NumParameterArea, DadGFX::cLayer* pStat
 // Description: Draw the dynamic part for discrete parameter (selected label + point)
 // ---------------------------------------------------------------------------------
 void cParameterDiscretView::DrawDynView(uint8_t NumParameterArea, DadGFX::cLayer* pLayer) {
-    uint8_t NbDiscretValues = static_cast<uint8_t>(m_TabDiscretValues.size());
+    uint8_t NbDiscretValues = m_NbDiscretValues;
     if (NbDiscretValues == 0) return;
 
     const uint16_t xCenterView = pLayer->getWith() / 2;
@@ -464,10 +536,10 @@ void cParameterDiscretView::DrawDynView(uint8_t NumParameterArea, DadGFX::cLayer
     // Render selected value short label
     uint8_t NumValue = static_cast<uint8_t>(m_pParameter->getTargetValue());
     pLayer->setFont(__GUI.GetFontSB());
-    uint16_t TextWidth = pLayer->getTextWidth(m_TabDiscretValues[NumValue].m_ShortValue.c_str());
+    uint16_t TextWidth = pLayer->getTextWidth(m_pDiscretValues[NumValue].m_ShortValue);
     pLayer->setCursor(xCenterView - (TextWidth / 2), pLayer->getHeight() - ((PARAM_VAL_HEIGHT + pLayer->getTextHeight()) / 2));
     pLayer->setTextFrontColor(__ThemesManager->ParameterValue);
-    pLayer->drawText(m_TabDiscretValues[NumValue].m_ShortValue.c_str());
+    pLayer->drawText(m_pDiscretValues[NumValue].m_ShortValue);
 
     // Render discrete points and highlight the selected one
     float IncAlpha = Deg2Rad(static_cast<float>(PARAM_POT_ALPHA) / static_cast<float>(NbDiscretValues + 1));
@@ -486,7 +558,7 @@ void cParameterDiscretView::DrawDynView(uint8_t NumParameterArea, DadGFX::cLayer
 // Description: Return the long descriptive value for the info banner
 // ---------------------------------------------------------------------------------
 const std::string cParameterDiscretView::getInfoValue() {
-    return m_TabDiscretValues[static_cast<uint8_t>(m_pParameter->getTargetValue())].m_LongValue;
+    return std::string(m_pDiscretValues[static_cast<uint8_t>(m_pParameter->getTargetValue())].m_LongValue);
 }
 
 
@@ -12,6 +12,8 @@
 #include "cBypassOnOffManager.h"
 #include "GUI_Event.h"
 #include "cMemoryManager.h"
+#include "cMidiClock.h"
+#include <cmath>
 
 // *****************************************************************************
 // Global variables declarations
@@ -35,8 +37,9 @@ extern GUI_EventManager __GUI_EventManager;
 // Function: Init
 // Description: Initializes the footswitch reference and registers the component
 //-----------------------------------------------------------------------------------
-void cSwitchOnOff::Init(DadDrivers::cSwitch* pFootSwitch, uint32_t EffectID) {
+void cSwitchOnOff::Init(DadDrivers::cSwitch* pFootSwitch, uint32_t EffectID, DadDSP::cParameter* pHoldParameter) {
     m_pFootSwitch = pFootSwitch;  // Store footswitch reference
+    m_pHoldParameter = pHoldParameter; // Long press action (nullptr: bypass)
     m_OldPressCount = 0;          // Initialize press count tracking
     m_LastPressTime = 0;          // Reset last press timestamp
     __GUI_EventManager.Subscribe_FastUpdate(this, EffectID); // Register with GUI update system
@@ -46,7 +49,8 @@ void cSwitchOnOff::Init(DadDrivers::cSwitch* pFootSwitch, uint32_t EffectID) {
 // Description:
 //   - Detects single, and long presses on the footswitch
 //   - Short press toggles On/Off states
-//   - Long press (within .6 second) triggers Bypass mode
+//   - Long press (over 1 second) triggers Bypass mode, or toggles the hold
+//     parameter of the effect
 //-----------------------------------------------------------------------------------
 void cSwitchOnOff::on_GUI_FastUpdate() {
     float 		PressDuration;                          			  // Duration of current press
@@ -69,7 +73,14 @@ void cSwitchOnOff::on_GUI_FastUpdate() {
         	}
         }else if(PressDuration > 1.0f ){
           	m_OldPressCount = PressCount;
-        	__pBypassOnOffManager->setState(eEffectState_t::bypass);
+          	if (m_pHoldParameter != nullptr) {
+          		// Latched: min <-> max on each long press
+          		float Min = m_pHoldParameter->getMinValue();
+          		float Max = m_pHoldParameter->getMaxValue();
+          		m_pHoldParameter->setValue((m_pHoldParameter->getTargetValue() > Min) ? Min : Max);
+          	} else {
+          		__pBypassOnOffManager->setState(eEffectState_t::bypass);
+          	}
         }
     }
 }
@@ -103,6 +114,7 @@ void cTapTempoMemChange::Init(DadDrivers::cSwitch* pFootSwitch,
 // Description:
 //   - Long press (≥250 ms): increment memory slot
 //   - Tap tempo: update parameter based on tap frequency or period
+//   - MIDI clock: update parameter from the locked MIDI clock tempo
 //-----------------------------------------------------------------------------------
 void cTapTempoMemChange::on_GUI_FastUpdate() {
     float PressDuration;                                  // Duration of current press
@@ -135,6 +147,22 @@ void cTapTempoMemChange::on_GUI_FastUpdate() {
             m_PeriodUpdateCount = PeriodUpdateCount;  // Update period tracking
         }
     }
+
+    // MIDI clock: follow the incoming tempo while the clock is locked
+    if ((m_TempoType != eTempoType::none) && (m_pParameter != nullptr)) {
+        float BeatPeriod = DadDrivers::__MidiClock.getBeatPeriod();   // 0 when not locked
+        if (BeatPeriod == 0.0f) {
+            m_ClockBeatPeriod = 0.0f;                  // Re-apply the tempo on the next lock
+        } else if (fabsf(BeatPeriod - m_ClockBeatPeriod) > (BeatPeriod * CLOCK_TEMPO_TOLERANCE)) {
+            // Tempo change: update parameter based on tempo type
+            if (m_TempoType == eTempoType::frequency) {
+                m_pParameter->setValue(1.0f / BeatPeriod);
+            } else {
+                m_pParameter->setValue(BeatPeriod);
+            }
+            m_ClockBeatPeriod = BeatPeriod;
+        }
+    }
 }
 
 } // namespace DadGUI
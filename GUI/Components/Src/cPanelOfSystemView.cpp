@@ -21,6 +21,26 @@ namespace DadGUI {
 
 extern cThemesManager   __ThemesManager;        // Themes manager instance
 
+// Discrete values shared by the system panels of all effects (flash)
+static constexpr sDiscretValues __ThemeNames[] = {
+    { "MixBlue",  "MixBlue"   },
+    { "BlueGr",   "BlueGreen" },
+    { "Amber2",   "Amber2"    },
+    { "Blue",     "Blue"      },
+    { "Amber",    "Amber"     },
+    { "Yellow",   "Yellow"    },
+    { "Purple",   "Purple"    },
+    { "PaleBlue", "PaleBlue"  }
+};
+
+static constexpr sDiscretValues __MidiChannelNames[] = {
+    { "All",    "All Channels" },
+    { "CH. 1",  "Channel 1"  }, { "CH. 2",  "Channel 2"  }, { "CH. 3",  "Channel 3"  }, { "CH. 4",  "Channel 4"  },
+    { "CH. 5",  "Channel 5"  }, { "CH. 6",  "Channel 6"  }, { "CH. 7",  "Channel 7"  }, { "CH. 8",  "Channel 8"  },
+    { "CH. 9",  "Channel 9"  }, { "CH. 10", "Channel 10" }, { "CH. 11", "Channel 11" }, { "CH. 12", "Channel 12" },
+    { "CH. 13", "Channel 13" }, { "CH. 14", "Channel 14" }, { "CH. 15", "Channel 15" }, { "CH. 16", "Channel 16" }
+};
+
 //**********************************************************************************
 // Class: cPanelOfSystemView
 //
@@ -35,36 +55,13 @@ void cPanelOfSystemView::Initialize(uint32_t SerializeID) {
     // Initialize color theme parameter and view
     m_ColorTheme.Init(SerializeID, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, ColorCallback, (uint32_t) this);
     m_ColorThemeView.Init(&m_ColorTheme, "Theme", "Color Theme");
-    m_ColorThemeView.AddDiscreteValue("MixBlue", "MixBlue");
-    m_ColorThemeView.AddDiscreteValue("BlueGr", "BlueGreen");
-    m_ColorThemeView.AddDiscreteValue("Amber2", "Amber2");
-    m_ColorThemeView.AddDiscreteValue("Blue", "Blue");      // Add color theme options
-    m_ColorThemeView.AddDiscreteValue("Amber", "Amber");
-    m_ColorThemeView.AddDiscreteValue("Yellow", "Yellow");
-    m_ColorThemeView.AddDiscreteValue("Purple", "Purple");
-    m_ColorThemeView.AddDiscreteValue("PaleBlue", "PaleBlue");
+    m_ColorThemeView.setDiscreteValues(__ThemeNames, sizeof(__ThemeNames) / sizeof(__ThemeNames[0]));
     m_ColorTheme.resetDrawInfoView();
 
     // Initialize MIDI channel parameter and view
     m_MidiChannel.Init(SerializeID, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, MIDICallback, (uint32_t) this);
     m_MidiChannelView.Init(&m_MidiChannel, "MIDI", "MIDI Channel");
-    m_MidiChannelView.AddDiscreteValue("All", "All Channels");  // Add MIDI channel options
-    m_MidiChannelView.AddDiscreteValue("CH. 1", "Channel 1");
-    m_MidiChannelView.AddDiscreteValue("CH. 2", "Channel 2");
-    m_MidiChannelView.AddDiscreteValue("CH. 3", "Channel 3");
-    m_MidiChannelView.AddDiscreteValue("CH. 4", "Channel 4");
-    m_MidiChannelView.AddDiscreteValue("CH. 5", "Channel 5");
-    m_MidiChannelView.AddDiscreteValue("CH. 6", "Channel 6");
-    m_MidiChannelView.AddDiscreteValue("CH. 7", "Channel 7");
-    m_MidiChannelView.AddDiscreteValue("CH. 8", "Channel 8");
-    m_MidiChannelView.AddDiscreteValue("CH. 9", "Channel 9");
-    m_MidiChannelView.AddDiscreteValue("CH. 10", "Channel 10");
-    m_MidiChannelView.AddDiscreteValue("CH. 11", "Channel 11");
-    m_MidiChannelView.AddDiscreteValue("CH. 12", "Channel 12");
-    m_MidiChannelView.AddDiscreteValue("CH. 13", "Channel 13");
-    m_MidiChannelView.AddDiscreteValue("CH. 14", "Channel 14");
-    m_MidiChannelView.AddDiscreteValue("CH. 15", "Channel 15");
-    m_MidiChannelView.AddDiscreteValue("CH. 16", "Channel 16");
+    m_MidiChannelView.setDiscreteValues(__MidiChannelNames, sizeof(__MidiChannelNames) / sizeof(__MidiChannelNames[0]));
 
     // Initialize the parameter view with theme and MIDI controls
     cPanelOfParameterView::Init(&m_ColorThemeView, nullptr, &m_MidiChannelView);
@@ -11,11 +11,13 @@
 #include "GUI_Defines.h"
 #include "MainGUI.h"
 #include "ParameterViews.h"
+#include "cMidi.h"
 
 // *****************************************************************************
 // Global variables declarations
 // *****************************************************************************
 extern DadGUI::cMainGUI		__GUI;
+extern DadDrivers::cMidi	__Midi;
 
 namespace DadGUI {
 
@@ -85,7 +87,8 @@ void cParameterInfoView::HideParamView() {
 // Update GUI Object time GUI_UPDATE_MS in __ms__
 // ---------------------------------------------------------------------------------
 void cParameterInfoView::on_GUI_Update(){
-	if(m_InfoViewTimeCounter > 0){
+	// Banner kept while waiting for the MIDI learn controller
+	if((m_InfoViewTimeCounter > 0) && !__Midi.isLearning()){
 		m_InfoViewTimeCounter -= GUI_UPDATE_MS;
 		if(m_InfoViewTimeCounter <= 0){
 			m_InfoViewTimeCounter = 0;
@@ -100,7 +103,7 @@ void cParameterInfoView::on_GUI_Update(){
 void cParameterInfoView::ParameterChange(void* pParameter, uint32_t Context){
 	cParameterInfoView* pThis = (cParameterInfoView*)Context;
 	cParameterView* pParameterView = (cParameterView*) pParameter;
-	pThis->ShowParamView(pParameterView->getInfoName() , pParameterView->getInfoValue());
+	pThis->ShowParamView(pParameterView->getInfoName() , pParameterView->getInfoBanner());
 }
 
 }// namespace DadGUI
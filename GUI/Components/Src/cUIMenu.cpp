@@ -49,7 +49,7 @@ void cUIMenu::Init() {
     m_pDynMenuLayer  = __Display.addLayer(&__LayerMenuLayerDyn[0][0], 0, 0, SCREEN_WIDTH, MENU_HEIGHT, 0);
     m_pStatMenuLayer = __Display.addLayer(&__LayerMenuLayerStat[0][0], 0, 0, SCREEN_WIDTH, MENU_HEIGHT, 0);
 
-    m_TabMenuItem.clear();   // Remove all menu items
+    m_NbMenuItems = 0;       // Remove all menu items
     m_ActiveItem = 0;        // Reset current item index
     m_MenuShift  = 0;        // Reset scroll/shift index
     m_isActive   = false;    // Menu starts inactive
@@ -65,13 +65,14 @@ void cUIMenu::Init() {
 //   - Name: Label of the menu item
 //   - pNextMenu: Pointer to the next submenu (optional)
 // -----------------------------------------------------------------------------
-void cUIMenu::addMenuItem(iUIComponent* pItem, const std::string& Name, cUIMenu* pNextMenu) {
-    MenuItem Item;
+void cUIMenu::addMenuItem(iUIComponent* pItem, const char* Name, cUIMenu* pNextMenu) {
+    if (m_NbMenuItems >= MENU_MAX_ITEMS) {
+        Error_Handler();        // Raise MENU_MAX_ITEMS
+    }
+    MenuItem& Item = m_TabMenuItem[m_NbMenuItems++];
     Item.Name      = Name;      // Item display name
     Item.pItem     = pItem;     // Associated UI component
     Item.pNextMenu = pNextMenu; // Next submenu pointer
-
-    m_TabMenuItem.push_back(Item);  // Store in the menu item list
 }
 
 // -----------------------------------------------------------------------------
@@ -88,7 +89,7 @@ void cUIMenu::Activate() {
     drawTab();                            // Draw menu tabs
 
     // Activate the current item if available
-    if (!m_TabMenuItem.empty()) {
+    if (m_NbMenuItems != 0) {
         m_TabMenuItem[m_ActiveItem].pItem->Activate();
     }
 }
@@ -104,7 +105,7 @@ void cUIMenu::Deactivate() {
     m_isActive = false;                   // Mark as inactive
 
     // Deactivate current item if valid
-    if (!m_TabMenuItem.empty()) {
+    if (m_NbMenuItems != 0) {
         m_TabMenuItem[m_ActiveItem].pItem->Deactivate();
     }
 }
@@ -115,7 +116,7 @@ void cUIMenu::Deactivate() {
 // -----------------------------------------------------------------------------
 void cUIMenu::Update() {
     // Skip update if inactive or no items
-    if (!m_isActive || m_TabMenuItem.empty()) return;
+    if (!m_isActive || (m_NbMenuItems == 0)) return;
 
     int8_t OldActiveItem = m_ActiveItem;  // Backup previous selection
 
@@ -125,8 +126,8 @@ void cUIMenu::Update() {
         m_ActiveItem += Increment;  // Change active item index
 
         // Clamp to valid range
-        if (m_ActiveItem >= (int8_t)m_TabMenuItem.size())
-            m_ActiveItem = m_TabMenuItem.size() - 1;
+        if (m_ActiveItem >= (int8_t)m_NbMenuItems)
+            m_ActiveItem = m_NbMenuItems - 1;
         if (m_ActiveItem < 0)
             m_ActiveItem = 0;
 
@@ -180,9 +181,9 @@ void cUIMenu::drawTab() {
         }
 
         // Draw text label if within item list
-        if (Index < m_TabMenuItem.size()) {
+        if (Index < m_NbMenuItems) {
             m_pDynMenuLayer->setFont(FONTXSB);
-            uint16_t TextWidth = m_pDynMenuLayer->getTextWidth(m_TabMenuItem[Index].Name.c_str());
+            uint16_t TextWidth = m_pDynMenuLayer->getTextWidth(m_TabMenuItem[Index].Name);
             m_pDynMenuLayer->setCursor(xTab + (MENU_ITEM_WIDTH - TextWidth) / 2, 2);
 
             if (Index == m_ActiveItem)
@@ -190,14 +191,14 @@ void cUIMenu::drawTab() {
             else
                 m_pDynMenuLayer->setTextFrontColor(__ThemesManager->MenuText);
 
-            m_pDynMenuLayer->drawText(m_TabMenuItem[Index].Name.c_str());
+            m_pDynMenuLayer->drawText(m_TabMenuItem[Index].Name);
             xTab += MENU_ITEM_WIDTH;  // Advance to next tab position
         }
     }
 
     // Draw arrow indicators if needed
     if (m_MenuShift > 0) drawArrowIndicator(true);   // Left arrow
-    if (m_MenuShift < (int8_t)(m_TabMenuItem.size() - NB_MENU_ITEM))
+    if (m_MenuShift < (int8_t)(m_NbMenuItems - NB_MENU_ITEM))
         drawArrowIndicator(false);                    // Right arrow
 }
 
@@ -12,11 +12,13 @@
 #include "cUIParameter.h"
 #include "GUI_Event.h"
 #include "MainGUI.h"
+#include "cMidi.h"
 
 // *****************************************************************************
 // Global variables declarations
 // *****************************************************************************
 extern DadGUI::cMainGUI __GUI;
+extern DadDrivers::cMidi __Midi;
 
 namespace DadGUI {
 
@@ -55,7 +57,8 @@ void cUIParameter::Init(uint32_t SerializeID,
 		Slope = SlopeTime * 1000.0f / (float) GUI_FAST_UPDATE_MS;
 	}
     cParameter::Init(InitValue, Min, Max, RapidIncrement, SlowIncrement,
-                     Callback, CallbackUserData, Slope, Control);
+                     Callback, CallbackUserData, Slope, Control, RTProcess);
+    setStepRate(RTProcess ? SAMPLING_RATE : (1000.0f / (float) GUI_FAST_UPDATE_MS)); // MIDI sweeps
 
     m_MemUIParameterValue = m_TargetValue;
 
@@ -63,10 +66,40 @@ void cUIParameter::Init(uint32_t SerializeID,
     DadGUI::__GUI_EventManager.Subscribe_AllSerializeEvents(this, SerializeID);
     DadGUI::__GUI_EventManager.Subscribe_Update(this, SerializeID);
 	if(RTProcess){
-		DadGUI::__GUI_EventManager.Subscribe_RT_Process(this, SerializeID);
+		// Processed in the audio thread only while the value moves
+		DadGUI::__GUI_EventManager.Subscribe_RT_Parameter(this, SerializeID);
 	}else{
 		DadGUI::__GUI_EventManager.Subscribe_FastUpdate(this, SerializeID);
 	}
+
+	// Can be bound to a controller by MIDI learn
+	__Midi.addLearnableParameter(this, SerializeID);
+}
+
+//***********************************************************************************
+// Method: Init
+// Description:
+// Initializes parameter from a constant descriptor
+//***********************************************************************************
+void cUIParameter::Init(uint32_t SerializeID, const sUIParameterDesc& Desc, uint32_t CallbackUserData)
+{
+    Init(SerializeID, Desc.InitValue, Desc.Min, Desc.Max,
+         Desc.RapidIncrement, Desc.SlowIncrement,
+         Desc.Callback, CallbackUserData, Desc.SlopeTime,
+         Desc.Control, Desc.RTProcess);
+    if ((Desc.Curve != DadDSP::eSmoothCurve::Linear) || (Desc.CallbackDecimation != 1)) {
+        setSmoothing(Desc.Curve, Desc.CallbackDecimation);
+    }
+}
+
+//***********************************************************************************
+// Method: setTransient
+// Description:
+// Removes the parameter from the presets (call after Init)
+//***********************************************************************************
+void cUIParameter::setTransient()
+{
+    DadGUI::__GUI_EventManager.Unsubscribe_AllSerializeEvents(this);
 }
 
 //***********************************************************************************
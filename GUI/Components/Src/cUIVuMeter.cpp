@@ -73,8 +73,8 @@ void cUIVuMeter::Init() {
     m_MemClippingOutRight = false;  // Right channel clipping memory
 
     __GUI_EventManager.Subscribe_Update(this);
-    __GUI_EventManager.Subscribe_RT_ProcessIn(this);
-    __GUI_EventManager.Subscribe_RT_ProcessOut(this);
+    __GUI_EventManager.Subscribe_RT_ProcessInBlock(this);
+    __GUI_EventManager.Subscribe_RT_ProcessOutBlock(this);
 }
 
 // ---------------------------------------------------------------------------------
@@ -279,26 +279,26 @@ void cUIVuMeter::drawDynPartOffLayer() {
 }
 
 // ---------------------------------------------------------------------------------
-// Function: GUIProcessIn
-// Description: Processes audio input buffers and updates VU-meter readings in real time
+// Function: on_GUI_RT_ProcessInBlock
+// Description: Processes an audio input block and updates VU-meter readings in real time
 // ---------------------------------------------------------------------------------
-void cUIVuMeter::on_GUI_RT_ProcessIn(AudioBuffer* pIn) {
+void cUIVuMeter::on_GUI_RT_ProcessInBlock(const AudioBuffer* pIn, uint32_t NbSamples) {
     if (m_isActive) {
-        // Process left and right audio channels
-        m_VuMeterInLeft.CalcPeakAndLevel(pIn->Left);
-        m_VuMeterInRight.CalcPeakAndLevel(pIn->Right);
+        // Process left and right audio channels (interleaved, stride 2)
+        m_VuMeterInLeft.CalcPeakAndLevelBlock(&pIn->Left, NbSamples, 2);
+        m_VuMeterInRight.CalcPeakAndLevelBlock(&pIn->Right, NbSamples, 2);
     }
 }
 
 // ---------------------------------------------------------------------------------
-// Function: GUIProcessOut
-// Description: Processes audio output buffers and updates VU-meter readings in real time
+// Function: on_GUI_RT_ProcessOutBlock
+// Description: Processes an audio output block and updates VU-meter readings in real time
 // ---------------------------------------------------------------------------------
-void cUIVuMeter::on_GUI_RT_ProcessOut(AudioBuffer* pOut) {
+void cUIVuMeter::on_GUI_RT_ProcessOutBlock(const AudioBuffer* pOut, uint32_t NbSamples) {
     if (m_isActive) {
-        // Process left and right audio channels
-        m_VuMeterOutLeft.CalcPeakAndLevel(pOut->Left);
-        m_VuMeterOutRight.CalcPeakAndLevel(pOut->Right);
+        // Process left and right audio channels (interleaved, stride 2)
+        m_VuMeterOutLeft.CalcPeakAndLevelBlock(&pOut->Left, NbSamples, 2);
+        m_VuMeterOutRight.CalcPeakAndLevelBlock(&pOut->Right, NbSamples, 2);
     }
 }
 
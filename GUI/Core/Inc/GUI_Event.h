@@ -11,9 +11,69 @@
 #include "main.h"
 #include "AudioManager.h"
 #include "EventManager.h"
+#include "RTEventTable.h"
 #include "Serialize.h"
+#include "cParameterScheduler.h"
+
+#ifndef GUI_MAX_PARAMETERS
+#define GUI_MAX_PARAMETERS 96           // UI parameters alive at once (chain of 3 effects)
+#endif
+#ifndef GUI_MAX_LISTENERS
+#define GUI_MAX_LISTENERS 16            // Other Update / FastUpdate listeners
+#endif
 
 namespace DadGUI {
+class iGUI_EventListener;
+}
+
+namespace DadUtilities {
+
+// -----------------------------------------------------------------------------
+// Subscriber node pools sized on the UI parameters: each one takes an Update
+// and a FastUpdate node, a Save and a Restore node, and an IsDirty node
+// -----------------------------------------------------------------------------
+template<>
+struct SubscriberNodePoolSize<SubscriberNode<DadGUI::iGUI_EventListener, void>> {
+    static constexpr uint32_t Value = 2 * GUI_MAX_PARAMETERS + GUI_MAX_LISTENERS;
+};
+
+template<>
+struct SubscriberNodePoolSize<SubscriberNode<DadPersistentStorage::cSerializedObject, void, DadPersistentStorage::cSerialize*>> {
+    static constexpr uint32_t Value = 2 * GUI_MAX_PARAMETERS;
+};
+
+template<>
+struct SubscriberNodePoolSize<SubscriberNode<DadPersistentStorage::cSerializedObject, bool>> {
+    static constexpr uint32_t Value = GUI_MAX_PARAMETERS;
+};
+
+} // namespace DadUtilities
+
+namespace DadGUI {
+
+#ifndef RT_EVENT_MAX_SUBSCRIBERS
+#define RT_EVENT_MAX_SUBSCRIBERS 32     // Capacity of each real-time dispatch table
+#endif
+
+#ifdef MONITOR
+//**********************************************************************************
+// Class: cRTDispatchTimer
+// Description: Adds the cycles of one RT event send (listeners included) to a
+//              counter, from its construction to the end of the scope
+//**********************************************************************************
+class cRTDispatchTimer {
+public:
+    inline explicit cRTDispatchTimer(volatile uint32_t& Cycles) : m_Cycles(Cycles), m_Start(DWT->CYCCNT) {}
+    inline ~cRTDispatchTimer() { m_Cycles = m_Cycles + (DWT->CYCCNT - m_Start); }
+
+private:
+    volatile uint32_t&  m_Cycles;
+    uint32_t            m_Start;
+};
+#define RT_DISPATCH_TIMER   cRTDispatchTimer DispatchTimer(m_RTDispatchCycles);
+#else
+#define RT_DISPATCH_TIMER
+#endif
 
 //**********************************************************************************
 // Class: iGUI_EventListener
@@ -37,6 +97,15 @@ public:
     // Process audio buffer through GUI object after audio process
     virtual void on_GUI_RT_ProcessOut(AudioBuffer *pOut){};
 
+    // Read the whole input block once per audio callback (metering, analysis,
+    // MIDI scheduling)
+    // Sent by cMainGUI::beginAudioBlock, before the per-sample events
+    virtual void on_GUI_RT_ProcessInBlock(const AudioBuffer *pIn, uint32_t NbSamples){};
+
+    // Read the whole output block once per audio callback (metering, analysis)
+    // Sent by cMainGUI::endAudioBlock, after the per-sample events
+    virtual void on_GUI_RT_ProcessOutBlock(const AudioBuffer *pOut, uint32_t NbSamples){};
+
     // Update GUI Object time GUI_UPDATE_MS in __ms__
     virtual void on_GUI_Update(){};
 
@@ -77,9 +146,23 @@ public:
     // Parameters:
     //   - listener: Pointer to the listener object
     //   - family: Family ID (0 = receives all events, default)
+    // Returns: false if the table is full (Error_Handler is called first)
     // -----------------------------------------------------------------------------
-    inline void Subscribe_RT_Process(iGUI_EventListener* listener, uint32_t family = 0) {
-        m_rtProcessManager.Subscribe(listener, &iGUI_EventListener::on_GUI_RT_Process, family);
+    inline bool Subscribe_RT_Process(iGUI_EventListener* listener, uint32_t family = 0) {
+        return checkRTSubscribe(m_rtProcessManager.Subscribe(listener, &iGUI_EventListener::on_GUI_RT_Process, family));
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: Subscribe_RT_Parameter
+    // Description: Subscribe a parameter smoothed in the audio thread. It is
+    //              processed with the RT Process event, only while it moves.
+    // Parameters:
+    //   - pParameter: Pointer to the parameter
+    //   - family: Family ID (0 = always processed, default)
+    // Returns: false if the scheduler is full (Error_Handler is called first)
+    // -----------------------------------------------------------------------------
+    inline bool Subscribe_RT_Parameter(DadDSP::cParameter* pParameter, uint32_t family = 0) {
+        return checkRTSubscribe(m_rtParameterScheduler.Register(pParameter, family));
     }
 
     // -----------------------------------------------------------------------------
@@ -88,9 +171,10 @@ public:
     // Parameters:
     //   - listener: Pointer to the listener object
     //   - family: Family ID (0 = receives all events, default)
+    // Returns: false if the table is full (Error_Handler is called first)
     // -----------------------------------------------------------------------------
-    inline void Subscribe_RT_ProcessIn(iGUI_EventListener* listener, uint32_t family = 0) {
-        m_rtProcessInManager.Subscribe(listener, &iGUI_EventListener::on_GUI_RT_ProcessIn, family);
+    inline bool Subscribe_RT_ProcessIn(iGUI_EventListener* listener, uint32_t family = 0) {
+        return checkRTSubscribe(m_rtProcessInManager.Subscribe(listener, &iGUI_EventListener::on_GUI_RT_ProcessIn, family));
     }
 
     // -----------------------------------------------------------------------------
@@ -99,9 +183,34 @@ public:
     // Parameters:
     //   - listener: Pointer to the listener object
     //   - family: Family ID (0 = receives all events, default)
+    // Returns: false if the table is full (Error_Handler is called first)
+    // -----------------------------------------------------------------------------
+    inline bool Subscribe_RT_ProcessOut(iGUI_EventListener* listener, uint32_t family = 0) {
+        return checkRTSubscribe(m_rtProcessOutManager.Subscribe(listener, &iGUI_EventListener::on_GUI_RT_ProcessOut, family));
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: Subscribe_RT_ProcessInBlock
+    // Description: Subscribe to pre-audio block events
+    // Parameters:
+    //   - listener: Pointer to the listener object
+    //   - family: Family ID (0 = receives all events, default)
+    // Returns: false if the table is full (Error_Handler is called first)
     // -----------------------------------------------------------------------------
-    inline void Subscribe_RT_ProcessOut(iGUI_EventListener* listener, uint32_t family = 0) {
-        m_rtProcessOutManager.Subscribe(listener, &iGUI_EventListener::on_GUI_RT_ProcessOut, family);
+    inline bool Subscribe_RT_ProcessInBlock(iGUI_EventListener* listener, uint32_t family = 0) {
+        return checkRTSubscribe(m_rtProcessInBlockManager.Subscribe(listener, &iGUI_EventListener::on_GUI_RT_ProcessInBlock, family));
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: Subscribe_RT_ProcessOutBlock
+    // Description: Subscribe to post-audio block events
+    // Parameters:
+    //   - listener: Pointer to the listener object
+    //   - family: Family ID (0 = receives all events, default)
+    // Returns: false if the table is full (Error_Handler is called first)
+    // -----------------------------------------------------------------------------
+    inline bool Subscribe_RT_ProcessOutBlock(iGUI_EventListener* listener, uint32_t family = 0) {
+        return checkRTSubscribe(m_rtProcessOutBlockManager.Subscribe(listener, &iGUI_EventListener::on_GUI_RT_ProcessOutBlock, family));
     }
 
     // -----------------------------------------------------------------------------
@@ -204,6 +313,22 @@ public:
         m_rtProcessOutManager.Unsubscribe(listener);
     }
 
+    // -----------------------------------------------------------------------------
+    // Method: Unsubscribe_RT_ProcessInBlock
+    // Description: Unsubscribe from pre-audio block events
+    // -----------------------------------------------------------------------------
+    inline void Unsubscribe_RT_ProcessInBlock(iGUI_EventListener* listener) {
+        m_rtProcessInBlockManager.Unsubscribe(listener);
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: Unsubscribe_RT_ProcessOutBlock
+    // Description: Unsubscribe from post-audio block events
+    // -----------------------------------------------------------------------------
+    inline void Unsubscribe_RT_ProcessOutBlock(iGUI_EventListener* listener) {
+        m_rtProcessOutBlockManager.Unsubscribe(listener);
+    }
+
     // -----------------------------------------------------------------------------
     // Method: Unsubscribe_Update
     // Description: Unsubscribe from regular GUI update events
@@ -287,6 +412,22 @@ public:
         return m_rtProcessOutManager.SetSubscriberFamily(listener, newFamily);
     }
 
+    // -----------------------------------------------------------------------------
+    // Method: SetFamily_RT_ProcessInBlock
+    // Description: Change family for pre-audio block events
+    // -----------------------------------------------------------------------------
+    inline bool SetFamily_RT_ProcessInBlock(iGUI_EventListener* listener, uint32_t newFamily) {
+        return m_rtProcessInBlockManager.SetSubscriberFamily(listener, newFamily);
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: SetFamily_RT_ProcessOutBlock
+    // Description: Change family for post-audio block events
+    // -----------------------------------------------------------------------------
+    inline bool SetFamily_RT_ProcessOutBlock(iGUI_EventListener* listener, uint32_t newFamily) {
+        return m_rtProcessOutBlockManager.SetSubscriberFamily(listener, newFamily);
+    }
+
     // -----------------------------------------------------------------------------
     // Method: SetFamily_Update
     // Description: Change family for regular GUI update events
@@ -331,6 +472,28 @@ public:
         return m_SerializeisDirtyManager.SetSubscriberFamily(serializable, newFamily);
     }
 
+    // -----------------------------------------------------------------------------
+    // Method: MoveFamily4AllEvents
+    // Description: Move all subscribers of a family to another family, for ALL
+    //              event types (used to merge the effects of a chain into one family)
+    // Parameters:
+    //   - oldFamily: Family ID to move
+    //   - newFamily: New family ID to assign
+    // -----------------------------------------------------------------------------
+    inline void MoveFamily4AllEvents(uint32_t oldFamily, uint32_t newFamily) {
+        m_rtProcessManager.MoveFamily(oldFamily, newFamily);
+        m_rtParameterScheduler.MoveFamily(oldFamily, newFamily);
+        m_rtProcessInManager.MoveFamily(oldFamily, newFamily);
+        m_rtProcessOutManager.MoveFamily(oldFamily, newFamily);
+        m_rtProcessInBlockManager.MoveFamily(oldFamily, newFamily);
+        m_rtProcessOutBlockManager.MoveFamily(oldFamily, newFamily);
+        m_updateManager.MoveFamily(oldFamily, newFamily);
+        m_fastUpdateManager.MoveFamily(oldFamily, newFamily);
+        m_SerializeSaveManager.MoveFamily(oldFamily, newFamily);
+        m_SerializeRestoreManager.MoveFamily(oldFamily, newFamily);
+        m_SerializeisDirtyManager.MoveFamily(oldFamily, newFamily);
+    }
+
     // -----------------------------------------------------------------------------
     // Active Family Setter Methods
     // -----------------------------------------------------------------------------
@@ -342,7 +505,8 @@ public:
     //   - family: Family ID to set as active
     // -----------------------------------------------------------------------------
     inline void SetActiveFamily_RT_Process(uint32_t family) {
-        m_activeFamilyRTProcess = family;
+        m_rtProcessManager.SetActiveFamily(family);
+        m_rtParameterScheduler.SetActiveFamily(family);
     }
 
     // -----------------------------------------------------------------------------
@@ -352,7 +516,7 @@ public:
     //   - family: Family ID to set as active
     // -----------------------------------------------------------------------------
     inline void SetActiveFamily_RT_ProcessIn(uint32_t family) {
-        m_activeFamilyRTProcessIn = family;
+        m_rtProcessInManager.SetActiveFamily(family);
     }
 
     // -----------------------------------------------------------------------------
@@ -362,7 +526,18 @@ public:
     //   - family: Family ID to set as active
     // -----------------------------------------------------------------------------
     inline void SetActiveFamily_RT_ProcessOut(uint32_t family) {
-        m_activeFamilyRTProcessOut = family;
+        m_rtProcessOutManager.SetActiveFamily(family);
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: SetActiveFamily_RT_ProcessBlock
+    // Description: Set active family for RT Process In/Out block events
+    // Parameters:
+    //   - family: Family ID to set as active
+    // -----------------------------------------------------------------------------
+    inline void SetActiveFamily_RT_ProcessBlock(uint32_t family) {
+        m_rtProcessInBlockManager.SetActiveFamily(family);
+        m_rtProcessOutBlockManager.SetActiveFamily(family);
     }
 
     // -----------------------------------------------------------------------------
@@ -422,9 +597,12 @@ public:
     //   - family: Family ID to set as active for all event types
     // -----------------------------------------------------------------------------
     inline void SetActiveFamily4AllEvents(uint32_t family) {
-        m_activeFamilyRTProcess = family;
-        m_activeFamilyRTProcessIn = family;
-        m_activeFamilyRTProcessOut = family;
+        m_rtProcessManager.SetActiveFamily(family);
+        m_rtParameterScheduler.SetActiveFamily(family);
+        m_rtProcessInManager.SetActiveFamily(family);
+        m_rtProcessOutManager.SetActiveFamily(family);
+        m_rtProcessInBlockManager.SetActiveFamily(family);
+        m_rtProcessOutBlockManager.SetActiveFamily(family);
         m_activeFamilyUpdate = family;
         m_activeFamilyFastUpdate = family;
         m_activeFamilySerializeSave = family;
@@ -442,7 +620,7 @@ public:
     // Returns: Current active family ID
     // -----------------------------------------------------------------------------
     inline uint32_t GetActiveFamily_RT_Process() const {
-        return m_activeFamilyRTProcess;
+        return m_rtProcessManager.GetActiveFamily();
     }
 
     // -----------------------------------------------------------------------------
@@ -451,7 +629,7 @@ public:
     // Returns: Current active family ID
     // -----------------------------------------------------------------------------
     inline uint32_t GetActiveFamily_RT_ProcessIn() const {
-        return m_activeFamilyRTProcessIn;
+        return m_rtProcessInManager.GetActiveFamily();
     }
 
     // -----------------------------------------------------------------------------
@@ -460,7 +638,16 @@ public:
     // Returns: Current active family ID
     // -----------------------------------------------------------------------------
     inline uint32_t GetActiveFamily_RT_ProcessOut() const {
-        return m_activeFamilyRTProcessOut;
+        return m_rtProcessOutManager.GetActiveFamily();
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: GetActiveFamily_RT_ProcessBlock
+    // Description: Get active family for RT Process In/Out block events
+    // Returns: Current active family ID
+    // -----------------------------------------------------------------------------
+    inline uint32_t GetActiveFamily_RT_ProcessBlock() const {
+        return m_rtProcessInBlockManager.GetActiveFamily();
     }
 
     // -----------------------------------------------------------------------------
@@ -520,6 +707,7 @@ public:
     // -----------------------------------------------------------------------------
     inline void sendEvent_RT_Process(uint32_t family = 0) {
         m_rtProcessManager.sendEvent(family);
+        m_rtParameterScheduler.Process(family);
     }
 
     // -----------------------------------------------------------------------------
@@ -610,7 +798,9 @@ public:
     // Description: Send RT Process event to active family
     // -----------------------------------------------------------------------------
     inline void sendEventToActive_RT_Process() {
-        m_rtProcessManager.sendEvent(m_activeFamilyRTProcess);
+        RT_DISPATCH_TIMER
+        m_rtProcessManager.sendEventToActive();
+        m_rtParameterScheduler.ProcessActive();
     }
 
     // -----------------------------------------------------------------------------
@@ -620,7 +810,8 @@ public:
     //   - pIn: Pointer to input audio buffer
     // -----------------------------------------------------------------------------
     inline void sendEventToActive_RT_ProcessIn(AudioBuffer* pIn) {
-        m_rtProcessInManager.sendEvent(m_activeFamilyRTProcessIn, pIn);
+        RT_DISPATCH_TIMER
+        m_rtProcessInManager.sendEventToActive(pIn);
     }
 
     // -----------------------------------------------------------------------------
@@ -630,9 +821,59 @@ public:
     //   - pOut: Pointer to output audio buffer
     // -----------------------------------------------------------------------------
     inline void sendEventToActive_RT_ProcessOut(AudioBuffer* pOut) {
-        m_rtProcessOutManager.sendEvent(m_activeFamilyRTProcessOut, pOut);
+        RT_DISPATCH_TIMER
+        m_rtProcessOutManager.sendEventToActive(pOut);
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: sendEventToActive_RT_ProcessInBlock
+    // Description: Send RT Process In block event to active family
+    //   Sent once per block by AudioCallback through cMainGUI::beginAudioBlock,
+    //   ahead of its per-sample RT_ProcessIn / RT_Process / RT_ProcessOut
+    //   events.
+    // Parameters:
+    //   - pIn: Pointer to the first sample of the input block
+    //   - NbSamples: Number of samples in the block
+    // -----------------------------------------------------------------------------
+    inline void sendEventToActive_RT_ProcessInBlock(const AudioBuffer* pIn, uint32_t NbSamples) {
+        RT_DISPATCH_TIMER
+        m_rtProcessInBlockManager.sendEventToActive(pIn, NbSamples);
+#ifdef MONITOR
+        m_RTDispatchBlocks = m_RTDispatchBlocks + 1;
+#endif
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: sendEventToActive_RT_ProcessOutBlock
+    // Description: Send RT Process Out block event to active family
+    //   Sent once per block by AudioCallback through cMainGUI::endAudioBlock,
+    //   after its per-sample events
+    // Parameters:
+    //   - pOut: Pointer to the first sample of the output block
+    //   - NbSamples: Number of samples in the block
+    // -----------------------------------------------------------------------------
+    inline void sendEventToActive_RT_ProcessOutBlock(const AudioBuffer* pOut, uint32_t NbSamples) {
+        RT_DISPATCH_TIMER
+        m_rtProcessOutBlockManager.sendEventToActive(pOut, NbSamples);
     }
 
+#ifdef MONITOR
+    // -----------------------------------------------------------------------------
+    // Method: takeRTDispatchStats
+    // Description: Cycles spent in the RT event sends (listeners and parameter
+    //              scheduler included) and audio blocks since the previous call
+    // -----------------------------------------------------------------------------
+    inline void takeRTDispatchStats(uint32_t& Cycles, uint32_t& Blocks) {
+        uint32_t Primask = __get_PRIMASK();
+        __disable_irq();
+        Cycles = m_RTDispatchCycles;
+        Blocks = m_RTDispatchBlocks;
+        m_RTDispatchCycles = 0;
+        m_RTDispatchBlocks = 0;
+        __set_PRIMASK(Primask);
+    }
+#endif
+
     // -----------------------------------------------------------------------------
     // Method: sendEventToActive_Update
     // Description: Send Update event to active family
@@ -690,6 +931,22 @@ public:
         return m_rtProcessManager.GetSubscriberCount(family, includeUniversal);
     }
 
+    // -----------------------------------------------------------------------------
+    // Method: GetSubscriberCount_RT_Parameter
+    // Description: Get number of RT parameters
+    // -----------------------------------------------------------------------------
+    int GetSubscriberCount_RT_Parameter() const {
+        return (int)m_rtParameterScheduler.getRegisteredCount();
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: GetMovingCount_RT_Parameter
+    // Description: Get number of RT parameters currently moving (processed)
+    // -----------------------------------------------------------------------------
+    inline uint32_t GetMovingCount_RT_Parameter() const {
+        return m_rtParameterScheduler.getActiveCount();
+    }
+
     // -----------------------------------------------------------------------------
     // Method: GetSubscriberCount_RT_ProcessIn
     // Description: Get number of RT process in subscribers
@@ -706,6 +963,22 @@ public:
         return m_rtProcessOutManager.GetSubscriberCount(family, includeUniversal);
     }
 
+    // -----------------------------------------------------------------------------
+    // Method: GetSubscriberCount_RT_ProcessInBlock
+    // Description: Get number of RT process in block subscribers
+    // -----------------------------------------------------------------------------
+    int GetSubscriberCount_RT_ProcessInBlock(uint32_t family = UINT32_MAX, bool includeUniversal = false) const {
+        return m_rtProcessInBlockManager.GetSubscriberCount(family, includeUniversal);
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: GetSubscriberCount_RT_ProcessOutBlock
+    // Description: Get number of RT process out block subscribers
+    // -----------------------------------------------------------------------------
+    int GetSubscriberCount_RT_ProcessOutBlock(uint32_t family = UINT32_MAX, bool includeUniversal = false) const {
+        return m_rtProcessOutBlockManager.GetSubscriberCount(family, includeUniversal);
+    }
+
     // -----------------------------------------------------------------------------
     // Method: GetSubscriberCount_Update
     // Description: Get number of update subscribers
@@ -756,18 +1029,18 @@ public:
     // -----------------------------------------------------------------------------
     void Clear() {
         m_rtProcessManager.Clear();
+        m_rtParameterScheduler.Clear();
         m_rtProcessInManager.Clear();
         m_rtProcessOutManager.Clear();
+        m_rtProcessInBlockManager.Clear();
+        m_rtProcessOutBlockManager.Clear();
         m_updateManager.Clear();
         m_fastUpdateManager.Clear();
         m_SerializeSaveManager.Clear();
         m_SerializeRestoreManager.Clear();
         m_SerializeisDirtyManager.Clear();
 
-        // Reset all active families to 0
-        m_activeFamilyRTProcess = 0;
-        m_activeFamilyRTProcessIn = 0;
-        m_activeFamilyRTProcessOut = 0;
+        // Reset all active families to 0 (RT tables reset their own)
         m_activeFamilyUpdate = 0;
         m_activeFamilyFastUpdate = 0;
         m_activeFamilySerializeSave = 0;
@@ -776,25 +1049,43 @@ public:
     }
 
 protected:
+    // -----------------------------------------------------------------------------
+    // Method: checkRTSubscribe
+    // Description: A full RT table is a sizing error: stop at once rather than
+    //              running with a silent listener
+    // -----------------------------------------------------------------------------
+    static inline bool checkRTSubscribe(bool Subscribed) {
+        if (!Subscribed) {
+            Error_Handler();                // Raise RT_EVENT_MAX_SUBSCRIBERS / PARAM_SCHEDULER_MAX
+        }
+        return Subscribed;
+    }
+
     // =============================================================================
     // Protected member variables - Event managers for each event type
     // =============================================================================
 
-    DadUtilities::EventManager<iGUI_EventListener, void> 						m_rtProcessManager;
-    DadUtilities::EventManager<iGUI_EventListener, void, AudioBuffer*> 			m_rtProcessInManager;
-    DadUtilities::EventManager<iGUI_EventListener, void, AudioBuffer*> 			m_rtProcessOutManager;
+    // Real-time events use flat pre-filtered dispatch tables (no list walk, no family test per call)
+    DadUtilities::RTEventTable<iGUI_EventListener, RT_EVENT_MAX_SUBSCRIBERS> 						m_rtProcessManager;
+    DadDSP::cParameterScheduler                                                 m_rtParameterScheduler;  // RT parameters, processed while they move
+    DadUtilities::RTEventTable<iGUI_EventListener, RT_EVENT_MAX_SUBSCRIBERS, AudioBuffer*> 		m_rtProcessInManager;
+    DadUtilities::RTEventTable<iGUI_EventListener, RT_EVENT_MAX_SUBSCRIBERS, AudioBuffer*> 		m_rtProcessOutManager;
+    DadUtilities::RTEventTable<iGUI_EventListener, RT_EVENT_MAX_SUBSCRIBERS, const AudioBuffer*, uint32_t> m_rtProcessInBlockManager;
+    DadUtilities::RTEventTable<iGUI_EventListener, RT_EVENT_MAX_SUBSCRIBERS, const AudioBuffer*, uint32_t> m_rtProcessOutBlockManager;
     DadUtilities::EventManager<iGUI_EventListener, void> 						m_updateManager;
     DadUtilities::EventManager<iGUI_EventListener, void> 						m_fastUpdateManager;
     DadUtilities::EventManager<DadPersistentStorage::cSerializedObject, void, DadPersistentStorage::cSerialize*> m_SerializeSaveManager;
     DadUtilities::EventManager<DadPersistentStorage::cSerializedObject, void, DadPersistentStorage::cSerialize*> m_SerializeRestoreManager;
     DadUtilities::EventManager<DadPersistentStorage::cSerializedObject, bool, void> m_SerializeisDirtyManager;
 
+#ifdef MONITOR
+    volatile uint32_t m_RTDispatchCycles = 0;      // Cycles spent in the RT sends (takeRTDispatchStats)
+    volatile uint32_t m_RTDispatchBlocks = 0;      // Audio blocks (RT_ProcessInBlock sends)
+#endif
+
     // =============================================================================
     // Active family variables for each event type
     // =============================================================================
-    uint32_t m_activeFamilyRTProcess = 0;
-    uint32_t m_activeFamilyRTProcessIn = 0;
-    uint32_t m_activeFamilyRTProcessOut = 0;
     uint32_t m_activeFamilyUpdate = 0;
     uint32_t m_activeFamilyFastUpdate = 0;
     uint32_t m_activeFamilySerializeSave = 0;
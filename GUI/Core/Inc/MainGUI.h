@@ -18,6 +18,11 @@
 #include "GUI_Defines.h"
 #include "cThemesManager.h"
 #include "cMonitor.h"
+#include "cBootProfiler.h"
+
+#ifndef BOOT_SPLASH_HOLD_MS
+#define BOOT_SPLASH_HOLD_MS 1500   // Splash kept after the main loop starts (boot profile reading)
+#endif
 
 // =============================================================================
 // Font Shortcuts
@@ -85,6 +90,15 @@ public:
     // -------------------------------------------------------------------------
     void Start();
 
+    // -------------------------------------------------------------------------
+    // ShowSplash
+    //
+    // Description: Shows the splash screen (needs the fonts: call after
+    //   Initialize). Each boot phase marked from now on is added to the
+    //   screen; the splash is hidden BOOT_SPLASH_HOLD_MS after MainLoop starts.
+    // -------------------------------------------------------------------------
+    void ShowSplash(const char* pTitle);
+
     // -------------------------------------------------------------------------
     // activeMainComponent
     //
@@ -206,6 +220,28 @@ public:
         m_CtRTActivity++;
     }
 
+    // -------------------------------------------------------------------------
+    // beginAudioBlock
+    //
+    // Description: First call of AudioCallback, before the per-sample
+    //   RT events: sends the input block event (MIDI scheduling, metering).
+    // -------------------------------------------------------------------------
+    inline void beginAudioBlock(const AudioBuffer* pIn, uint32_t NbSamples)
+    {
+        __GUI_EventManager.sendEventToActive_RT_ProcessInBlock(pIn, NbSamples);
+    }
+
+    // -------------------------------------------------------------------------
+    // endAudioBlock
+    //
+    // Description: Last call of AudioCallback, after the per-sample
+    //   RT events: sends the output block event (metering).
+    // -------------------------------------------------------------------------
+    inline void endAudioBlock(const AudioBuffer* pOut, uint32_t NbSamples)
+    {
+        __GUI_EventManager.sendEventToActive_RT_ProcessOutBlock(pOut, NbSamples);
+    }
+
 #ifdef MONITOR
     // -------------------------------------------------------------------------
     // startRTMonitoring
@@ -256,6 +292,22 @@ public:
     {
         return m_Frequency;
     }
+
+    // -------------------------------------------------------------------------
+    // getEffectCycles / getEffectMaxCycles
+    //
+    // Description: Returns the average and worst audio callback cost in CPU
+    //   cycles (compare builds with and without TCM_PLACEMENT).
+    // -------------------------------------------------------------------------
+    inline uint32_t getEffectCycles()
+    {
+        return m_EffectCycles;
+    }
+
+    inline uint32_t getEffectMaxCycles()
+    {
+        return m_EffectMaxCycles;
+    }
 #endif
 
 protected:
@@ -270,6 +322,16 @@ protected:
     // -------------------------------------------------------------------------
     static void ThemeChange_CallBack(void* parameter, uint32_t contextValue);
 
+    // -------------------------------------------------------------------------
+    // BootMark_CallBack / drawSplashPhase / drawSplashTotal
+    //
+    // Description: Adds the last boot phase to the splash screen. Only the
+    //   new line and the total are redrawn, so the flush stays short.
+    // -------------------------------------------------------------------------
+    static void BootMark_CallBack(uint32_t Context);
+    void drawSplashPhase(uint8_t Index);
+    void drawSplashTotal();
+
 private:
     // -------------------------------------------------------------------------
     // Private Member Variables
@@ -308,6 +370,14 @@ private:
 
     uint32_t m_SerializeID;                  // Current serialization family ID
 
+    // -------------------------------------------------------------------------
+    // Splash Screen
+    // -------------------------------------------------------------------------
+
+    DadGFX::cLayer* m_pSplashLayer = nullptr; // Full screen splash layer (nullptr: never shown)
+    bool     m_SplashVisible = false;        // Splash above the components
+    uint16_t m_SplashPhasesY = 0;            // Y of the first phase line
+
     // -------------------------------------------------------------------------
     // Font Resources
     // -------------------------------------------------------------------------
@@ -340,6 +410,8 @@ private:
     float m_CPULoad;                         // Current CPU load percentage
     float m_EffectTime;                      // Average effect execution time (us)
     float m_Frequency;                       // Average processing frequency (Hz)
+    uint32_t m_EffectCycles;                 // Average audio callback cost (cycles)
+    uint32_t m_EffectMaxCycles;              // Worst audio callback cost (cycles)
 #endif
 };
 
@@ -14,6 +14,7 @@
 #include "MainGUI.h"
 #include "cDisplay.h"
 #include "cFlasherStorage.h"
+#include <cstdio>
 
 // *****************************************************************************
 // Global variables declarations
@@ -23,6 +24,10 @@ extern DadPersistentStorage::cFlasherStorage __FlasherStorage;
 
 namespace DadGUI {
 
+DECLARE_LAYER(SplashLayer, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+constexpr uint16_t SPLASH_MARGIN = 12;      // Left/right margin of the phase lines
+
 //----------------------------------------------------------------------------
 // Global Variables
 //----------------------------------------------------------------------------
@@ -86,7 +91,10 @@ void cMainGUI::Initialize()
     m_CPULoad = 0;
     m_EffectTime = 0;
     m_Frequency = 0;
+    m_EffectCycles = 0;
+    m_EffectMaxCycles = 0;
 #endif
+    __BootProfiler.Mark("GUI");
 }
 
 //----------------------------------------------------------------------------
@@ -99,6 +107,109 @@ void cMainGUI::Start()
 {
     // Initialize memory management system
     __MemoryManager.Init();
+    __BootProfiler.Mark("Preset");
+}
+
+//----------------------------------------------------------------------------
+// Splash Screen
+//----------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------
+// ShowSplash
+//
+// Description: Draws the title and the phases already marked, then adds
+//   each new phase as it is marked.
+//----------------------------------------------------------------------------
+void cMainGUI::ShowSplash(const char* pTitle)
+{
+    if (m_pSplashLayer == nullptr) {
+        m_pSplashLayer = ADD_LAYER(__Display, SplashLayer, 0, 0, 0);
+    }
+    m_pSplashLayer->changeZOrder(60);                 // Above every component
+    m_SplashVisible = true;
+    m_pSplashLayer->eraseLayer(__ThemesManager->SplatchBack);
+
+    // Title
+    m_pSplashLayer->setFont(m_pFontXXLB);
+    uint16_t TitleWidth = m_pSplashLayer->getTextWidth(pTitle);
+    m_pSplashLayer->setCursor((SCREEN_WIDTH - TitleWidth) / 2, SPLASH_MARGIN);
+    m_pSplashLayer->setTextFrontColor(__ThemesManager->SplatchText);
+    m_pSplashLayer->drawText(pTitle);
+    m_SplashPhasesY = SPLASH_MARGIN * 2 + m_pSplashLayer->getTextHeight();
+
+    // Phases marked before the splash
+    for (uint8_t Index = 0; Index < __BootProfiler.getNbPhases(); Index++) {
+        drawSplashPhase(Index);
+    }
+    drawSplashTotal();
+    __Display.flush();
+
+    __BootProfiler.setListener(BootMark_CallBack, (uint32_t)this);
+}
+
+//----------------------------------------------------------------------------
+// BootMark_CallBack
+//----------------------------------------------------------------------------
+void cMainGUI::BootMark_CallBack(uint32_t Context)
+{
+    cMainGUI* pThis = reinterpret_cast<cMainGUI*>(Context);
+    pThis->drawSplashPhase(__BootProfiler.getNbPhases() - 1);
+    pThis->drawSplashTotal();
+    __Display.flush();
+}
+
+//----------------------------------------------------------------------------
+// drawSplashPhase
+//
+// Description: Phase name on the left, duration on the right. Phases that
+//   do not fit on the screen are only kept in the profiler.
+//----------------------------------------------------------------------------
+void cMainGUI::drawSplashPhase(uint8_t Index)
+{
+    if (!m_SplashVisible || (Index >= __BootProfiler.getNbPhases())) return;
+
+    m_pSplashLayer->setFont(m_pFontXS);
+    uint16_t LineHeight = m_pSplashLayer->getTextHeight() + 2;
+    uint16_t NbLines = (SCREEN_HEIGHT - m_SplashPhasesY - SPLASH_MARGIN) / LineHeight;
+    if ((NbLines < 2) || (Index >= (NbLines - 1))) return;   // Last line: total
+
+    const DadUtilities::sBootPhase& Phase = __BootProfiler.getPhase(Index);
+    uint16_t y = m_SplashPhasesY + Index * LineHeight;
+
+    char Buffer[16];
+    uint32_t Tenths = (uint32_t)(__BootProfiler.CyclesToMs(Phase.Cycles) * 10.0f + 0.5f);
+    snprintf(Buffer, sizeof(Buffer), "%lu.%lu ms", (unsigned long)(Tenths / 10), (unsigned long)(Tenths % 10));
+
+    m_pSplashLayer->setTextFrontColor(__ThemesManager->SplatchText);
+    m_pSplashLayer->setCursor(SPLASH_MARGIN, y);
+    m_pSplashLayer->drawText(Phase.pName);
+    m_pSplashLayer->setCursor(SCREEN_WIDTH - SPLASH_MARGIN - m_pSplashLayer->getTextWidth(Buffer), y);
+    m_pSplashLayer->drawText(Buffer);
+}
+
+//----------------------------------------------------------------------------
+// drawSplashTotal
+//
+// Description: Time since the profiler start, on the bottom line
+//----------------------------------------------------------------------------
+void cMainGUI::drawSplashTotal()
+{
+    if (!m_SplashVisible) return;
+
+    m_pSplashLayer->setFont(m_pFontXSB);
+    uint16_t LineHeight = m_pSplashLayer->getTextHeight() + 2;
+    uint16_t y = SCREEN_HEIGHT - SPLASH_MARGIN - LineHeight;
+    m_pSplashLayer->drawFillRect(0, y, SCREEN_WIDTH, LineHeight, __ThemesManager->SplatchBack);
+
+    char Buffer[24];
+    uint32_t Tenths = (uint32_t)(__BootProfiler.CyclesToMs(__BootProfiler.getTotalCycles()) * 10.0f + 0.5f);
+    snprintf(Buffer, sizeof(Buffer), "%lu.%lu ms", (unsigned long)(Tenths / 10), (unsigned long)(Tenths % 10));
+
+    m_pSplashLayer->setTextFrontColor(__ThemesManager->SplatchText);
+    m_pSplashLayer->setCursor(SPLASH_MARGIN, y);
+    m_pSplashLayer->drawText("Total");
+    m_pSplashLayer->setCursor(SCREEN_WIDTH - SPLASH_MARGIN - m_pSplashLayer->getTextWidth(Buffer), y);
+    m_pSplashLayer->drawText(Buffer);
 }
 
 //----------------------------------------------------------------------------
@@ -170,10 +281,23 @@ void cMainGUI::MainLoop()
     uint32_t lastMonitor    = HAL_GetTick();
 #endif
 
+    // End of the boot profile, the splash is kept for reading
+    __BootProfiler.Mark("Main loop");
+    __BootProfiler.Stop();
+    __BootProfiler.setListener(nullptr, 0);
+    uint32_t splashStart    = HAL_GetTick();
+
     while (1)
     {
         uint32_t currentTick = HAL_GetTick();
 
+        // Splash screen end
+        if (m_SplashVisible && (currentTick - splashStart >= BOOT_SPLASH_HOLD_MS))
+        {
+            m_pSplashLayer->changeZOrder(0);
+            m_SplashVisible = false;
+        }
+
         // GUI Fast Update
         if (currentTick - lastGUIFast >= GUI_FAST_UPDATE_MS)
         {
@@ -200,6 +324,8 @@ void cMainGUI::MainLoop()
             m_CPULoad    = m_Monitor.getCPULoad_percent();
             m_EffectTime = m_Monitor.getAverageExecutionTime_us();
             m_Frequency  = m_Monitor.getAverageFrequency_Hz();
+            m_EffectCycles    = m_Monitor.getAverageExecutionCycles();
+            m_EffectMaxCycles = m_Monitor.getMaxExecutionCycles();
             m_Monitor.reset();
         }
 #endif
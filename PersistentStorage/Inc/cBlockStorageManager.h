@@ -97,6 +97,31 @@ public:
     // Gets the size of data from flash memory using save number as identifier
     uint32_t getSize(uint32_t saveNumber);
 
+    // -----------------------------------------------------------------------------
+    // Reads part of a save (Offset, Length) without loading the whole save
+    // Returns the number of bytes read
+    uint32_t Read(uint32_t saveNumber, uint32_t Offset, void* pData, uint32_t Length);
+
+    // -----------------------------------------------------------------------------
+    // Enumerates the saves: first call with Index = 0, false when no save is left
+    bool getNextSave(uint32_t& Index, uint32_t& saveNumber, uint32_t& Size);
+
+    // -----------------------------------------------------------------------------
+    // Streaming save (data received in pieces, one flash block in RAM)
+    // The blocks are written as pending; EndSave replaces the previous save
+    // with the same number, so an interrupted stream leaves it untouched.
+    bool BeginSave(uint32_t saveNumber, uint32_t Size);
+    bool WriteSave(const void* pData, uint32_t Length);
+    bool EndSave();
+    void AbortSave();
+
+    // -----------------------------------------------------------------------------
+    // Streaming save in progress: number, announced size and bytes received
+    inline bool isSaving() const { return m_StreamActive; }
+    inline uint32_t getStreamNumber() const { return m_StreamNumber; }
+    inline uint32_t getStreamSize() const { return m_StreamSize; }
+    inline uint32_t getStreamOffset() const { return m_StreamOffset; }
+
 protected:
     // =============================================================================
     // Protected Methods
@@ -110,12 +135,28 @@ protected:
     // Finds the first block matching a given saveNumber
     sSaveBlock* FindFirstBlock(uint32_t saveNumber);
 
+    // -----------------------------------------------------------------------------
+    // Writes the streaming block buffer, linked to a new free block unless Last
+    bool FlushStreamBlock(bool Last);
+
+    // -----------------------------------------------------------------------------
+    // Erases every block of a save number (chain not followed)
+    void EraseBlocks(uint32_t saveNumber);
+
     // =============================================================================
     // Member Variables
     // =============================================================================
 
     sSaveBlock* m_pTabSaveBlock;   // Persistent storage blocks array
     uint32_t    m_LastFreeIndex;   // Last index used for free block search (for round-robin allocation)
+
+    bool        m_StreamActive = false;         // Streaming save in progress
+    uint32_t    m_StreamNumber = 0;             // Save number of the stream
+    uint32_t    m_StreamSize = 0;               // Announced size
+    uint32_t    m_StreamOffset = 0;             // Bytes received
+    uint32_t    m_StreamFill = 0;               // Bytes in the block buffer
+    sSaveBlock* m_pStreamHead = nullptr;        // First block of the stream
+    sSaveBlock* m_pStreamBlock = nullptr;       // Block receiving the buffer
 };
 
 } // namespace DadPersistentStorage
@@ -9,6 +9,7 @@
 
 #include "cBlockStorageManager.h"
 #include "ID.h"
+#include "cBootProfiler.h"
 #include <cstring>
 #pragma GCC optimize ("O0")
 
@@ -44,6 +45,13 @@ constexpr uint32_t HEADER_MAGIC = 0xDADDBA55;
 // In flash memory, erased state is all bits set to 1
 constexpr uint32_t INVALID_MARKER = 0xFFFFFFFF;
 
+// Save number of the blocks of a streaming save not yet ended
+// (erased value: programmed to the real number without erase)
+constexpr uint32_t PENDING_NUMBER = NO_ID;
+
+// Block buffer of the streaming save
+static sSaveBlock __StreamBlock;
+
 // =============================================================================
 // Public Methods
 // =============================================================================
@@ -65,10 +73,10 @@ bool cBlockStorageManager::Init(uint32_t NumBuild) {
 
     // Load main block and verify integrity
     Load(kIDMain, &MainBlock, sizeof(MainBlock), ReadSize);
-    if ((ReadSize != sizeof(MainBlock)) || (MainBlock.MaGicBuild != kMaGicBuild) || (MainBlock.NumBuild != NumBuild)) {
-        return true;  // Initialization required
-    }
-    return false;     // Already initialized
+    bool Required = (ReadSize != sizeof(MainBlock)) || (MainBlock.MaGicBuild != kMaGicBuild) || (MainBlock.NumBuild != NumBuild);
+
+    __BootProfiler.Mark("Storage");
+    return Required;  // true: initialization required
 }
 
 // -----------------------------------------------------------------------------
@@ -82,6 +90,8 @@ void cBlockStorageManager::InitializeMemory(uint32_t NumBuild) {
     MainBlock.MaGicBuild = kMaGicBuild;
     MainBlock.NumBuild   = NumBuild;
     Save(kIDMain, &MainBlock, sizeof(MainBlock));
+
+    __BootProfiler.Mark("Format");
 }
 
 // -----------------------------------------------------------------------------
@@ -190,10 +200,159 @@ uint32_t cBlockStorageManager::getSize(uint32_t saveNumber) {
     return (pSaveBlock != nullptr) ? pSaveBlock->m_dataSize : 0;  // Return size or 0 if not found
 }
 
+// -----------------------------------------------------------------------------
+// Reads part of a save without loading the whole save
+uint32_t cBlockStorageManager::Read(uint32_t saveNumber, uint32_t Offset, void* pData, uint32_t Length) {
+    sSaveBlock* pSaveBlock = FindFirstBlock(saveNumber);
+    if ((pSaveBlock == nullptr) || (Offset >= pSaveBlock->m_dataSize)) {
+        return 0;
+    }
+    if (Length > (pSaveBlock->m_dataSize - Offset)) {
+        Length = pSaveBlock->m_dataSize - Offset;
+    }
+
+    // Skip the blocks before the offset
+    while ((Offset >= DATA_SIZE) && (pSaveBlock != nullptr)) {
+        Offset -= DATA_SIZE;
+        pSaveBlock = pSaveBlock->m_pNextBlock;
+    }
+
+    uint8_t* pBuffer = static_cast<uint8_t*>(pData);
+    uint32_t Read = 0;
+    while ((Read < Length) && (pSaveBlock != nullptr)) {
+        uint32_t blockDataSize = DATA_SIZE - Offset;
+        if (blockDataSize > (Length - Read)) blockDataSize = Length - Read;
+        memcpy(pBuffer + Read, &(pSaveBlock->m_Data[Offset]), blockDataSize);
+        Read += blockDataSize;
+        Offset = 0;
+        pSaveBlock = pSaveBlock->m_pNextBlock;
+    }
+    return Read;
+}
+
+// -----------------------------------------------------------------------------
+// Enumerates the saves (block found first by FindFirstBlock for each number)
+bool cBlockStorageManager::getNextSave(uint32_t& Index, uint32_t& saveNumber, uint32_t& Size) {
+    while (Index < NUM_BLOCKS) {
+        sSaveBlock* pBlock = &m_pTabSaveBlock[Index++];
+        if ((pBlock->m_isValid == HEADER_MAGIC) && (pBlock->m_saveNumber != PENDING_NUMBER) &&
+            (FindFirstBlock(pBlock->m_saveNumber) == pBlock)) {
+            saveNumber = pBlock->m_saveNumber;
+            Size = pBlock->m_dataSize;
+            return true;
+        }
+    }
+    return false;
+}
+
+// -----------------------------------------------------------------------------
+// Starts a streaming save of Size bytes
+bool cBlockStorageManager::BeginSave(uint32_t saveNumber, uint32_t Size) {
+    AbortSave();
+    EraseBlocks(PENDING_NUMBER);                    // Blocks of an interrupted stream
+
+    m_pStreamBlock = findFreeBlock(nullptr);
+    if ((m_pStreamBlock == nullptr) || (saveNumber == PENDING_NUMBER)) {
+        return false;
+    }
+    m_pStreamHead = m_pStreamBlock;
+    m_StreamNumber = saveNumber;
+    m_StreamSize = Size;
+    m_StreamOffset = 0;
+    m_StreamFill = 0;
+    m_StreamActive = true;
+
+    __StreamBlock.m_saveNumber = PENDING_NUMBER;
+    __StreamBlock.m_dataSize   = Size;
+    __StreamBlock.m_isValid    = HEADER_MAGIC;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Appends data to the streaming save (a full block is written to flash)
+bool cBlockStorageManager::WriteSave(const void* pData, uint32_t Length) {
+    if (!m_StreamActive || ((m_StreamOffset + Length) > m_StreamSize)) {
+        return false;
+    }
+
+    const uint8_t* pSource = static_cast<const uint8_t*>(pData);
+    while (Length > 0) {
+        // Block full and more data to come: write it
+        if (m_StreamFill == DATA_SIZE) {
+            if (!FlushStreamBlock(false)) {
+                AbortSave();
+                return false;                       // Not enough space
+            }
+        }
+        uint32_t blockDataSize = DATA_SIZE - m_StreamFill;
+        if (blockDataSize > Length) blockDataSize = Length;
+        memcpy(&__StreamBlock.m_Data[m_StreamFill], pSource, blockDataSize);
+        m_StreamFill += blockDataSize;
+        m_StreamOffset += blockDataSize;
+        pSource += blockDataSize;
+        Length -= blockDataSize;
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Ends the streaming save: writes the last block then names the chain
+bool cBlockStorageManager::EndSave() {
+    if (!m_StreamActive) return false;
+    if ((m_StreamOffset != m_StreamSize) || !FlushStreamBlock(true)) {
+        AbortSave();
+        return false;
+    }
+    m_StreamActive = false;
+
+    // Replace the previous save: pending number programmed to the real one
+    // (bits only cleared, no erase)
+    Delete(m_StreamNumber);
+    uint32_t saveNumber = m_StreamNumber;
+    for (sSaveBlock* pBlock = m_pStreamHead; pBlock != nullptr; pBlock = pBlock->m_pNextBlock) {
+        __Flash.Write(reinterpret_cast<uint8_t*>(&saveNumber), reinterpret_cast<uint32_t>(&pBlock->m_saveNumber), sizeof(saveNumber));
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Drops the streaming save in progress
+void cBlockStorageManager::AbortSave() {
+    if (m_StreamActive) {
+        m_StreamActive = false;
+        EraseBlocks(PENDING_NUMBER);
+    }
+}
+
 // =============================================================================
 // Private Methods
 // =============================================================================
 
+// -----------------------------------------------------------------------------
+// Writes the streaming block buffer, linked to a new free block unless Last
+bool cBlockStorageManager::FlushStreamBlock(bool Last) {
+    sSaveBlock* pNextBlock = nullptr;
+    if (!Last) {
+        pNextBlock = findFreeBlock(m_pStreamBlock);
+        if (pNextBlock == nullptr) return false;
+    }
+    __StreamBlock.m_pNextBlock = pNextBlock;
+    __Flash.Write(reinterpret_cast<uint8_t*>(&__StreamBlock), reinterpret_cast<uint32_t>(m_pStreamBlock), BLOCK_SIZE);
+    m_pStreamBlock = pNextBlock;
+    m_StreamFill = 0;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Erases every block of a save number (chain not followed)
+void cBlockStorageManager::EraseBlocks(uint32_t saveNumber) {
+    sSaveBlock* pSaveBlock;
+    while ((pSaveBlock = FindFirstBlock(saveNumber)) != nullptr) {
+        __Flash.EraseBlock4K(reinterpret_cast<uint32_t>(pSaveBlock));
+        HAL_Delay(10);  // Ensure erase completion
+    }
+}
+
 // -----------------------------------------------------------------------------
 // Finds a free block in the storage area with round-robin allocation
 sSaveBlock* cBlockStorageManager::findFreeBlock(sSaveBlock* blockExcl) {
@@ -205,8 +364,8 @@ sSaveBlock* cBlockStorageManager::findFreeBlock(sSaveBlock* blockExcl) {
         uint32_t currentIndex = (index + i) % totalBlocks;
         sSaveBlock* pBlock = &m_pTabSaveBlock[currentIndex];
 
-        // Skip excluded block
-        if (pBlock == blockExcl)
+        // Skip excluded block and the block reserved by a streaming save
+        if ((pBlock == blockExcl) || (m_StreamActive && (pBlock == m_pStreamBlock)))
             continue;
 
         // Check if block is free (erased state)
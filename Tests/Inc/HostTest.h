@@ -0,0 +1,49 @@
+//==================================================================================
+//==================================================================================
+// File: HostTest.h
+// Description: Minimal check macros for the host tests (one executable per
+//              test, exit code 0 when every check passed)
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cmath>
+
+namespace DadTest {
+
+// Number of failed checks of the test
+extern int __Failures;
+
+// Error_Handler calls since the last takeErrors (the firmware would halt)
+uint32_t takeErrors();
+
+// -----------------------------------------------------------------------------
+// Report a failed check
+// -----------------------------------------------------------------------------
+inline bool Check(bool Condition, const char* pText, const char* pFile, int Line) {
+    if (!Condition) {
+        std::printf("%s:%d: check failed: %s\n", pFile, Line, pText);
+        __Failures++;
+    }
+    return Condition;
+}
+
+// -----------------------------------------------------------------------------
+// Test result (main return value)
+// -----------------------------------------------------------------------------
+inline int Result(const char* pName) {
+    std::printf("%s: %s (%d failed checks)\n", pName, (__Failures == 0) ? "passed" : "FAILED", __Failures);
+    return (__Failures == 0) ? 0 : 1;
+}
+
+} // namespace DadTest
+
+#define CHECK(Cond)             DadTest::Check((Cond), #Cond, __FILE__, __LINE__)
+#define CHECK_NEAR(A, B, Tol)   DadTest::Check(std::fabs((A) - (B)) <= (Tol), #A " ~ " #B, __FILE__, __LINE__)
+
+//***End of file**************************************************************
@@ -0,0 +1,54 @@
+//==================================================================================
+//==================================================================================
+// File: main.h
+// Description: Host stand-in for the CubeMX main.h: the few HAL / CMSIS
+//              declarations the tested headers use, nothing else
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+// -----------------------------------------------------------------------------
+// HAL
+// -----------------------------------------------------------------------------
+typedef enum {
+    HAL_OK       = 0x00U,
+    HAL_ERROR    = 0x01U,
+    HAL_BUSY     = 0x02U,
+    HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+struct SAI_HandleTypeDef  { uint32_t Instance; };
+struct UART_HandleTypeDef { uint32_t Instance; };
+struct QSPI_HandleTypeDef { uint32_t Instance; };
+
+extern "C" uint32_t HAL_GetTick(void);
+extern "C" void Error_Handler(void);
+
+// -----------------------------------------------------------------------------
+// CMSIS core (single thread on the host: barriers and masks are no-ops)
+// -----------------------------------------------------------------------------
+struct DWT_Type {
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+};
+extern DWT_Type __HostDWT;
+#define DWT (&__HostDWT)
+
+extern uint32_t SystemCoreClock;
+
+inline uint32_t __get_PRIMASK() { return 0; }
+inline void __set_PRIMASK(uint32_t) {}
+inline void __disable_irq() {}
+inline void __enable_irq() {}
+inline void __DMB() {}
+inline void __DSB() {}
+inline void __ISB() {}
+
+//***End of file**************************************************************
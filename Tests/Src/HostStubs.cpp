@@ -0,0 +1,43 @@
+//==================================================================================
+//==================================================================================
+// File: HostStubs.cpp
+// Description: Host definitions of the HAL / CMSIS symbols declared by the
+//              stand-in main.h
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "main.h"
+#include "HostTest.h"
+
+DWT_Type __HostDWT = {};
+uint32_t SystemCoreClock = 480000000;
+
+namespace DadTest {
+int __Failures = 0;
+static uint32_t __Errors = 0;
+
+uint32_t takeErrors() {
+    uint32_t Errors = __Errors;
+    __Errors = 0;
+    return Errors;
+}
+} // namespace DadTest
+
+// -----------------------------------------------------------------------------
+// The firmware halts here: the host counts the calls for takeErrors
+// -----------------------------------------------------------------------------
+extern "C" void Error_Handler(void) {
+    DadTest::__Errors++;
+}
+
+// -----------------------------------------------------------------------------
+// Tick: a millisecond per call is enough for the tested time outs
+// -----------------------------------------------------------------------------
+extern "C" uint32_t HAL_GetTick(void) {
+    static uint32_t Tick = 0;
+    return Tick++;
+}
+
+//***End of file**************************************************************
@@ -0,0 +1,30 @@
+//==================================================================================
+//==================================================================================
+// File: MidiStub.cpp
+// Description: Host stand-in of the __Midi instance used by cParameter: the
+//              registrations are accepted and never called back (the tests
+//              drive the parameters directly)
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "cMidi.h"
+
+DadDrivers::cMidi __Midi;
+
+namespace DadDrivers {
+
+void cMidi::on_GUI_FastUpdate() {}
+void cMidi::on_GUI_RT_ProcessInBlock(const AudioBuffer*, uint32_t) {}
+
+bool cMidi::addControlChangeCallback(uint8_t, uint32_t, ControlChangeCallback, uint8_t) { return true; }
+void cMidi::removeControlChangeCallback(uint8_t, uint32_t, ControlChangeCallback, uint8_t) {}
+bool cMidi::addRTControlChangeCallback(uint8_t, uint32_t, RTControlChangeCallback, uint8_t) { return true; }
+void cMidi::removeRTControlChangeCallback(uint8_t, uint32_t, RTControlChangeCallback, uint8_t) {}
+bool cMidi::addHighResCallback(eMidiHighRes, uint16_t, uint32_t, HighResControlCallback, uint8_t) { return true; }
+bool cMidi::addRTHighResCallback(eMidiHighRes, uint16_t, uint32_t, RTHighResControlCallback, uint8_t) { return true; }
+
+} // namespace DadDrivers
+
+//***End of file**************************************************************
@@ -0,0 +1,134 @@
+//==================================================================================
+//==================================================================================
+// File: TestConvolver.cpp
+// Description: Host test of the partitioned convolver (portable FFT): output
+//              against a direct convolution, and host time per audio block
+//              against IR length
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "HostTest.h"
+#include "HardwareDefines.h"
+#include "cConvolver.h"
+#include <chrono>
+#include <vector>
+
+using namespace DadDSP;
+
+constexpr uint32_t PART      = 128;
+constexpr uint32_t MAX_IR    = 16384;
+constexpr uint32_t MAX_PARTS = MAX_IR / PART;
+using cTestConvolver = cConvolver<PART>;
+
+static std::vector<float> __IRSpectra(cTestConvolver::getBufferSize(MAX_PARTS));
+static std::vector<float> __FDL(cTestConvolver::getBufferSize(MAX_PARTS));
+static cTestConvolver     __Convolver;
+
+// -----------------------------------------------------------------------------
+// Decaying noise (IR) or white noise (signal), LCG
+// -----------------------------------------------------------------------------
+static void Noise(std::vector<float>& Buffer, uint32_t Seed, bool Decay) {
+    for (uint32_t i = 0; i < Buffer.size(); i++) {
+        Seed = Seed * 1664525UL + 1013904223UL;
+        float Value = static_cast<float>(static_cast<int32_t>(Seed)) * (1.0f / 2147483648.0f);
+        float Envelope = Decay ? (1.0f - static_cast<float>(i) / Buffer.size()) : 1.0f;
+        Buffer[i] = Value * Envelope * Envelope;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Same output as the direct convolution, delayed by getLatency()
+// -----------------------------------------------------------------------------
+static void TestAgainstDirect(uint32_t Length) {
+    std::vector<float> IR(Length);
+    Noise(IR, 12345 + Length, true);
+    __Convolver.LoadIR(IR.data(), Length);
+    CHECK(__Convolver.getNbPartitions() == (Length + PART - 1) / PART);
+
+    const uint32_t Latency = __Convolver.getLatency();
+    const uint32_t Samples = ((Length + 4 * PART) / AUDIO_BUFFER_SIZE) * AUDIO_BUFFER_SIZE;
+    std::vector<float> In(Samples);
+    Noise(In, 777, false);
+
+    std::vector<float> Out(Samples);
+    for (uint32_t n = 0; n < Samples; n += AUDIO_BUFFER_SIZE) {
+        __Convolver.ProcessBlock(&In[n], &Out[n], AUDIO_BUFFER_SIZE);
+    }
+
+    double MaxError = 0.0;
+    double MaxRef = 0.0;
+    for (uint32_t n = Latency; n < Samples; n++) {
+        double Ref = 0.0;
+        uint32_t Time = n - Latency;
+        for (uint32_t k = 0; (k < Length) && (k <= Time); k++) {
+            Ref += static_cast<double>(IR[k]) * In[Time - k];
+        }
+        MaxError = std::fmax(MaxError, std::fabs(Ref - Out[n]));
+        MaxRef = std::fmax(MaxRef, std::fabs(Ref));
+    }
+    for (uint32_t n = 0; n < Latency; n++) {
+        MaxError = std::fmax(MaxError, std::fabs(Out[n]));
+    }
+    std::printf("IR %5u: max error %.1e (peak %.3g)\n", Length, MaxError, MaxRef);
+    CHECK(MaxError < 1.0e-4 * MaxRef);
+}
+
+// -----------------------------------------------------------------------------
+// Unloaded: silence; reloaded: the previous input is forgotten
+// -----------------------------------------------------------------------------
+static void TestUnload() {
+    std::vector<float> IR(300);
+    Noise(IR, 1, true);
+    __Convolver.LoadIR(IR.data(), 300);
+    float Block[AUDIO_BUFFER_SIZE];
+    for (uint32_t b = 0; b < 100; b++) {
+        for (uint32_t i = 0; i < AUDIO_BUFFER_SIZE; i++) Block[i] = 1.0f;
+        __Convolver.ProcessBlock(Block, Block, AUDIO_BUFFER_SIZE);
+    }
+    __Convolver.UnloadIR();
+    CHECK(__Convolver.getNbPartitions() == 0);
+    float Max = 0.0f;
+    for (uint32_t b = 0; b < 100; b++) {
+        for (uint32_t i = 0; i < AUDIO_BUFFER_SIZE; i++) Block[i] = 1.0f;
+        __Convolver.ProcessBlock(Block, Block, AUDIO_BUFFER_SIZE);
+        for (uint32_t i = 0; i < AUDIO_BUFFER_SIZE; i++) Max = std::fmax(Max, std::fabs(Block[i]));
+    }
+    CHECK(Max == 0.0f);
+}
+
+// -----------------------------------------------------------------------------
+// Host time per audio block against IR length (information, not checked: the
+// target cycles come from the SysEx BENCH command)
+// -----------------------------------------------------------------------------
+static void HostTiming() {
+    constexpr uint32_t Blocks = 8192;
+    std::vector<float> IR(MAX_IR);
+    Noise(IR, 4242, true);
+    float Block[AUDIO_BUFFER_SIZE] = {};
+    for (uint32_t Length : { 1024u, 4096u, 16384u }) {
+        __Convolver.LoadIR(IR.data(), Length);
+        double Worst = 0.0;
+        auto Start = std::chrono::steady_clock::now();
+        for (uint32_t b = 0; b < Blocks; b++) {
+            auto BlockStart = std::chrono::steady_clock::now();
+            __Convolver.ProcessBlock(Block, Block, AUDIO_BUFFER_SIZE);
+            Worst = std::fmax(Worst, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - BlockStart).count());
+        }
+        double Average = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - Start).count() / Blocks;
+        std::printf("host IR %5u: %8.0f ns/block average, %8.0f ns worst\n", Length, Average, Worst);
+    }
+}
+
+int main() {
+    __Convolver.Initialize(__IRSpectra.data(), __FDL.data(), MAX_PARTS);
+    for (uint32_t Length : { 1u, 100u, 128u, 129u, 1000u, 4096u }) {
+        TestAgainstDirect(Length);
+    }
+    TestUnload();
+    HostTiming();
+    return DadTest::Result("TestConvolver");
+}
+
+//***End of file**************************************************************
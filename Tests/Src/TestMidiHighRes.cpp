@@ -0,0 +1,135 @@
+//==================================================================================
+//==================================================================================
+// File: TestMidiHighRes.cpp
+// Description: Host test of the 14-bit MIDI assembly: CC pairs, NRPN / RPN
+//              data entry and the 32-bit upscaling
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "HostTest.h"
+#include "cMidi.h"
+
+using namespace DadDrivers;
+
+//**********************************************************************************
+// Parser fed one Control Change at a time, last complete value kept
+//**********************************************************************************
+struct sFeeder {
+    cMidiHighResParser  Parser;
+    eMidiHighRes        Kind = eMidiHighRes::CC14;
+    uint16_t            Number = 0;
+    uint32_t            Value32 = 0;
+
+    sFeeder() { Parser.Reset(); }
+
+    bool Feed(uint8_t Control, uint8_t Value, uint8_t Channel = 0) {
+        return Parser.Parse(Channel, Control, Value, Kind, Number, Value32);
+    }
+};
+
+// -----------------------------------------------------------------------------
+// 0 -> 0, max -> 0xFFFFFFFF, lower half and center are a plain shift,
+// monotonic over the 14-bit range
+// -----------------------------------------------------------------------------
+static void TestUpscale() {
+    CHECK(cMidiHighResParser::Upscale(0, 7) == 0);
+    CHECK(cMidiHighResParser::Upscale(127, 7) == 0xFFFFFFFF);
+    CHECK(cMidiHighResParser::Upscale(64, 7) == 0x80000000);
+    CHECK(cMidiHighResParser::Upscale(32, 7) == (32UL << 25));
+    CHECK(cMidiHighResParser::Upscale(0, 14) == 0);
+    CHECK(cMidiHighResParser::Upscale(0x3FFF, 14) == 0xFFFFFFFF);
+    CHECK(cMidiHighResParser::Upscale(0x2000, 14) == 0x80000000);
+    CHECK(cMidiHighResParser::Upscale(0x1234, 14) == (0x1234UL << 18));
+
+    uint32_t Previous = 0;
+    bool Monotonic = true;
+    for (uint32_t Value = 1; Value <= 0x3FFF; Value++) {
+        uint32_t Scaled = cMidiHighResParser::Upscale(Value, 14);
+        if (Scaled <= Previous) Monotonic = false;
+        Previous = Scaled;
+    }
+    CHECK(Monotonic);
+
+    // A 7-bit value and its 14-bit MSB-only value agree in the lower half
+    CHECK(cMidiHighResParser::Upscale(40, 7) == cMidiHighResParser::Upscale(40 << 7, 14));
+}
+
+// -----------------------------------------------------------------------------
+// CC pairs: opt-in through the pair mask, MSB alone until the LSB is seen,
+// then complete on the LSB only
+// -----------------------------------------------------------------------------
+static void TestCC14() {
+    sFeeder F;
+
+    // Not paired: the MSB is a 7-bit value, the LSB controller is ignored
+    CHECK(F.Feed(7, 100));
+    CHECK((F.Kind == eMidiHighRes::CC14) && (F.Number == 7));
+    CHECK(F.Value32 == cMidiHighResParser::Upscale(100, 7));
+    CHECK(!F.Feed(39, 5));
+
+    F.Parser.setPairs(1UL << 7);
+    CHECK(F.Parser.getPairs() == (1UL << 7));
+    CHECK(F.Feed(7, 64));                       // LSB not seen yet: 7-bit
+    CHECK(F.Value32 == 0x80000000);
+    CHECK(F.Feed(39, 1));                       // First LSB completes the pair
+    CHECK((F.Number == 7) && (F.Value32 == cMidiHighResParser::Upscale((64 << 7) | 1, 14)));
+
+    // From now on: no MSB-only intermediate value
+    CHECK(!F.Feed(7, 10));
+    CHECK(F.Feed(39, 20));
+    CHECK(F.Value32 == cMidiHighResParser::Upscale((10 << 7) | 20, 14));
+
+    // Per channel state
+    CHECK(F.Feed(7, 10, 3));
+    CHECK(F.Value32 == cMidiHighResParser::Upscale(10, 7));
+
+    // Controllers above 63 are not high resolution
+    CHECK(!F.Feed(74, 10));
+
+    F.Parser.Reset();
+    CHECK(F.Feed(7, 10));                       // LSB detection forgotten
+}
+
+// -----------------------------------------------------------------------------
+// NRPN / RPN data entry, null parameter
+// -----------------------------------------------------------------------------
+static void TestDataEntry() {
+    sFeeder F;
+
+    CHECK(!F.Feed(6, 10));                      // No parameter selected
+
+    CHECK(!F.Feed(99, 1));
+    CHECK(!F.Feed(98, 2));
+    CHECK(F.Feed(6, 64));                       // MSB alone until an LSB is seen
+    CHECK((F.Kind == eMidiHighRes::NRPN) && (F.Number == ((1 << 7) | 2)));
+    CHECK(F.Value32 == 0x80000000);
+    CHECK(F.Feed(38, 3));
+    CHECK(F.Value32 == cMidiHighResParser::Upscale((64 << 7) | 3, 14));
+    CHECK(!F.Feed(6, 65));
+    CHECK(F.Feed(38, 0));
+    CHECK(F.Value32 == cMidiHighResParser::Upscale(65 << 7, 14));
+
+    // RPN selection restarts the parameter number
+    CHECK(!F.Feed(100, 5));
+    CHECK(!F.Feed(6, 1));
+    CHECK(F.Feed(38, 127));
+    CHECK((F.Kind == eMidiHighRes::RPN) && (F.Number == 5));
+    CHECK(F.Value32 == cMidiHighResParser::Upscale((1 << 7) | 127, 14));
+
+    // Null parameter: data entry ignored
+    CHECK(!F.Feed(101, 0x7F));
+    CHECK(!F.Feed(100, 0x7F));
+    CHECK(!F.Feed(6, 10));
+    CHECK(!F.Feed(38, 10));
+}
+
+int main() {
+    TestUpscale();
+    TestCC14();
+    TestDataEntry();
+    return DadTest::Result("TestMidiHighRes");
+}
+
+//***End of file**************************************************************
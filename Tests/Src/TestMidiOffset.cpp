@@ -0,0 +1,90 @@
+//==================================================================================
+//==================================================================================
+// File: TestMidiOffset.cpp
+// Description: Host test of the sample accurate MIDI application: time
+//              stamped messages replayed over jittered audio blocks through
+//              cMidi::getSampleOffset and cParameter::setValueAt
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "HostTest.h"
+#include "HardwareDefines.h"
+#include "cMidi.h"
+#include "cParameter.h"
+
+using namespace DadDrivers;
+
+constexpr uint32_t OFFSET_BLOCKS = 4096;            // Simulated audio blocks
+constexpr uint32_t OFFSET_JITTER = 8;               // Block start jitter: 1/8 of the period
+
+// -----------------------------------------------------------------------------
+// Offsets inside the previous block period, clamped outside
+// -----------------------------------------------------------------------------
+static void TestSampleOffset() {
+    CHECK(cMidi::getSampleOffset(1000, 1000, 400, 4) == 0);        // At the block start
+    CHECK(cMidi::getSampleOffset(900, 1000, 400, 4) == 0);         // Before: first sample
+    CHECK(cMidi::getSampleOffset(1100, 1000, 400, 4) == 1);
+    CHECK(cMidi::getSampleOffset(1399, 1000, 400, 4) == 3);
+    CHECK(cMidi::getSampleOffset(5000, 1000, 400, 4) == 3);        // Late: last sample
+    CHECK(cMidi::getSampleOffset(1200, 1000, 0, 4) == 0);          // No block period yet
+    CHECK(cMidi::getSampleOffset(0x00000010, 0xFFFFFF10, 0x200, 4) == 2); // Cycle counter wrap
+}
+
+// -----------------------------------------------------------------------------
+// One message at a random time per block period. The block starts (audio
+// interrupt entries) are jittered, the sample clock is not. Each message goes
+// through getSampleOffset and setValueAt at the start of the next block, then
+// Process runs once per sample as under RT_Process. The value alternates, so
+// the sample where it changes is where the message was applied. Ideal: the
+// sample of the message time, one block later.
+// -----------------------------------------------------------------------------
+static void TestReplay() {
+    DadDSP::cParameter Parameter;
+    Parameter.Init(0.0f, 0.0f, 1.0f, 0.1f, 0.01f);  // Slope 0: jumps to the target
+
+    const double SampleCycles = static_cast<double>(SystemCoreClock) / SAMPLING_RATE;
+    const uint32_t Period = static_cast<uint32_t>(SampleCycles * AUDIO_BUFFER_SIZE);
+    uint32_t Seed = 12345;
+    uint32_t BlockStart = 0;                        // Start of the previous block period
+    uint32_t ErrorSum = 0;
+    uint32_t MaxError = 0;
+
+    for (uint32_t Block = 1; Block <= OFFSET_BLOCKS; Block++) {
+        Seed = Seed * 1664525UL + 1013904223UL;
+        uint32_t Now = Block * Period + (Seed >> 8) % (Period / OFFSET_JITTER);
+        Seed = Seed * 1664525UL + 1013904223UL;
+        uint32_t TimeStamp = BlockStart + (Seed >> 8) % (Now - BlockStart);
+
+        float Value = (Block & 1) ? 1.0f : 0.0f;
+        Parameter.setValueAt(Value, cMidi::getSampleOffset(TimeStamp, BlockStart, Now - BlockStart, AUDIO_BUFFER_SIZE));
+        uint32_t Applied = AUDIO_BUFFER_SIZE;
+        for (uint32_t Sample = 0; Sample < AUDIO_BUFFER_SIZE; Sample++) {
+            Parameter.Process();
+            if ((Applied == AUDIO_BUFFER_SIZE) && (Parameter.getValue() == Value)) Applied = Sample;
+        }
+        BlockStart = Now;
+        CHECK(Applied < AUDIO_BUFFER_SIZE);
+
+        uint32_t Ideal = static_cast<uint32_t>(TimeStamp / SampleCycles) + AUDIO_BUFFER_SIZE;
+        uint32_t Actual = Block * AUDIO_BUFFER_SIZE + Applied;
+        uint32_t Error = (Actual > Ideal) ? (Actual - Ideal) : (Ideal - Actual);
+        if (Error > MaxError) MaxError = Error;
+        ErrorSum += Error;
+    }
+
+    // The jitter of the block start moves a message by one sample at most
+    float MeanError = static_cast<float>(ErrorSum) / OFFSET_BLOCKS;
+    std::printf("offset error: max %u, mean %.3f samples\n", MaxError, MeanError);
+    CHECK(MaxError <= 1);
+    CHECK(MeanError < 0.5f);
+}
+
+int main() {
+    TestSampleOffset();
+    TestReplay();
+    return DadTest::Result("TestMidiOffset");
+}
+
+//***End of file**************************************************************
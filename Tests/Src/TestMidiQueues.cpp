@@ -0,0 +1,279 @@
+//==================================================================================
+//==================================================================================
+// File: TestMidiQueues.cpp
+// Description: Host test of the MIDI queues (MPSC ingest, SPSC main loop) and
+//              of the running status byte parser
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "HostTest.h"
+#include "HardwareDefines.h"
+#include "cMidi.h"
+#include <atomic>
+#include <thread>
+
+using namespace DadDrivers;
+
+//**********************************************************************************
+// Ingest queue: burst replay at full DIN and USB rates
+//**********************************************************************************
+
+constexpr uint32_t MIDI_BURST_TIME_US  = 100000;                       // Simulated time per phase
+constexpr uint32_t MIDI_BURST_DIN_US   = 2 * 1000000 / MIDI_UART_BYTE_RATE; // Running status CC: 2 bytes
+constexpr uint32_t MIDI_BURST_USB_US   = 1000;                         // One full packet per USB frame
+constexpr uint32_t MIDI_BURST_USB_SIZE = 16;                           // Events per packet (64 bytes)
+
+struct sBurstResult {
+    uint32_t Sent = 0;
+    uint32_t Received = 0;
+    uint32_t OrderErrors = 0;
+};
+
+// -----------------------------------------------------------------------------
+// Producers at full rate, consumer every DrainPeriod us. The per source
+// sequence number travels in the time stamp.
+// -----------------------------------------------------------------------------
+static sBurstResult BurstPhase(cMidiIngestQueue& Queue, uint32_t DrainPeriod) {
+    sBurstResult Result;
+    uint32_t Sent[MIDI_NB_SOURCES] = {0, 0};
+    uint32_t Expected[MIDI_NB_SOURCES] = {0, 0};
+    stMidiEvent_t Event = {0, 0xB0, 1, 0, MIDI_SOURCE_UART};
+
+    Queue.Clear();
+    for (uint32_t Time = 0; Time < MIDI_BURST_TIME_US; Time++) {
+        if ((Time % MIDI_BURST_DIN_US) == 0) {
+            Event.source = MIDI_SOURCE_UART;
+            Event.timeStamp = Sent[MIDI_SOURCE_UART]++;
+            Queue.Push(Event);
+        }
+        if ((Time % MIDI_BURST_USB_US) == 0) {
+            Event.source = MIDI_SOURCE_USB;
+            for (uint32_t n = 0; n < MIDI_BURST_USB_SIZE; n++) {
+                Event.timeStamp = Sent[MIDI_SOURCE_USB]++;
+                Queue.Push(Event);
+            }
+        }
+
+        if ((Time % DrainPeriod) == 0) {
+            const stMidiEvent_t* pEvent;
+            while ((pEvent = Queue.Peek()) != nullptr) {
+                if (pEvent->timeStamp != Expected[pEvent->source]) Result.OrderErrors++;
+                Expected[pEvent->source] = pEvent->timeStamp + 1;
+                Queue.Pop();
+                Result.Received++;
+            }
+        }
+    }
+    Result.Sent = Sent[MIDI_SOURCE_UART] + Sent[MIDI_SOURCE_USB];
+    return Result;
+}
+
+// -----------------------------------------------------------------------------
+// Drained every audio block, then every GUI_FAST_UPDATE_MS (audio stopped):
+// nothing lost, nothing reordered, the stalled fill within the sizing
+// -----------------------------------------------------------------------------
+static void TestIngestBurst() {
+    static cMidiIngestQueue Queue;
+
+    constexpr uint32_t BlockUs = static_cast<uint32_t>((AUDIO_BUFFER_SIZE * 1000000.0f) / SAMPLING_RATE);
+    sBurstResult Audio = BurstPhase(Queue, (BlockUs > 0) ? BlockUs : 1);
+    uint32_t HighWaterAudio = Queue.getHighWater();
+    CHECK(Queue.getOverflows() == 0);
+    CHECK(Audio.OrderErrors == 0);
+    CHECK(Audio.Received + MIDI_BURST_USB_SIZE + 1 >= Audio.Sent);   // Last packet may wait
+    CHECK(HighWaterAudio <= MIDI_BURST_USB_SIZE + 1);
+
+    sBurstResult Stalled = BurstPhase(Queue, GUI_FAST_UPDATE_MS * 1000);
+    uint32_t HighWaterStalled = Queue.getHighWater();
+    CHECK(Queue.getOverflows() == 0);
+    CHECK(Stalled.OrderErrors == 0);
+    CHECK(HighWaterStalled < MIDI_INGEST_QUEUE_SIZE);
+    CHECK(HighWaterStalled >= GUI_FAST_UPDATE_MS * MIDI_BURST_USB_SIZE);
+
+    std::printf("ingest high water: %u audio, %u stalled (size %u)\n",
+                HighWaterAudio, HighWaterStalled, MIDI_INGEST_QUEUE_SIZE);
+}
+
+// -----------------------------------------------------------------------------
+// Full queue: overflows counted per source, queued events intact
+// -----------------------------------------------------------------------------
+static void TestIngestOverflow() {
+    static cMidiIngestQueue Queue;
+    stMidiEvent_t Event = {0, 0x90, 60, 100, MIDI_SOURCE_USB};
+    for (uint32_t i = 0; i < MIDI_INGEST_QUEUE_SIZE; i++) {
+        Event.timeStamp = i;
+        CHECK(Queue.Push(Event));
+    }
+    CHECK(!Queue.Push(Event));
+    Event.source = MIDI_SOURCE_UART;
+    CHECK(!Queue.Push(Event));
+    CHECK(Queue.getOverflows(MIDI_SOURCE_USB) == 1);
+    CHECK(Queue.getOverflows(MIDI_SOURCE_UART) == 1);
+    CHECK(Queue.getOverflows() == 2);
+    CHECK(Queue.getPushed(MIDI_SOURCE_USB) == MIDI_INGEST_QUEUE_SIZE);
+
+    // One cell released: one more event fits, after the others
+    CHECK(Queue.Peek()->timeStamp == 0);
+    Queue.Pop();
+    Event.timeStamp = 1000;
+    CHECK(Queue.Push(Event));
+    uint32_t Count = 0;
+    uint32_t Last = 0;
+    const stMidiEvent_t* pEvent;
+    while ((pEvent = Queue.Peek()) != nullptr) {
+        Last = pEvent->timeStamp;
+        Queue.Pop();
+        Count++;
+    }
+    CHECK((Count == MIDI_INGEST_QUEUE_SIZE) && (Last == 1000));
+    CHECK(Queue.getHighWater() == MIDI_INGEST_QUEUE_SIZE);
+
+    Queue.Clear();
+    CHECK((Queue.Peek() == nullptr) && (Queue.getOverflows() == 0) && (Queue.getHighWater() == 0));
+}
+
+// -----------------------------------------------------------------------------
+// Two producer threads against one consumer thread: every event is either
+// received, in order per source, or counted as an overflow
+// -----------------------------------------------------------------------------
+static void TestIngestThreads() {
+    static cMidiIngestQueue Queue;
+    constexpr uint32_t NbEvents = 200000;
+    std::atomic<uint32_t> Running(MIDI_NB_SOURCES);
+
+    auto Producer = [&](uint8_t Source) {
+        stMidiEvent_t Event = {0, 0xB0, 1, 0, Source};
+        for (uint32_t i = 0; i < NbEvents; i++) {
+            Event.timeStamp = i;
+            Queue.Push(Event);
+        }
+        Running--;
+    };
+
+    uint32_t Received[MIDI_NB_SOURCES] = {0, 0};
+    uint32_t OrderErrors = 0;
+    std::thread Uart(Producer, MIDI_SOURCE_UART);
+    std::thread Usb(Producer, MIDI_SOURCE_USB);
+    uint32_t Expected[MIDI_NB_SOURCES] = {0, 0};
+    for (;;) {
+        bool Done = (Running.load() == 0);
+        const stMidiEvent_t* pEvent;
+        while ((pEvent = Queue.Peek()) != nullptr) {
+            if (pEvent->timeStamp < Expected[pEvent->source]) OrderErrors++;
+            Expected[pEvent->source] = pEvent->timeStamp + 1;
+            Received[pEvent->source]++;
+            Queue.Pop();
+        }
+        if (Done) break;
+    }
+    Uart.join();
+    Usb.join();
+
+    CHECK(OrderErrors == 0);
+    for (uint32_t Source = 0; Source < MIDI_NB_SOURCES; Source++) {
+        eMidiSource Id = static_cast<eMidiSource>(Source);
+        CHECK(Received[Source] == Queue.getPushed(Id));
+        CHECK(Received[Source] + Queue.getOverflows(Id) == NbEvents);
+    }
+}
+
+//**********************************************************************************
+// Main loop queue
+//**********************************************************************************
+
+// -----------------------------------------------------------------------------
+// Order, overflow count, wrap of the counters
+// -----------------------------------------------------------------------------
+static void TestEventQueue() {
+    static cMidiEventQueue Queue;
+    stMidiEvent_t Event = {0, 0xB0, 7, 0, MIDI_SOURCE_UART};
+    stMidiEvent_t Out;
+    CHECK(!Queue.Pull(&Out));
+
+    for (uint32_t i = 0; i <= MIDI_EVENT_QUEUE_SIZE; i++) {
+        Event.timeStamp = i;
+        Queue.Push(Event);
+    }
+    CHECK(Queue.getOverflows() == 1);
+
+    bool InOrder = true;
+    for (uint32_t i = 0; i < MIDI_EVENT_QUEUE_SIZE; i++) {
+        InOrder = InOrder && Queue.Pull(&Out) && (Out.timeStamp == i);
+    }
+    CHECK(InOrder);
+    CHECK(!Queue.Pull(&Out));
+
+    // Several wraps, producer one event ahead
+    uint32_t Next = 0;
+    for (uint32_t i = 0; i < 3 * MIDI_EVENT_QUEUE_SIZE; i++) {
+        Event.timeStamp = i;
+        CHECK(Queue.Push(Event));
+        if (i > 0) {
+            const stMidiEvent_t* pEvent = Queue.Peek();
+            InOrder = InOrder && (pEvent != nullptr) && (pEvent->timeStamp == Next++);
+            Queue.Pop();
+        }
+    }
+    CHECK(InOrder);
+    CHECK(Queue.getOverflows() == 1);
+}
+
+//**********************************************************************************
+// Running status byte parser
+//**********************************************************************************
+
+// -----------------------------------------------------------------------------
+// Feeds Bytes (time stamp = byte index), returns the completed messages
+// -----------------------------------------------------------------------------
+static uint32_t ParseBytes(cMidiParser& Parser, const uint8_t* pBytes, uint32_t Count,
+                           stMidiEvent_t* pEvents) {
+    uint32_t NbEvents = 0;
+    for (uint32_t i = 0; i < Count; i++) {
+        if (Parser.Parse(pBytes[i], i, pEvents[NbEvents])) NbEvents++;
+    }
+    return NbEvents;
+}
+
+static void TestRunningStatus() {
+    cMidiParser Parser;
+    stMidiEvent_t Events[8];
+
+    // Note on, then two notes in running status, then a program change
+    const uint8_t Stream[] = { 0x90, 60, 100, 62, 90, 64, 80, 0xC1, 5, 6 };
+    uint32_t NbEvents = ParseBytes(Parser, Stream, sizeof(Stream), Events);
+    CHECK(NbEvents == 5);
+    CHECK((Events[0].status == 0x90) && (Events[0].data1 == 60) && (Events[0].data2 == 100));
+    CHECK(Events[0].timeStamp == 0);                    // Starts with its status byte
+    CHECK((Events[1].status == 0x90) && (Events[1].data1 == 62) && (Events[1].data2 == 90));
+    CHECK(Events[1].timeStamp == 3);                    // Starts with its first data byte
+    CHECK((Events[2].data1 == 64) && (Events[2].timeStamp == 5));
+    CHECK((Events[3].status == 0xC1) && (Events[3].data1 == 5) && (Events[3].data2 == 0));
+    CHECK((Events[4].status == 0xC1) && (Events[4].data1 == 6) && (Events[4].timeStamp == 9));
+
+    // System common and SysEx cancel the running status
+    Parser.Reset();
+    const uint8_t Cancel[] = { 0xB0, 7, 100, 0xF2, 1, 2, 0xF0, 3, 0xF7, 7, 50, 0xB0, 7, 50 };
+    NbEvents = ParseBytes(Parser, Cancel, sizeof(Cancel), Events);
+    CHECK(NbEvents == 2);
+    CHECK((Events[1].status == 0xB0) && (Events[1].timeStamp == 11));
+
+    // Data before any status is skipped; a new status drops a partial message
+    Parser.Reset();
+    const uint8_t Partial[] = { 10, 20, 0x80, 60, 0xE0, 0, 64 };
+    NbEvents = ParseBytes(Parser, Partial, sizeof(Partial), Events);
+    CHECK(NbEvents == 1);
+    CHECK((Events[0].status == 0xE0) && (Events[0].data1 == 0) && (Events[0].data2 == 64));
+}
+
+int main() {
+    TestIngestBurst();
+    TestIngestOverflow();
+    TestIngestThreads();
+    TestEventQueue();
+    TestRunningStatus();
+    return DadTest::Result("TestMidiQueues");
+}
+
+//***End of file**************************************************************
@@ -0,0 +1,174 @@
+//==================================================================================
+//==================================================================================
+// File: TestParameterScheduler.cpp
+// Description: Host test of the parameter scheduler set logic: wake-ups,
+//              drop on settle, re-wake, family gating and capacity
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "HostTest.h"
+#include "cParameterScheduler.h"
+
+using namespace DadDSP;
+
+constexpr float RAMP_SAMPLES = 10.0f;      // Full range ramp (Process calls)
+
+// -----------------------------------------------------------------------------
+// Parameter 0..1 at 0, full range in RAMP_SAMPLES steps
+// -----------------------------------------------------------------------------
+static void InitParameter(cParameter& Parameter) {
+    Parameter.Init(0.0f, 0.0f, 1.0f, 0.1f, 0.01f, nullptr, 0, RAMP_SAMPLES);
+}
+
+static void ProcessN(cParameterScheduler& Scheduler, uint32_t Family, uint32_t Count) {
+    for (uint32_t i = 0; i < Count; i++) {
+        Scheduler.Process(Family);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// A woken parameter is active until it reaches its target, then dropped;
+// a new target wakes it again
+// -----------------------------------------------------------------------------
+static void TestWakeAndSettle() {
+    cParameterScheduler Scheduler;
+    cParameter A, B;
+    InitParameter(A);
+    InitParameter(B);
+    CHECK(Scheduler.Register(&A));
+    CHECK(Scheduler.Register(&B));
+    CHECK(Scheduler.getRegisteredCount() == 2);
+
+    // Registration wake-ups: on target, dropped at the first dispatch
+    CHECK(Scheduler.getActiveCount() == 0);
+    Scheduler.Process(0);
+    CHECK(Scheduler.getActiveCount() == 0);
+
+    A.setValue(1.0f);
+    A.setValue(1.0f);                           // Woken twice: one entry
+    Scheduler.Process(0);
+    CHECK(Scheduler.getActiveCount() == 1);
+    CHECK((A.getValue() > 0.0f) && (A.getValue() < 1.0f));
+    CHECK(B.getValue() == 0.0f);
+
+    ProcessN(Scheduler, 0, static_cast<uint32_t>(RAMP_SAMPLES));
+    CHECK(A.getValue() == 1.0f);
+    CHECK(Scheduler.getActiveCount() == 0);
+
+    // Re-wake after the drop
+    A.setValue(0.5f);
+    B.setValue(0.5f);
+    Scheduler.Process(0);
+    CHECK(Scheduler.getActiveCount() == 2);
+    ProcessN(Scheduler, 0, static_cast<uint32_t>(RAMP_SAMPLES));
+    CHECK(A.getValue() == 0.5f);
+    CHECK(B.getValue() == 0.5f);
+    CHECK(Scheduler.getActiveCount() == 0);
+}
+
+// -----------------------------------------------------------------------------
+// A sample accurate target keeps the parameter active until it is applied
+// -----------------------------------------------------------------------------
+static void TestPendingTarget() {
+    cParameterScheduler Scheduler;
+    cParameter A;
+    InitParameter(A);
+    Scheduler.Register(&A);
+    Scheduler.Process(0);
+
+    A.setValueAt(1.0f, 3);
+    ProcessN(Scheduler, 0, 3);
+    CHECK(A.getValue() == 0.0f);
+    CHECK(Scheduler.getActiveCount() == 1);
+    Scheduler.Process(0);
+    CHECK(A.getValue() > 0.0f);
+    ProcessN(Scheduler, 0, static_cast<uint32_t>(RAMP_SAMPLES));
+    CHECK(A.getValue() == 1.0f);
+    CHECK(Scheduler.getActiveCount() == 0);
+}
+
+// -----------------------------------------------------------------------------
+// Family 0 always moves; another family waits in the active list for its
+// family and moves with it
+// -----------------------------------------------------------------------------
+static void TestFamilies() {
+    cParameterScheduler Scheduler;
+    cParameter Global, Effect;
+    InitParameter(Global);
+    InitParameter(Effect);
+    Scheduler.Register(&Global, 0);
+    Scheduler.Register(&Effect, 2);
+    Scheduler.Process(0);
+
+    Global.setValue(1.0f);
+    Effect.setValue(1.0f);
+    ProcessN(Scheduler, 1, static_cast<uint32_t>(RAMP_SAMPLES) + 1);
+    CHECK(Global.getValue() == 1.0f);
+    CHECK(Effect.getValue() == 0.0f);
+    CHECK(Scheduler.getActiveCount() == 1);     // Effect waits for its family
+
+    Scheduler.SetActiveFamily(2);
+    CHECK(Scheduler.GetActiveFamily() == 2);
+    Scheduler.ProcessActive();
+    CHECK(Effect.getValue() > 0.0f);
+
+    // Family changes take effect at the next dispatch
+    CHECK(Scheduler.SetParameterFamily(&Effect, 3));
+    float Frozen = Effect.getValue();
+    Scheduler.ProcessActive();
+    CHECK(Effect.getValue() == Frozen);
+    CHECK(Scheduler.MoveFamily(3, 2));
+    CHECK(!Scheduler.MoveFamily(3, 2));
+    ProcessN(Scheduler, 2, static_cast<uint32_t>(RAMP_SAMPLES));
+    CHECK(Effect.getValue() == 1.0f);
+    CHECK(Scheduler.getActiveCount() == 0);
+
+    cParameter Unknown;
+    CHECK(!Scheduler.SetParameterFamily(&Unknown, 1));
+}
+
+// -----------------------------------------------------------------------------
+// A full scheduler refuses the next parameter; Clear detaches them all
+// -----------------------------------------------------------------------------
+static void TestCapacity() {
+    static cParameterScheduler Scheduler;
+    static cParameter Parameters[PARAM_SCHEDULER_MAX + 1];
+    for (uint32_t i = 0; i <= PARAM_SCHEDULER_MAX; i++) {
+        InitParameter(Parameters[i]);
+    }
+    for (uint32_t i = 0; i < PARAM_SCHEDULER_MAX; i++) {
+        CHECK(Scheduler.Register(&Parameters[i]));
+    }
+    CHECK(!Scheduler.Register(&Parameters[PARAM_SCHEDULER_MAX]));
+    CHECK(!Scheduler.Register(nullptr));
+    CHECK(Scheduler.getRegisteredCount() == PARAM_SCHEDULER_MAX);
+
+    // Every slot, including the last word of the pending bits
+    for (uint32_t i = 0; i < PARAM_SCHEDULER_MAX; i++) {
+        Parameters[i].setValue(1.0f);
+    }
+    Scheduler.Process(0);
+    CHECK(Scheduler.getActiveCount() == PARAM_SCHEDULER_MAX);
+    ProcessN(Scheduler, 0, static_cast<uint32_t>(RAMP_SAMPLES));
+    CHECK(Scheduler.getActiveCount() == 0);
+    CHECK(Parameters[PARAM_SCHEDULER_MAX - 1].getValue() == 1.0f);
+
+    Scheduler.Clear();
+    CHECK(Scheduler.getRegisteredCount() == 0);
+    Parameters[0].setValue(0.0f);               // Detached: no wake-up
+    Scheduler.Process(0);
+    CHECK(Scheduler.getActiveCount() == 0);
+    CHECK(Parameters[0].getValue() == 1.0f);
+}
+
+int main() {
+    TestWakeAndSettle();
+    TestPendingTarget();
+    TestFamilies();
+    TestCapacity();
+    return DadTest::Result("TestParameterScheduler");
+}
+
+//***End of file**************************************************************
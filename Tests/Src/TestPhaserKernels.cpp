@@ -0,0 +1,105 @@
+//==================================================================================
+//==================================================================================
+// File: TestPhaserKernels.cpp
+// Description: Host test of the phaser kernels: every stage count / order
+//              specialisation against the generic cascade it replaces
+//              (all the stages computed, output tapped at the last stage)
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "HostTest.h"
+#include "PhaserKernels.h"
+
+using namespace DadEffect;
+
+constexpr uint32_t KERNEL_SAMPLES = 4800;
+
+//**********************************************************************************
+// Filter bank: first and second-order filters, left then right channel
+//**********************************************************************************
+struct sBank {
+    DadDSP::cAllPass    AllPass[NB_MAX_TOTAL_FILTERS];
+    DadDSP::sAPFState   APFState[NB_MAX_TOTAL_FILTERS];
+    DadDSP::cAllPass2   AllPass2[NB_MAX_TOTAL_FILTERS];
+    DadDSP::sAPF2State  APF2State[NB_MAX_TOTAL_FILTERS];
+
+    void Initialize() {
+        for (std::size_t Index = 0; Index < NB_MAX_TOTAL_FILTERS; Index++) {
+            AllPass[Index].Initialize(48000.0f, &APFState[Index]);
+            AllPass2[Index].Initialize(48000.0f, &APF2State[Index]);
+        }
+    }
+
+    void setFrequencies(float Base) {
+        for (std::size_t Index = 0; Index < NB_MAX_TOTAL_FILTERS; Index++) {
+            float Freq = Base * (1.0f + 0.37f * static_cast<float>(Index));
+            AllPass[Index].SetFrequency(Freq);
+            AllPass2[Index].SetFrequency(Freq);
+        }
+    }
+};
+
+// -----------------------------------------------------------------------------
+// Generic cascade (phaser before the kernels): NbFilter and Order read at
+// run time, every stage of both orders computed
+// -----------------------------------------------------------------------------
+static void GenericCascade(sBank& Bank, std::size_t NbFilter, uint8_t Order, float& Left, float& Right) {
+    float LeftTemp = Left;
+    float RightTemp = Right;
+    for (std::size_t Index = 0; Index < NB_MAX_FILTERS; Index++) {
+        std::size_t IndexRight = Index + NB_MAX_FILTERS;
+        LeftTemp = Bank.AllPass[Index].Process(LeftTemp);
+        RightTemp = Bank.AllPass[IndexRight].Process(RightTemp);
+        float LeftTemp2 = Bank.AllPass2[Index].Process(LeftTemp);
+        float RightTemp2 = Bank.AllPass2[IndexRight].Process(RightTemp);
+        if (Index == NbFilter - 1) {
+            Left = (Order == 1) ? LeftTemp : LeftTemp2;
+            Right = (Order == 1) ? RightTemp : RightTemp2;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Same output, sample for sample, with the frequencies swept as by the LFO
+// -----------------------------------------------------------------------------
+template<uint8_t NbStages, uint8_t Order>
+static void CheckKernel() {
+    static sBank Generic, Kernel;
+    Generic.Initialize();
+    Kernel.Initialize();
+
+    uint32_t Seed = 12345;
+    uint32_t Mismatches = 0;
+    for (uint32_t n = 0; n < KERNEL_SAMPLES; n++) {
+        if ((n % 64) == 0) {
+            float Base = 200.0f + 800.0f * std::sin(static_cast<float>(n) * 0.001f);
+            Generic.setFrequencies(Base);
+            Kernel.setFrequencies(Base);
+        }
+        Seed = Seed * 1664525UL + 1013904223UL;
+        float In = static_cast<float>(static_cast<int32_t>(Seed)) * (1.0f / 2147483648.0f);
+
+        float GenericLeft = In, GenericRight = -In;
+        float KernelLeft = In, KernelRight = -In;
+        GenericCascade(Generic, NbStages, Order, GenericLeft, GenericRight);
+        PhaserKernel<NbStages, Order>(Kernel.AllPass, Kernel.AllPass2, KernelLeft, KernelRight);
+        if ((GenericLeft != KernelLeft) || (GenericRight != KernelRight)) Mismatches++;
+    }
+    if (!CHECK(Mismatches == 0)) {
+        std::printf("  kernel <%u stages, order %u>: %u samples differ\n", NbStages, Order, Mismatches);
+    }
+}
+
+int main() {
+    CheckKernel<1, 1>(); CheckKernel<1, 2>();
+    CheckKernel<2, 1>(); CheckKernel<2, 2>();
+    CheckKernel<3, 1>(); CheckKernel<3, 2>();
+    CheckKernel<4, 1>(); CheckKernel<4, 2>();
+    CheckKernel<5, 1>(); CheckKernel<5, 2>();
+    CheckKernel<6, 1>(); CheckKernel<6, 2>();
+    return DadTest::Result("TestPhaserKernels");
+}
+
+//***End of file**************************************************************
@@ -0,0 +1,153 @@
+//==================================================================================
+//==================================================================================
+// File: TestRTEventTable.cpp
+// Description: Host test of the pre-filtered RT dispatch table: family
+//              filtering, subscription order, rebuilds and capacity
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "HostTest.h"
+#include "RTEventTable.h"
+
+using namespace DadUtilities;
+
+//**********************************************************************************
+// Test listener: records the order of the calls in a shared log
+//**********************************************************************************
+static char     __Log[64];
+static uint32_t __LogSize = 0;
+
+static void ClearLog() {
+    __LogSize = 0;
+    __Log[0] = 0;
+}
+
+class cListener {
+public:
+    explicit cListener(char Name) : m_Name(Name) {}
+
+    void onEvent(float* pSample, uint32_t Count) {
+        *pSample += 1.0f;
+        m_Count += Count;
+        if (__LogSize < sizeof(__Log) - 1) {
+            __Log[__LogSize++] = m_Name;
+            __Log[__LogSize] = 0;
+        }
+    }
+
+    char        m_Name;
+    uint32_t    m_Count = 0;
+};
+
+using cTable = RTEventTable<cListener, 4, float*, uint32_t>;
+
+// -----------------------------------------------------------------------------
+// Family 0 subscribers always receive, the others only when active
+// -----------------------------------------------------------------------------
+static void TestFamilies() {
+    cTable Table;
+    cListener A('A'), B('B'), C('C');
+    CHECK(Table.Subscribe(&A, &cListener::onEvent, 0));
+    CHECK(Table.Subscribe(&B, &cListener::onEvent, 1));
+    CHECK(Table.Subscribe(&C, &cListener::onEvent, 2));
+
+    float Sample = 0.0f;
+    ClearLog();
+    Table.sendEventToActive(&Sample, 4);
+    CHECK(strcmp(__Log, "A") == 0);
+    CHECK(Table.GetActiveCount() == 1);
+
+    Table.SetActiveFamily(2);
+    ClearLog();
+    Table.sendEventToActive(&Sample, 4);
+    CHECK(strcmp(__Log, "AC") == 0);
+    CHECK(Table.GetActiveCount() == 2);
+    CHECK(Sample == 3.0f);
+    CHECK(C.m_Count == 4);
+
+    // Another family than the active one walks the full table
+    ClearLog();
+    Table.sendEvent(1, &Sample, 1);
+    CHECK(strcmp(__Log, "AB") == 0);
+
+    ClearLog();
+    Table.sendEventToAll(&Sample, 1);
+    CHECK(strcmp(__Log, "ABC") == 0);
+
+    CHECK(Table.GetSubscriberCount() == 3);
+    CHECK(Table.GetSubscriberCount(2) == 1);
+    CHECK(Table.GetSubscriberCount(2, true) == 2);
+}
+
+// -----------------------------------------------------------------------------
+// Subscription changes rebuild the dispatch list, order preserved
+// -----------------------------------------------------------------------------
+static void TestRebuild() {
+    cTable Table;
+    cListener A('A'), B('B'), C('C');
+    Table.SetActiveFamily(1);
+    Table.Subscribe(&A, &cListener::onEvent, 1);
+    Table.Subscribe(&B, &cListener::onEvent, 0);
+    Table.Subscribe(&C, &cListener::onEvent, 1);
+
+    float Sample = 0.0f;
+    ClearLog();
+    Table.sendEventToActive(&Sample, 1);
+    CHECK(strcmp(__Log, "ABC") == 0);
+
+    Table.Unsubscribe(&B);
+    ClearLog();
+    Table.sendEventToActive(&Sample, 1);
+    CHECK(strcmp(__Log, "AC") == 0);
+
+    CHECK(Table.SetSubscriberFamily(&A, 3));
+    ClearLog();
+    Table.sendEventToActive(&Sample, 1);
+    CHECK(strcmp(__Log, "C") == 0);
+
+    uint32_t Family = 0;
+    CHECK(Table.GetSubscriberFamily(&A, Family) && (Family == 3));
+    CHECK(!Table.GetSubscriberFamily(&B, Family));
+
+    CHECK(Table.MoveFamily(1, 3));
+    CHECK(!Table.MoveFamily(1, 3));
+    Table.SetActiveFamily(3);
+    ClearLog();
+    Table.sendEventToActive(&Sample, 1);
+    CHECK(strcmp(__Log, "AC") == 0);
+
+    Table.Clear();
+    CHECK(Table.IsEmpty());
+    CHECK(Table.GetActiveCount() == 0);
+    CHECK(Table.GetActiveFamily() == 0);
+}
+
+// -----------------------------------------------------------------------------
+// A full table and invalid arguments are refused
+// -----------------------------------------------------------------------------
+static void TestCapacity() {
+    cTable Table;
+    cListener L[5] = { cListener('0'), cListener('1'), cListener('2'), cListener('3'), cListener('4') };
+    for (uint32_t i = 0; i < 4; i++) {
+        CHECK(Table.Subscribe(&L[i], &cListener::onEvent, 0));
+    }
+    CHECK(!Table.Subscribe(&L[4], &cListener::onEvent, 0));
+    CHECK(Table.GetSubscriberCount() == 4);
+
+    cTable Empty;
+    CHECK(!Empty.Subscribe(nullptr, &cListener::onEvent, 0));
+    CHECK(!Empty.Subscribe(&L[0], nullptr, 0));
+    CHECK(!Empty.Subscribe(&L[0], &cListener::onEvent, 0xFFFFFFFF));
+    CHECK(Empty.IsEmpty());
+}
+
+int main() {
+    TestFamilies();
+    TestRebuild();
+    TestCapacity();
+    return DadTest::Result("TestRTEventTable");
+}
+
+//***End of file**************************************************************
@@ -0,0 +1,177 @@
+//==================================================================================
+//==================================================================================
+// File: TestSaturator.cpp
+// Description: Host test of the saturation stage: aliasing per oversampling
+//              factor, unity gain at low level and state reset
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "HostTest.h"
+#include "cSaturator.h"
+
+using namespace DadDSP;
+
+constexpr float    FS            = 48000.0f;
+constexpr float    TWO_PI        = 6.28318530717959f;
+constexpr uint32_t ALIAS_SAMPLES = 9600;        // 200 ms at 48 kHz
+constexpr float    ALIAS_FREQ    = 5250.0f;     // Fundamental (not a divisor of Fs)
+constexpr uint32_t ALIAS_HARM    = 31;          // Highest harmonic checked
+constexpr float    ALIAS_BAND    = 20000.0f;    // Audible band limit
+
+//**********************************************************************************
+// Goertzel detector (power of one frequency over a windowed record)
+//**********************************************************************************
+struct sGoertzel {
+    double Coeff;
+    double S1;
+    double S2;
+
+    void Init(double Freq) {
+        Coeff = 2.0 * std::cos(TWO_PI * Freq / FS);
+        S1 = S2 = 0.0;
+    }
+    inline void Process(double x) {
+        double S0 = x + Coeff * S1 - S2;
+        S2 = S1;
+        S1 = S0;
+    }
+    double getPower() const {
+        return (S1 * S1) + (S2 * S2) - (Coeff * S1 * S2);
+    }
+};
+
+// -----------------------------------------------------------------------------
+// Aliasing of a configuration (dB): the harmonics above Nyquist fold back to
+// known frequencies, the power of the images landing in the audible band is
+// summed and compared to the power of the fundamental
+// -----------------------------------------------------------------------------
+static float AliasDb(eSatCurve Curve, eSatOversampling Oversampling, float Drive) {
+    static cSaturator Saturator;
+    Saturator.Initialize(Curve, Oversampling, Drive);
+
+    sGoertzel Fundamental;
+    Fundamental.Init(ALIAS_FREQ);
+    sGoertzel Alias[ALIAS_HARM];
+    uint32_t NbAlias = 0;
+    for (uint32_t h = 2; h <= ALIAS_HARM; h++) {
+        float f = ALIAS_FREQ * h;
+        if (f < (FS * 0.5f)) continue;                      // Legitimate harmonic
+        f = std::fmod(f, FS);
+        if (f > (FS * 0.5f)) f = FS - f;                    // Folded frequency
+        if (f > ALIAS_BAND) continue;                       // Inaudible image
+        Alias[NbAlias++].Init(f);
+    }
+
+    for (uint32_t Index = 0; Index < ALIAS_SAMPLES; Index++) {
+        float In = 0.5f * std::sin(TWO_PI * ALIAS_FREQ * static_cast<float>(Index) / FS);
+        // Hann window keeps the fundamental leakage away from the images
+        double w = 0.5 - 0.5 * std::cos(TWO_PI * static_cast<double>(Index) / ALIAS_SAMPLES);
+        double x = Saturator.Process(In) * w;
+        Fundamental.Process(x);
+        for (uint32_t a = 0; a < NbAlias; a++) {
+            Alias[a].Process(x);
+        }
+    }
+
+    double AliasPower = 1.0e-20;
+    for (uint32_t a = 0; a < NbAlias; a++) {
+        AliasPower += Alias[a].getPower();
+    }
+    return static_cast<float>(10.0 * std::log10(AliasPower / (Fundamental.getPower() + 1.0e-20)));
+}
+
+// -----------------------------------------------------------------------------
+// Each oversampling stage lowers the audible images
+// -----------------------------------------------------------------------------
+static void TestAliasing() {
+    static constexpr eSatCurve Curves[] = { eSatCurve::Tanh, eSatCurve::Tube, eSatCurve::TanhADAA };
+    static constexpr const char* Names[] = { "Tanh", "Tube", "TanhADAA" };
+    for (uint32_t c = 0; c < 3; c++) {
+        float x1 = AliasDb(Curves[c], eSatOversampling::x1, 8.0f);
+        float x2 = AliasDb(Curves[c], eSatOversampling::x2, 8.0f);
+        float x4 = AliasDb(Curves[c], eSatOversampling::x4, 8.0f);
+        std::printf("%-8s alias x1 %6.1f dB, x2 %6.1f dB, x4 %6.1f dB\n", Names[c], x1, x2, x4);
+        CHECK(x2 < x1 - 10.0f);
+        CHECK(x4 < x2 - 10.0f);
+        CHECK(x4 < -80.0f);
+    }
+    CHECK(AliasDb(eSatCurve::TanhADAA, eSatOversampling::x1, 8.0f) < AliasDb(eSatCurve::Tanh, eSatOversampling::x1, 8.0f) - 6.0f);
+}
+
+// -----------------------------------------------------------------------------
+// Low levels go through unchanged (Curve(In * Drive) / Drive): delayed by the
+// announced latency for Tanh, same level for TanhADAA (its antiderivative
+// difference adds half an oversampled sample of delay)
+// -----------------------------------------------------------------------------
+static void TestLowLevel() {
+    static constexpr eSatOversampling Factors[] = { eSatOversampling::x1, eSatOversampling::x2, eSatOversampling::x4 };
+    constexpr uint32_t Samples = 4800;
+    constexpr uint32_t Settle = 64;
+    static float In[Samples];
+
+    for (eSatOversampling Factor : Factors) {
+        cSaturator Tanh, Adaa;
+        Tanh.Initialize(eSatCurve::Tanh, Factor, 4.0f);
+        Adaa.Initialize(eSatCurve::TanhADAA, Factor, 4.0f);
+        uint32_t Latency = Tanh.getLatency();
+        float MaxError = 0.0f;
+        double InPower = 0.0;
+        double AdaaPower = 0.0;
+        for (uint32_t n = 0; n < Samples; n++) {
+            In[n] = 0.001f * std::sin(TWO_PI * 1000.0f * static_cast<float>(n) / FS);
+            float Out = Tanh.Process(In[n]);
+            float OutAdaa = Adaa.Process(In[n]);
+            if (n >= Latency + Settle) {
+                MaxError = std::fmax(MaxError, std::fabs(Out - In[n - Latency]));
+                InPower += In[n] * In[n];
+                AdaaPower += OutAdaa * OutAdaa;
+            }
+        }
+        double AdaaGainDb = 10.0 * std::log10(AdaaPower / InPower);
+        std::printf("low level x%u: latency %u, Tanh max error %.1e, TanhADAA gain %.3f dB\n",
+                    static_cast<uint32_t>(Factor), Latency, MaxError, AdaaGainDb);
+        CHECK(MaxError < 1.0e-6f);              // -60 dB under the 0.001 signal
+        CHECK(std::fabs(AdaaGainDb) < 0.1);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Reset clears the filters: silence in, silence out
+// -----------------------------------------------------------------------------
+static void TestReset() {
+    cSaturator Saturator;
+    Saturator.Initialize(eSatCurve::Tube, eSatOversampling::x4, 8.0f);
+    for (uint32_t n = 0; n < 256; n++) {
+        Saturator.Process(0.8f * std::sin(static_cast<float>(n) * 0.3f));
+    }
+    Saturator.Reset();
+    float Max = 0.0f;
+    for (uint32_t n = 0; n < 256; n++) {
+        Max = std::fmax(Max, std::fabs(Saturator.Process(0.0f)));
+    }
+    CHECK(Max == 0.0f);
+
+    // ProcessBlock in place matches Process
+    cSaturator A, B;
+    A.Initialize(eSatCurve::TanhADAA, eSatOversampling::x2, 6.0f);
+    B.Initialize(eSatCurve::TanhADAA, eSatOversampling::x2, 6.0f);
+    float Block[48];
+    uint32_t Mismatches = 0;
+    for (uint32_t n = 0; n < 48; n++) Block[n] = 0.7f * std::sin(static_cast<float>(n) * 0.2f);
+    float Ref[48];
+    for (uint32_t n = 0; n < 48; n++) Ref[n] = A.Process(Block[n]);
+    B.ProcessBlock(Block, Block, 48);
+    for (uint32_t n = 0; n < 48; n++) if (Ref[n] != Block[n]) Mismatches++;
+    CHECK(Mismatches == 0);
+}
+
+int main() {
+    TestAliasing();
+    TestLowLevel();
+    TestReset();
+    return DadTest::Result("TestSaturator");
+}
+
+//***End of file**************************************************************
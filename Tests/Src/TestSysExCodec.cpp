@@ -0,0 +1,213 @@
+//==================================================================================
+//==================================================================================
+// File: TestSysExCodec.cpp
+// Description: Host test of the SysEx codec (7-bit packing, CRC, message
+//              build / parse) and of the SysEx receive queue
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "HostTest.h"
+#include "cMidiSysEx.h"
+
+using namespace DadDrivers;
+
+static uint8_t __Body[MIDI_SYSEX_MAX_BODY];
+static uint8_t __Unpacked[MIDI_SYSEX_MAX_BODY];
+static uint8_t __Message[MIDI_SYSEX_MAX_MESSAGE + 2];
+
+static void FillBody(uint32_t Size, uint32_t Seed) {
+    for (uint32_t i = 0; i < Size; i++) {
+        __Body[i] = static_cast<uint8_t>(i * 37 + Seed);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Little endian fields
+// -----------------------------------------------------------------------------
+static void TestFields() {
+    uint8_t Bytes[4];
+    cSysExCodec::Put32(Bytes, 0x89ABCDEF);
+    CHECK((Bytes[0] == 0xEF) && (Bytes[1] == 0xCD) && (Bytes[2] == 0xAB) && (Bytes[3] == 0x89));
+    CHECK(cSysExCodec::Get32(Bytes) == 0x89ABCDEF);
+    cSysExCodec::Put16(Bytes, 0xF00D);
+    CHECK((Bytes[0] == 0x0D) && (Bytes[1] == 0xF0));
+    CHECK(cSysExCodec::Get16(Bytes) == 0xF00D);
+}
+
+// -----------------------------------------------------------------------------
+// CRC-16/CCITT-FALSE check value, chained computation
+// -----------------------------------------------------------------------------
+static void TestCrc() {
+    const uint8_t Check[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+    CHECK(cSysExCodec::Crc16(Check, 9) == 0x29B1);
+    CHECK(cSysExCodec::Crc16(&Check[4], 5, cSysExCodec::Crc16(Check, 4)) == 0x29B1);
+}
+
+// -----------------------------------------------------------------------------
+// Pack / unpack: every byte value, every group remainder, 7-bit output
+// -----------------------------------------------------------------------------
+static void TestPacking() {
+    for (uint32_t Size = 0; Size <= 64; Size++) {
+        FillBody(Size, Size);
+        uint32_t Packed = cSysExCodec::Pack(__Body, Size, __Message);
+        CHECK(Packed == MIDI_SYSEX_PACKED_SIZE(Size));
+        bool SevenBits = true;
+        for (uint32_t i = 0; i < Packed; i++) {
+            if (__Message[i] & 0x80) SevenBits = false;
+        }
+        CHECK(SevenBits);
+        CHECK(cSysExCodec::Unpack(__Message, Packed, __Unpacked) == Size);
+        CHECK(memcmp(__Body, __Unpacked, Size) == 0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Build / Parse round trip up to the largest body
+// -----------------------------------------------------------------------------
+static void TestRoundTrip() {
+    for (uint32_t Size = 0; Size <= MIDI_SYSEX_MAX_BODY - 2; Size += (Size < 32) ? 1 : 29) {
+        FillBody(Size, 3 * Size);
+        uint32_t Length = cSysExCodec::Build(MIDI_SYSEX_DATA, __Body, Size, __Message);
+        CHECK(Length <= MIDI_SYSEX_MAX_MESSAGE + 2);
+        CHECK((__Message[0] == 0xF0) && (__Message[Length - 1] == 0xF7));
+        CHECK((__Message[1] == MIDI_SYSEX_ID) && (__Message[4] == MIDI_SYSEX_DATA));
+
+        uint8_t Cmd = 0;
+        uint32_t BodySize = 0;
+        CHECK(cSysExCodec::Parse(&__Message[1], Length - 2, Cmd, __Unpacked, BodySize));
+        CHECK((Cmd == MIDI_SYSEX_DATA) && (BodySize == Size));
+        CHECK(memcmp(__Body, __Unpacked, Size) == 0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Corruption: any flipped bit of the command or body is detected, other
+// manufacturers and truncated messages are refused
+// -----------------------------------------------------------------------------
+static void TestCorruption() {
+    const uint32_t Size = 100;
+    FillBody(Size, 7);
+    uint32_t Length = cSysExCodec::Build(MIDI_SYSEX_WRITE_DATA, __Body, Size, __Message);
+    uint8_t Cmd = 0;
+    uint32_t BodySize = 0;
+
+    // A flip is either detected or lands on an unused MSB bit of the last
+    // group (same decoded message)
+    uint32_t Undetected = 0;
+    for (uint32_t Index = 4; Index < Length - 1; Index++) {
+        for (uint32_t Bit = 0; Bit < 7; Bit++) {
+            __Message[Index] ^= (1 << Bit);
+            if (cSysExCodec::Parse(&__Message[1], Length - 2, Cmd, __Unpacked, BodySize)) {
+                Undetected++;
+                CHECK((Cmd == MIDI_SYSEX_WRITE_DATA) && (BodySize == Size) && (memcmp(__Body, __Unpacked, Size) == 0));
+            }
+            __Message[Index] ^= (1 << Bit);
+        }
+    }
+    CHECK(Undetected == 7 - ((Size + 2) % 7));
+
+    // Header: not ours
+    __Message[2] ^= 0x01;
+    CHECK(!cSysExCodec::Parse(&__Message[1], Length - 2, Cmd, __Unpacked, BodySize));
+    __Message[2] ^= 0x01;
+
+    // Truncated
+    CHECK(!cSysExCodec::Parse(&__Message[1], Length - 3, Cmd, __Unpacked, BodySize));
+    CHECK(!cSysExCodec::Parse(&__Message[1], 3, Cmd, __Unpacked, BodySize));
+    CHECK(cSysExCodec::Parse(&__Message[1], Length - 2, Cmd, __Unpacked, BodySize));
+}
+
+//**********************************************************************************
+// Receive queue
+//**********************************************************************************
+
+static void PushMessage(cSysExQueue& Queue, uint8_t Tag, uint32_t Size) {
+    Queue.PushByte(0xF0);
+    for (uint32_t i = 0; i < Size; i++) {
+        Queue.PushByte(static_cast<uint8_t>((Tag + i) & 0x7F));
+    }
+    Queue.PushByte(0xF7);
+}
+
+static bool PopMessage(cSysExQueue& Queue, uint8_t Tag, uint32_t Size) {
+    uint32_t Length = 0;
+    const uint8_t* pData = Queue.Peek(Length);
+    if ((pData == nullptr) || (Length != Size)) return false;
+    for (uint32_t i = 0; i < Size; i++) {
+        if (pData[i] != ((Tag + i) & 0x7F)) return false;
+    }
+    Queue.Pop();
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Order, overflow on a full queue, wrap of the slots
+// -----------------------------------------------------------------------------
+static void TestQueue() {
+    static cSysExQueue Queue;
+    uint32_t Length = 0;
+    CHECK(Queue.Peek(Length) == nullptr);
+
+    // Full queue: the next message is lost, the queued ones are intact
+    for (uint32_t i = 0; i < MIDI_SYSEX_QUEUE_SIZE + 1; i++) {
+        PushMessage(Queue, static_cast<uint8_t>(i), 10 + i);
+    }
+    CHECK(Queue.getOverflows() == 1);
+    for (uint32_t i = 0; i < MIDI_SYSEX_QUEUE_SIZE; i++) {
+        CHECK(PopMessage(Queue, static_cast<uint8_t>(i), 10 + i));
+    }
+    CHECK(Queue.Peek(Length) == nullptr);
+
+    // Interleaved producer / consumer across several wraps
+    bool InOrder = true;
+    for (uint32_t i = 0; i < 5 * MIDI_SYSEX_QUEUE_SIZE; i++) {
+        PushMessage(Queue, static_cast<uint8_t>(i), 1 + (i % 50));
+        if (i & 1) {
+            InOrder = InOrder && PopMessage(Queue, static_cast<uint8_t>(i - 1), 1 + ((i - 1) % 50));
+            InOrder = InOrder && PopMessage(Queue, static_cast<uint8_t>(i), 1 + (i % 50));
+        }
+    }
+    CHECK(InOrder);
+    CHECK(Queue.getOverflows() == 1);
+}
+
+// -----------------------------------------------------------------------------
+// Malformed streams: too long, aborted by a status byte, data without F0
+// -----------------------------------------------------------------------------
+static void TestQueueMalformed() {
+    static cSysExQueue Queue;
+    uint32_t Length = 0;
+
+    PushMessage(Queue, 0, MIDI_SYSEX_MAX_MESSAGE + 1);
+    CHECK(Queue.Peek(Length) == nullptr);
+    CHECK(Queue.getOverflows() == 1);
+
+    PushMessage(Queue, 0, MIDI_SYSEX_MAX_MESSAGE);
+    CHECK(PopMessage(Queue, 0, MIDI_SYSEX_MAX_MESSAGE));
+
+    Queue.PushByte(0xF0);
+    Queue.PushByte(0x01);
+    Queue.PushByte(0x90);                       // Aborts the message
+    Queue.PushByte(0x02);
+    Queue.PushByte(0xF7);
+    CHECK(Queue.Peek(Length) == nullptr);
+
+    PushMessage(Queue, 5, 0);                   // Empty message is committed
+    CHECK(PopMessage(Queue, 5, 0));
+    CHECK(Queue.getOverflows() == 1);
+}
+
+int main() {
+    TestFields();
+    TestCrc();
+    TestPacking();
+    TestRoundTrip();
+    TestCorruption();
+    TestQueue();
+    TestQueueMalformed();
+    return DadTest::Result("TestSysExCodec");
+}
+
+//***End of file**************************************************************
@@ -12,8 +12,22 @@
 
 #include "main.h"
 
+#ifndef EVENT_NODE_POOL_SIZE
+#define EVENT_NODE_POOL_SIZE 32         // Nodes per node type (see SubscriberNodePoolSize)
+#endif
+
 namespace DadUtilities {
 
+//**********************************************************************************
+// Structure: SubscriberNodePoolSize
+// Description: Nodes reserved for a node type. Specialized by the owner of the
+//              node types that have more subscribers than EVENT_NODE_POOL_SIZE.
+//**********************************************************************************
+template<typename Node>
+struct SubscriberNodePoolSize {
+    static constexpr uint32_t Value = EVENT_NODE_POOL_SIZE;
+};
+
 //**********************************************************************************
 // Structure: SubscriberNode
 // Description: Linked list node for storing event subscribers with family support
@@ -25,10 +39,63 @@ struct SubscriberNode {
     uint32_t family;
     SubscriberNode* next;
 
+    constexpr SubscriberNode()
+        : subscriber(nullptr), callback(nullptr), family(0), next(nullptr) {}
+
     SubscriberNode(Interface* sub, ReturnType (Interface::*cb)(Args...), uint32_t fam = 0)
         : subscriber(sub), callback(cb), family(fam), next(nullptr) {}
 };
 
+//**********************************************************************************
+// Class: SubscriberNodePool
+// Description: Static pool of nodes shared by the event managers of a node type.
+//              Subscriptions take no heap; released nodes are kept in a free
+//              list and reused. An exhausted pool is a sizing error.
+//**********************************************************************************
+template<typename Node>
+class SubscriberNodePool {
+public:
+    // -----------------------------------------------------------------------------
+    // Method: Allocate
+    // Description: Free list first, then the static pool
+    // Returns: nullptr if the pool is exhausted (Error_Handler is called first)
+    // -----------------------------------------------------------------------------
+    static Node* Allocate() {
+        Node* pNode = m_pFree;
+        if (pNode != nullptr) {
+            m_pFree = pNode->next;
+        } else if (m_NbUsed < SubscriberNodePoolSize<Node>::Value) {
+            pNode = &m_Nodes[m_NbUsed++];
+        } else {
+            Error_Handler();                // Raise SubscriberNodePoolSize of this node type
+        }
+        return pNode;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: Release
+    // Description: Return a node to the free list
+    // -----------------------------------------------------------------------------
+    static void Release(Node* pNode) {
+        pNode->next = m_pFree;
+        m_pFree = pNode;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Accessor: pool usage (high water mark)
+    // -----------------------------------------------------------------------------
+    static uint32_t getUsed() { return m_NbUsed; }
+
+private:
+    static Node     m_Nodes[SubscriberNodePoolSize<Node>::Value];
+    static Node*    m_pFree;
+    static uint32_t m_NbUsed;
+};
+
+template<typename Node> Node     SubscriberNodePool<Node>::m_Nodes[SubscriberNodePoolSize<Node>::Value];
+template<typename Node> Node*    SubscriberNodePool<Node>::m_pFree = nullptr;
+template<typename Node> uint32_t SubscriberNodePool<Node>::m_NbUsed = 0;
+
 //**********************************************************************************
 // Class: EventManager (Generic version)
 // Description: Template class for managing event subscriptions and triggering
@@ -68,9 +135,13 @@ public:
             return;
         }
 
-        // Create a new node for the subscriber
+        // Take a node from the pool for the subscriber
         SubscriberNode<Interface, ReturnType, Args...>* newNode =
-            new SubscriberNode<Interface, ReturnType, Args...>(subscriber, callback, family);
+            SubscriberNodePool<SubscriberNode<Interface, ReturnType, Args...>>::Allocate();
+        if (!newNode) {
+            return;
+        }
+        *newNode = SubscriberNode<Interface, ReturnType, Args...>(subscriber, callback, family);
 
         if (!head) {
             head = tail = newNode;
@@ -108,7 +179,7 @@ public:
 
                 SubscriberNode<Interface, ReturnType, Args...>* toDelete = current;
                 current = current->next;
-                delete toDelete;
+                SubscriberNodePool<SubscriberNode<Interface, ReturnType, Args...>>::Release(toDelete);
                 subscriberCount--;
             } else {
                 previous = current;
@@ -144,6 +215,29 @@ public:
         return found;
     }
 
+    // -----------------------------------------------------------------------------
+    // Method: MoveFamily
+    // Description: Move every subscriber of a family to another family
+    // Parameters:
+    //   - oldFamily: Family ID to move
+    //   - newFamily: New family ID to assign
+    // Returns: true if at least one subscriber was moved
+    // -----------------------------------------------------------------------------
+    bool MoveFamily(uint32_t oldFamily, uint32_t newFamily) {
+        SubscriberNode<Interface, ReturnType, Args...>* current = head;
+        bool found = false;
+
+        while (current) {
+            if (current->family == oldFamily) {
+                current->family = newFamily;
+                found = true;
+            }
+            current = current->next;
+        }
+
+        return found;
+    }
+
     // -----------------------------------------------------------------------------
     // Method: GetSubscriberFamily
     // Description: Get the family of a specific subscriber
@@ -243,14 +337,14 @@ public:
 
     // -----------------------------------------------------------------------------
     // Method: Clear
-    // Description: Remove all subscribers and clean up memory
+    // Description: Remove all subscribers and return their nodes to the pool
     // -----------------------------------------------------------------------------
     void Clear() {
         SubscriberNode<Interface, ReturnType, Args...>* current = head;
 
         while (current) {
             SubscriberNode<Interface, ReturnType, Args...>* next = current->next;
-            delete current;
+            SubscriberNodePool<SubscriberNode<Interface, ReturnType, Args...>>::Release(current);
             current = next;
         }
 
@@ -307,9 +401,13 @@ public:
             return;
         }
 
-        // Create a new node for the subscriber
+        // Take a node from the pool for the subscriber
         SubscriberNode<Interface, void, Args...>* newNode =
-            new SubscriberNode<Interface, void, Args...>(subscriber, callback, family);
+            SubscriberNodePool<SubscriberNode<Interface, void, Args...>>::Allocate();
+        if (!newNode) {
+            return;
+        }
+        *newNode = SubscriberNode<Interface, void, Args...>(subscriber, callback, family);
 
         if (!head) {
             head = tail = newNode;
@@ -347,7 +445,7 @@ public:
 
                 SubscriberNode<Interface, void, Args...>* toDelete = current;
                 current = current->next;
-                delete toDelete;
+                SubscriberNodePool<SubscriberNode<Interface, void, Args...>>::Release(toDelete);
                 subscriberCount--;
             } else {
                 previous = current;
@@ -383,6 +481,29 @@ public:
         return found;
     }
 
+    // -----------------------------------------------------------------------------
+    // Method: MoveFamily
+    // Description: Move every subscriber of a family to another family
+    // Parameters:
+    //   - oldFamily: Family ID to move
+    //   - newFamily: New family ID to assign
+    // Returns: true if at least one subscriber was moved
+    // -----------------------------------------------------------------------------
+    bool MoveFamily(uint32_t oldFamily, uint32_t newFamily) {
+        SubscriberNode<Interface, void, Args...>* current = head;
+        bool found = false;
+
+        while (current) {
+            if (current->family == oldFamily) {
+                current->family = newFamily;
+                found = true;
+            }
+            current = current->next;
+        }
+
+        return found;
+    }
+
     // -----------------------------------------------------------------------------
     // Method: GetSubscriberFamily
     // Description: Get the family of a specific subscriber
@@ -482,14 +603,14 @@ public:
 
     // -----------------------------------------------------------------------------
     // Method: Clear
-    // Description: Remove all subscribers and clean up memory
+    // Description: Remove all subscribers and return their nodes to the pool
     // -----------------------------------------------------------------------------
     void Clear() {
         SubscriberNode<Interface, void, Args...>* current = head;
 
         while (current) {
             SubscriberNode<Interface, void, Args...>* next = current->next;
-            delete current;
+            SubscriberNodePool<SubscriberNode<Interface, void, Args...>>::Release(current);
             current = next;
         }
 
@@ -544,9 +665,13 @@ public:
             return;
         }
 
-        // Create a new node for the subscriber
+        // Take a node from the pool for the subscriber
         SubscriberNode<Interface, bool>* newNode =
-            new SubscriberNode<Interface, bool>(subscriber, callback, family);
+            SubscriberNodePool<SubscriberNode<Interface, bool>>::Allocate();
+        if (!newNode) {
+            return;
+        }
+        *newNode = SubscriberNode<Interface, bool>(subscriber, callback, family);
 
         if (!head) {
             head = tail = newNode;
@@ -584,7 +709,7 @@ public:
 
                 SubscriberNode<Interface, bool>* toDelete = current;
                 current = current->next;
-                delete toDelete;
+                SubscriberNodePool<SubscriberNode<Interface, bool>>::Release(toDelete);
                 subscriberCount--;
             } else {
                 previous = current;
@@ -620,6 +745,29 @@ public:
         return found;
     }
 
+    // -----------------------------------------------------------------------------
+    // Method: MoveFamily
+    // Description: Move every subscriber of a family to another family
+    // Parameters:
+    //   - oldFamily: Family ID to move
+    //   - newFamily: New family ID to assign
+    // Returns: true if at least one subscriber was moved
+    // -----------------------------------------------------------------------------
+    bool MoveFamily(uint32_t oldFamily, uint32_t newFamily) {
+        SubscriberNode<Interface, bool>* current = head;
+        bool found = false;
+
+        while (current) {
+            if (current->family == oldFamily) {
+                current->family = newFamily;
+                found = true;
+            }
+            current = current->next;
+        }
+
+        return found;
+    }
+
     // -----------------------------------------------------------------------------
     // Method: GetSubscriberFamily
     // Description: Get the family of a specific subscriber
@@ -727,14 +875,14 @@ public:
 
     // -----------------------------------------------------------------------------
     // Method: Clear
-    // Description: Remove all subscribers and clean up memory
+    // Description: Remove all subscribers and return their nodes to the pool
     // -----------------------------------------------------------------------------
     void Clear() {
         SubscriberNode<Interface, bool>* current = head;
 
         while (current) {
             SubscriberNode<Interface, bool>* next = current->next;
-            delete current;
+            SubscriberNodePool<SubscriberNode<Interface, bool>>::Release(current);
             current = next;
         }
 
@@ -0,0 +1,313 @@
+//==================================================================================
+//==================================================================================
+// File: RTEventTable.h
+// Description: Fixed-capacity event dispatch table for real-time events.
+//              Subscribers are stored in a contiguous array and the subscribers
+//              of the active family are pre-filtered into a flat dispatch list,
+//              rebuilt only when subscriptions or the active family change.
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#pragma once
+
+#include "main.h"
+
+namespace DadUtilities {
+
+//**********************************************************************************
+// Class: RTEventTable
+// Description: Contiguous subscriber table with a pre-filtered dispatch list.
+//              The dispatch list is double buffered: it is rebuilt in the back
+//              buffer then published with a single pointer write, so the audio
+//              interrupt always walks a consistent list without locking.
+// Template parameters:
+//   - Interface: Subscriber interface type
+//   - MaxSubscribers: Maximum number of subscribers
+//   - Args: Callback arguments
+//**********************************************************************************
+template<typename Interface, uint32_t MaxSubscribers, typename... Args>
+class RTEventTable {
+public:
+    using Callback_t = void (Interface::*)(Args...);
+
+    // -----------------------------------------------------------------------------
+    // Constructor
+    // -----------------------------------------------------------------------------
+    RTEventTable() {
+        Clear();
+    }
+
+    // -----------------------------------------------------------------------------
+    // Delete copy constructor and assignment operator
+    // -----------------------------------------------------------------------------
+    RTEventTable(const RTEventTable&) = delete;
+    RTEventTable& operator=(const RTEventTable&) = delete;
+
+    // -----------------------------------------------------------------------------
+    // Method: Subscribe
+    // Description: Subscribe an object with a callback method to the event
+    // Parameters:
+    //   - subscriber: Pointer to the subscriber object
+    //   - callback: Member function pointer to call
+    //   - family: Family ID (0 = receives all events, other values = specific family)
+    // Returns: false if the table is full or the arguments are invalid
+    // -----------------------------------------------------------------------------
+    bool Subscribe(Interface* subscriber, Callback_t callback, uint32_t family = 0) {
+        if (family == 0xFFFFFFFF) return false;
+        if (!subscriber || !callback || (m_NbSubscribers >= MaxSubscribers)) {
+            return false;
+        }
+
+        m_Subscribers[m_NbSubscribers].m_pSubscriber = subscriber;
+        m_Subscribers[m_NbSubscribers].m_Callback = callback;
+        m_Subscribers[m_NbSubscribers].m_Family = family;
+        m_NbSubscribers++;
+
+        Rebuild();
+        return true;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: Unsubscribe
+    // Description: Remove all subscriptions for a specific subscriber
+    //              (subscription order is preserved)
+    // -----------------------------------------------------------------------------
+    void Unsubscribe(Interface* subscriber) {
+        if (!subscriber) {
+            return;
+        }
+
+        uint32_t Dest = 0;
+        for (uint32_t Index = 0; Index < m_NbSubscribers; Index++) {
+            if (m_Subscribers[Index].m_pSubscriber != subscriber) {
+                m_Subscribers[Dest++] = m_Subscribers[Index];
+            }
+        }
+
+        if (Dest != m_NbSubscribers) {
+            m_NbSubscribers = Dest;
+            Rebuild();
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: SetSubscriberFamily
+    // Description: Change the family of a specific subscriber
+    // Returns: true if subscriber was found and updated, false otherwise
+    // -----------------------------------------------------------------------------
+    bool SetSubscriberFamily(Interface* subscriber, uint32_t newFamily) {
+        bool found = false;
+
+        for (uint32_t Index = 0; Index < m_NbSubscribers; Index++) {
+            if (m_Subscribers[Index].m_pSubscriber == subscriber) {
+                m_Subscribers[Index].m_Family = newFamily;
+                found = true;
+            }
+        }
+
+        if (found) {
+            Rebuild();
+        }
+        return found;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: MoveFamily
+    // Description: Move every subscriber of a family to another family
+    // Returns: true if at least one subscriber was moved
+    // -----------------------------------------------------------------------------
+    bool MoveFamily(uint32_t oldFamily, uint32_t newFamily) {
+        bool found = false;
+
+        for (uint32_t Index = 0; Index < m_NbSubscribers; Index++) {
+            if (m_Subscribers[Index].m_Family == oldFamily) {
+                m_Subscribers[Index].m_Family = newFamily;
+                found = true;
+            }
+        }
+
+        if (found) {
+            Rebuild();
+        }
+        return found;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: GetSubscriberFamily
+    // Description: Get the family of a specific subscriber
+    // Returns: true if subscriber was found, false otherwise
+    // -----------------------------------------------------------------------------
+    bool GetSubscriberFamily(Interface* subscriber, uint32_t& outFamily) const {
+        for (uint32_t Index = 0; Index < m_NbSubscribers; Index++) {
+            if (m_Subscribers[Index].m_pSubscriber == subscriber) {
+                outFamily = m_Subscribers[Index].m_Family;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: SetActiveFamily
+    // Description: Set the active family and rebuild the dispatch list
+    // -----------------------------------------------------------------------------
+    void SetActiveFamily(uint32_t family) {
+        if (family != m_ActiveFamily) {
+            m_ActiveFamily = family;
+            Rebuild();
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: GetActiveFamily
+    // Description: Get the active family
+    // -----------------------------------------------------------------------------
+    inline uint32_t GetActiveFamily() const {
+        return m_ActiveFamily;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: sendEventToActive
+    // Description: Call the callbacks of the pre-filtered dispatch list
+    //              (family 0 subscribers and active family subscribers)
+    // -----------------------------------------------------------------------------
+    inline void sendEventToActive(Args... args) {
+        const sDispatchList* pList = m_pDispatch;
+        const uint32_t Count = pList->m_Count;
+
+        for (uint32_t Index = 0; Index < Count; Index++) {
+            const sEntry& Entry = pList->m_Entries[Index];
+            (Entry.m_pSubscriber->*(Entry.m_Callback))(args...);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: sendEvent
+    // Description: Call all subscribed callbacks matching the specified family
+    //              (uses the dispatch list when family is the active family)
+    // -----------------------------------------------------------------------------
+    inline void sendEvent(uint32_t family, Args... args) {
+        if (family == m_ActiveFamily) {
+            sendEventToActive(args...);
+            return;
+        }
+
+        for (uint32_t Index = 0; Index < m_NbSubscribers; Index++) {
+            const sEntry& Entry = m_Subscribers[Index];
+            if (Entry.m_Family == 0 || Entry.m_Family == family) {
+                (Entry.m_pSubscriber->*(Entry.m_Callback))(args...);
+            }
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: sendEventToAll
+    // Description: Call all subscribed callbacks
+    // -----------------------------------------------------------------------------
+    inline void sendEventToAll(Args... args) {
+        for (uint32_t Index = 0; Index < m_NbSubscribers; Index++) {
+            const sEntry& Entry = m_Subscribers[Index];
+            (Entry.m_pSubscriber->*(Entry.m_Callback))(args...);
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: GetSubscriberCount
+    // Description: Get the current number of subscribers
+    // Parameters:
+    //   - family: Optional family filter (if provided, count only that family)
+    //   - includeUniversal: If true and family is specified, include family=0 subscribers
+    // -----------------------------------------------------------------------------
+    int GetSubscriberCount(uint32_t family = UINT32_MAX, bool includeUniversal = false) const {
+        if (family == UINT32_MAX) {
+            return (int)m_NbSubscribers;
+        }
+
+        int count = 0;
+        for (uint32_t Index = 0; Index < m_NbSubscribers; Index++) {
+            if (m_Subscribers[Index].m_Family == family || (includeUniversal && m_Subscribers[Index].m_Family == 0)) {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: GetActiveCount
+    // Description: Get the number of entries in the dispatch list
+    // -----------------------------------------------------------------------------
+    inline uint32_t GetActiveCount() const {
+        return m_pDispatch->m_Count;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: IsEmpty
+    // Description: Check if there are no subscribers
+    // -----------------------------------------------------------------------------
+    bool IsEmpty() const {
+        return m_NbSubscribers == 0;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Method: Clear
+    // Description: Remove all subscribers and reset the active family
+    // -----------------------------------------------------------------------------
+    void Clear() {
+        m_NbSubscribers = 0;
+        m_ActiveFamily = 0;
+        m_DispatchList[0].m_Count = 0;
+        m_DispatchList[1].m_Count = 0;
+        m_pDispatch = &m_DispatchList[0];
+    }
+
+private:
+    // =============================================================================
+    // Private types
+    // =============================================================================
+    struct sEntry {
+        Interface*  m_pSubscriber;  // Subscriber object
+        Callback_t  m_Callback;     // Member function to call
+        uint32_t    m_Family;       // Subscriber family
+    };
+
+    struct sDispatchList {
+        sEntry      m_Entries[MaxSubscribers];  // Pre-filtered entries
+        uint32_t    m_Count;                    // Number of valid entries
+    };
+
+    // -----------------------------------------------------------------------------
+    // Method: Rebuild
+    // Description: Fill the back dispatch list with family 0 and active family
+    //              subscribers then publish it
+    // -----------------------------------------------------------------------------
+    void Rebuild() {
+        sDispatchList* pBack = (m_pDispatch == &m_DispatchList[0]) ? &m_DispatchList[1] : &m_DispatchList[0];
+
+        uint32_t Count = 0;
+        for (uint32_t Index = 0; Index < m_NbSubscribers; Index++) {
+            const uint32_t Family = m_Subscribers[Index].m_Family;
+            if (Family == 0 || Family == m_ActiveFamily) {
+                pBack->m_Entries[Count++] = m_Subscribers[Index];
+            }
+        }
+        pBack->m_Count = Count;
+
+        __DMB();                    // Entries visible before the list is published
+        m_pDispatch = pBack;
+    }
+
+    // =============================================================================
+    // Private member variables
+    // =============================================================================
+    sEntry                  m_Subscribers[MaxSubscribers];  // All subscribers in subscription order
+    uint32_t                m_NbSubscribers;                // Number of subscribers
+    uint32_t                m_ActiveFamily;                 // Active family
+    sDispatchList           m_DispatchList[2];              // Front/back dispatch lists
+    sDispatchList* volatile m_pDispatch;                    // Published dispatch list
+};
+
+} // namespace DadUtilities
+
+//***End of file**************************************************************
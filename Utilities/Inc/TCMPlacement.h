@@ -0,0 +1,63 @@
+//==================================================================================
+//==================================================================================
+// File: TCMPlacement.h
+// Description: Opt-in placement of the audio hot paths in ITCM/DTCM
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#pragma once
+
+//**********************************************************************************
+// Opt-in: define TCM_PLACEMENT in HardwareAndCoDefines.h (or on the compiler
+// command line). Without it every attribute below is empty and the build is
+// unchanged.
+//
+// ITCM_CODE : function executed from ITCM (64 KB at 0x00000000, no wait state,
+//             no flash/cache miss). Used on the audio callback chain and on
+//             the effect onProcess hot paths.
+// DTCM_DATA : data in DTCM (128 KB at 0x20000000, no wait state, not cached).
+//             cMemoryPlan places its hot regions there (RAM_DTCM).
+//
+// Build support - the linker script of the application needs:
+//
+//     .moveITCM : {
+//         . = ALIGN(4);
+//         _sitcm = .;
+//         *(.moveITCM)
+//         *(.moveITCM*)
+//         . = ALIGN(4);
+//         _eitcm = .;
+//     } >ITCMRAM AT> FLASH
+//     _siitcm = LOADADDR(.moveITCM);
+//
+//     .DTCM_Section (NOLOAD) : {
+//         . = ALIGN(32);
+//         *(.DTCM_Section)
+//         *(.DTCM_Section*)
+//     } >DTCMRAM
+//
+// and the startup code copies _siitcm -> [_sitcm, _eitcm) before main(), as it
+// does for .data. Calls between flash and ITCM are out of BL range: the linker
+// inserts long branch veneers, so keep the whole hot call chain in ITCM.
+//
+// Verification: "@Python Utilities/TCMCheck/TCMCheck.py <firmware>.map" checks
+// that the marked functions and buffers really landed in ITCM/DTCM.
+//
+// Benchmark: build with MONITOR, with and without TCM_PLACEMENT, and compare
+// the "Audio cb/blk" entry of the SysEx BENCH command on the same preset
+// (AudioCallback timed on silent blocks with the audio suspended, so the
+// live interrupt load does not blur the difference). The host tests do not
+// say anything about placement: they only use their own timing.
+//**********************************************************************************
+
+#ifdef TCM_PLACEMENT
+#define ITCM_CODE   __attribute__((section(".moveITCM")))
+#define DTCM_DATA   __attribute__((section(".DTCM_Section")))
+#else
+#define ITCM_CODE
+#define DTCM_DATA
+#endif
+
+//***End of file**************************************************************
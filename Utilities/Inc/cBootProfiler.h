@@ -0,0 +1,112 @@
+//==================================================================================
+//==================================================================================
+// File: cBootProfiler.h
+// Description: Cycle stamps of the boot phases (time to first audio)
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#pragma once
+
+#include "main.h"
+#include <cstdint>
+
+#ifndef BOOT_PROFILER_MAX_PHASES
+#define BOOT_PROFILER_MAX_PHASES    16      // Phases recorded (later marks are counted, not stored)
+#endif
+#define BOOT_PROFILER_NAME_SIZE     12      // Phase name characters kept for the SysEx report
+
+namespace DadUtilities {
+
+// Called after each mark (splash screen refresh)
+using BootMarkCallback_t = void(*)(uint32_t Context);
+
+//**********************************************************************************
+// Struct: sBootPhase
+// Description: One boot phase, closed by a call to Mark
+//**********************************************************************************
+struct sBootPhase {
+    const char*     pName;          // Phase name (literal)
+    uint32_t        Cycles;         // Duration in CPU cycles
+};
+
+//**********************************************************************************
+// Class: cBootProfiler
+// Description:
+// Records the duration of the boot phases with the DWT cycle counter.
+// The application calls Start as soon as the clocks are configured, then Mark
+// at the end of each phase:
+//
+//     __BootProfiler.Start();
+//     ...SDRAM init...            __BootProfiler.Mark("SDRAM");
+//     ...QSPI init...             __BootProfiler.Mark("QSPI");
+//     __Codec.StartInitialize(&hi2c);   (codec set up by the I2C interrupt)
+//     PrestartAudio(...);         (marks "SAI", silence until StartAudio)
+//     __GUI.Initialize();         (marks "GUI" itself)
+//     __GUI.ShowSplash("FORGE");  (phases drawn from now on)
+//     ...
+//     while (!__Codec.isReady()) {}
+//     StartAudio(...);            (marks "Audio", time to first audio)
+//
+// The codec writes and the SAI start run under the GUI, storage and effect
+// phases instead of before them.
+// The framework marks its own phases (fonts, storage, effect, audio).
+// The table stays in RAM for the debugger and is sent by the SysEx BOOT command.
+// The cycle counter wraps after 2^32 cycles (8.9 s at 480 MHz): longer phases
+// are not measurable.
+//**********************************************************************************
+class cBootProfiler {
+public:
+    // -----------------------------------------------------------------------------
+    // Enable the cycle counter and open the first phase
+    void Start();
+
+    // -----------------------------------------------------------------------------
+    // Close the current phase and open the next one (no-op before Start)
+    void Mark(const char* pName);
+
+    // -----------------------------------------------------------------------------
+    // Close the profile: later marks are ignored
+    inline void Stop() { m_Running = false; }
+
+    // -----------------------------------------------------------------------------
+    // Listener called after each mark
+    inline void setListener(BootMarkCallback_t Callback, uint32_t Context) {
+        m_Callback = Callback;
+        m_CallbackContext = Context;
+    }
+
+    // -----------------------------------------------------------------------------
+    // Accessors
+    inline bool isRunning() const { return m_Running; }
+    inline uint8_t getNbPhases() const { return m_NbPhases; }
+    inline const sBootPhase& getPhase(uint8_t Index) const { return m_Phases[Index]; }
+    inline uint32_t getTotalCycles() const { return m_TotalCycles; }
+    inline uint32_t getLostPhases() const { return m_LostPhases; }
+    inline uint32_t getCoreClock() const { return m_CoreClock; }
+
+    // -----------------------------------------------------------------------------
+    // Cycles to milliseconds at the core clock of the profile
+    inline float CyclesToMs(uint32_t Cycles) const {
+        return (m_CoreClock != 0) ? (float)Cycles * 1000.0f / (float)m_CoreClock : 0.0f;
+    }
+
+protected:
+    sBootPhase          m_Phases[BOOT_PROFILER_MAX_PHASES];
+    uint8_t             m_NbPhases = 0;
+    uint32_t            m_LostPhases = 0;       // Marks beyond BOOT_PROFILER_MAX_PHASES
+    uint32_t            m_LastStamp = 0;        // Cycle counter at the last mark
+    uint32_t            m_TotalCycles = 0;      // Start to last mark
+    uint32_t            m_CoreClock = 0;        // Hz
+    bool                m_Running = false;
+
+    BootMarkCallback_t  m_Callback = nullptr;
+    uint32_t            m_CallbackContext = 0;
+};
+
+} // namespace DadUtilities
+
+extern DadUtilities::cBootProfiler __BootProfiler;
+
+//***End of file**************************************************************
@@ -0,0 +1,185 @@
+//==================================================================================
+//==================================================================================
+// File: cMemoryPlan.h
+// Description: Compile time memory planner for the effect buffers
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#pragma once
+
+#include "HardwareDefines.h"
+#include "TCMPlacement.h"
+#include <cstdint>
+
+//**********************************************************************************
+// Bank budgets available to the buffers of one effect (bytes)
+// Can be overridden in HardwareAndCoDefines.h
+//**********************************************************************************
+#ifndef MEMPLAN_DTCM_BUDGET
+#define MEMPLAN_DTCM_BUDGET     (48 * 1024)             // DTCM left by stacks, heap and globals
+#endif
+#ifndef MEMPLAN_D1_BUDGET
+#define MEMPLAN_D1_BUDGET       (256 * 1024)            // AXI SRAM
+#endif
+#ifndef MEMPLAN_D2_BUDGET
+#define MEMPLAN_D2_BUDGET       (32 * 1024)             // D2 SRAM, not cached (DMA)
+#endif
+#ifndef MEMPLAN_SDRAM_BUDGET
+#define MEMPLAN_SDRAM_BUDGET    (48 * 1024 * 1024)      // SDRAM left by the display layers
+#endif
+
+// DTCM arena: explicit DTCM section with TCM_PLACEMENT (see TCMPlacement.h),
+// default .bss otherwise (linked in DTCM by the STM32CubeIDE linker scripts)
+#ifndef RAM_DTCM
+#define RAM_DTCM DTCM_DATA
+#endif
+
+namespace DadUtilities {
+
+//**********************************************************************************
+// Memory banks, from the fastest to the slowest
+//**********************************************************************************
+enum class eMemBank : uint8_t {
+    DTCM = 0,       // Tightly coupled, no wait state, not cached
+    D1,             // AXI SRAM, cached
+    D2,             // D2 SRAM, not cached (DMA buffers)
+    SDRAM           // External, cached
+};
+constexpr uint8_t  MEM_NB_BANKS = 4;
+constexpr uint32_t MEM_CACHE_LINE = 32;
+
+constexpr uint32_t MEM_BANK_BUDGET[MEM_NB_BANKS] = {
+    MEMPLAN_DTCM_BUDGET, MEMPLAN_D1_BUDGET, MEMPLAN_D2_BUDGET, MEMPLAN_SDRAM_BUDGET
+};
+
+//**********************************************************************************
+// Struct: sMemRegion
+// Description: One named buffer of the plan
+//**********************************************************************************
+struct sMemRegion {
+    const char*     pName;      // Buffer name (debug)
+    uint32_t        Size;       // Size in bytes
+    uint32_t        Align;      // Alignment in bytes (power of 2)
+    eMemBank        Bank;       // Bank of a cold region, fallback of a hot one
+    bool            Hot;        // Accessed at every sample: fastest bank with room
+};
+
+// -----------------------------------------------------------------------------
+// Region helpers (float buffers, cache line aligned)
+constexpr sMemRegion HotFloatRegion(const char* pName, uint32_t NbFloats,
+                                    eMemBank Fallback = eMemBank::SDRAM) {
+    return sMemRegion{pName, NbFloats * (uint32_t)sizeof(float), MEM_CACHE_LINE, Fallback, true};
+}
+constexpr sMemRegion FloatRegion(const char* pName, uint32_t NbFloats,
+                                 eMemBank Bank = eMemBank::SDRAM) {
+    return sMemRegion{pName, NbFloats * (uint32_t)sizeof(float), MEM_CACHE_LINE, Bank, false};
+}
+
+//**********************************************************************************
+// Class: cMemoryPlan
+// Description: Lays out the regions of an effect in one arena per bank
+//
+// Placement (evaluated at compile time):
+// - hot regions, in declaration order, go to DTCM then D1 while they fit
+//   the bank budget, otherwise to their fallback bank;
+// - cold regions go to their own bank.
+// D2 is never chosen automatically: it is not cached and reserved for DMA.
+// Each region is aligned on its own alignment inside its arena.
+//
+// Usage, in the effect source file:
+//     constexpr sMemRegion REGIONS[] = { ... };
+//     constexpr cMemoryPlan<N> PLAN(REGIONS);
+//     static_assert(PLAN.fits(), "...");
+//     DECLARE_MEMORY_ARENAS(__Prefix, PLAN)
+//     float* p = PLAN.getBuffer<float>(__Prefix, Region);
+// The arenas keep the prefix in the link map: <Prefix>DTCM, <Prefix>D1...
+//**********************************************************************************
+template <uint32_t NbRegions>
+class cMemoryPlan {
+public:
+    // -----------------------------------------------------------------------------
+    // Builds the plan
+    constexpr cMemoryPlan(const sMemRegion (&Regions)[NbRegions])
+        : m_Bank{}, m_Offset{}, m_Used{}, m_Fits(true) {
+        // Hot regions first so they get the internal banks
+        for (uint32_t i = 0; i < NbRegions; i++) {
+            if (Regions[i].Hot) {
+                eMemBank Bank = Regions[i].Bank;
+                if (fitsIn(eMemBank::DTCM, Regions[i])) {
+                    Bank = eMemBank::DTCM;
+                } else if (fitsIn(eMemBank::D1, Regions[i])) {
+                    Bank = eMemBank::D1;
+                }
+                place(i, Bank, Regions[i]);
+            }
+        }
+        for (uint32_t i = 0; i < NbRegions; i++) {
+            if (!Regions[i].Hot) {
+                place(i, Regions[i].Bank, Regions[i]);
+            }
+        }
+    }
+
+    // -----------------------------------------------------------------------------
+    // Plan results
+    constexpr eMemBank getBank(uint32_t Region) const { return m_Bank[Region]; }
+    constexpr uint32_t getOffset(uint32_t Region) const { return m_Offset[Region]; }
+    constexpr uint32_t getBankUsed(eMemBank Bank) const { return m_Used[(uint8_t)Bank]; }
+    constexpr bool fits() const { return m_Fits; }
+
+    // -----------------------------------------------------------------------------
+    // Arena size of a bank (never 0, a C array cannot be empty)
+    constexpr uint32_t getArenaSize(eMemBank Bank) const {
+        return (m_Used[(uint8_t)Bank] == 0) ? MEM_CACHE_LINE : m_Used[(uint8_t)Bank];
+    }
+
+    // -----------------------------------------------------------------------------
+    // Address of a region
+    template <typename T>
+    inline T* getBuffer(uint8_t* const (&pArenas)[MEM_NB_BANKS], uint32_t Region) const {
+        return reinterpret_cast<T*>(pArenas[(uint8_t)m_Bank[Region]] + m_Offset[Region]);
+    }
+
+protected:
+    // -----------------------------------------------------------------------------
+    static constexpr uint32_t alignUp(uint32_t Value, uint32_t Align) {
+        return (Value + Align - 1) & ~(Align - 1);
+    }
+
+    constexpr bool fitsIn(eMemBank Bank, const sMemRegion& Region) const {
+        return alignUp(m_Used[(uint8_t)Bank], Region.Align) + Region.Size <= MEM_BANK_BUDGET[(uint8_t)Bank];
+    }
+
+    constexpr void place(uint32_t i, eMemBank Bank, const sMemRegion& Region) {
+        if (!fitsIn(Bank, Region)) m_Fits = false;
+        uint32_t Offset = alignUp(m_Used[(uint8_t)Bank], Region.Align);
+        m_Bank[i] = Bank;
+        m_Offset[i] = Offset;
+        m_Used[(uint8_t)Bank] = Offset + Region.Size;
+    }
+
+    // =============================================================================
+    // Member variables
+    // =============================================================================
+    eMemBank    m_Bank[NbRegions];          // Bank of each region
+    uint32_t    m_Offset[NbRegions];        // Offset of each region in its arena
+    uint32_t    m_Used[MEM_NB_BANKS];       // Bytes used per bank
+    bool        m_Fits;                     // All banks within their budget
+};
+
+} // namespace DadUtilities
+
+//**********************************************************************************
+// Declares the arenas of a plan (one per bank, cache line aligned) and the
+// table of their addresses used by cMemoryPlan::getBuffer
+//**********************************************************************************
+#define DECLARE_MEMORY_ARENAS(Prefix, Plan) \
+    RAM_DTCM      __attribute__((aligned(32))) static uint8_t Prefix##DTCM[(Plan).getArenaSize(DadUtilities::eMemBank::DTCM)];   \
+    RAM_D1        __attribute__((aligned(32))) static uint8_t Prefix##D1[(Plan).getArenaSize(DadUtilities::eMemBank::D1)];       \
+    NO_CACHE_RAM  __attribute__((aligned(32))) static uint8_t Prefix##D2[(Plan).getArenaSize(DadUtilities::eMemBank::D2)];       \
+    SDRAM_SECTION __attribute__((aligned(32))) static uint8_t Prefix##SDRAM[(Plan).getArenaSize(DadUtilities::eMemBank::SDRAM)]; \
+    static uint8_t* const Prefix[DadUtilities::MEM_NB_BANKS] = { Prefix##DTCM, Prefix##D1, Prefix##D2, Prefix##SDRAM };
+
+//***End of file**************************************************************
@@ -0,0 +1,62 @@
+//==================================================================================
+//==================================================================================
+// File: cBootProfiler.cpp
+// Description: Cycle stamps of the boot phases (time to first audio)
+//
+// Copyright (c) 2026 Dad Design.
+//==================================================================================
+//==================================================================================
+
+#include "cBootProfiler.h"
+#include "cMonitor.h"
+
+DadUtilities::cBootProfiler __BootProfiler;    // Boot phases of the firmware
+
+namespace DadUtilities {
+
+//**********************************************************************************
+// Class: cBootProfiler
+//**********************************************************************************
+
+// -----------------------------------------------------------------------------
+// Enable the cycle counter and open the first phase
+void cBootProfiler::Start()
+{
+    cMonitor::initDWT();
+    SystemCoreClockUpdate();
+    m_CoreClock   = SystemCoreClock;
+    m_NbPhases    = 0;
+    m_LostPhases  = 0;
+    m_TotalCycles = 0;
+    m_LastStamp   = DWT->CYCCNT;
+    m_Running     = true;
+}
+
+// -----------------------------------------------------------------------------
+// Close the current phase and open the next one
+void cBootProfiler::Mark(const char* pName)
+{
+    if (!m_Running) return;
+
+    uint32_t Stamp  = DWT->CYCCNT;
+    uint32_t Cycles = Stamp - m_LastStamp;
+    m_LastStamp     = Stamp;
+    m_TotalCycles  += Cycles;
+
+    if (m_NbPhases < BOOT_PROFILER_MAX_PHASES) {
+        m_Phases[m_NbPhases].pName  = pName;
+        m_Phases[m_NbPhases].Cycles = Cycles;
+        m_NbPhases++;
+    } else {
+        m_LostPhases++;
+    }
+
+    // The listener time (splash drawing) is counted in the next phase
+    if (m_Callback != nullptr) {
+        m_Callback(m_CallbackContext);
+    }
+}
+
+} // namespace DadUtilities
+
+//***End of file**************************************************************